@@ -1,4 +0,0 @@
-#include <array>
-#include <cstdint>
-
-std::array<std::uint8_t, 42318> beepData{82, 73, 70, 70, 70, 165, 0, 0, 87, 65, 86, 69, 102, 109, 116, 32, 16, 0, 0, 0, 1, 0, 2, 0, 68, 172, 0, 0, 16, 177, 2, 0, 4, 0, 16, 0, 76, 73, 83, 84, 26, 0, 0, 0, 73, 78, 70, 79, 73, 83, 70, 84, 14, 0, 0, 0, 76, 97, 118, 102, 53, 55, 46, 56, 51, 46, 49, 48, 48, 0, 100, 97, 116, 97, 0, 165, 0, 0, 193, 4, 56, 5, 168, 253, 212, 252, 51, 246, 178, 245, 124, 245, 202, 246, 156, 254, 37, 255, 164, 17, 107, 16, 242, 41, 158, 41, 128, 38, 139, 39, 81, 245, 203, 245, 173, 200, 113, 200, 189, 180, 156, 180, 35, 234, 43, 234, 50, 29, 158, 29, 24, 11, 189, 11, 69, 4, 78, 4, 240, 2, 195, 2, 177, 255, 43, 0, 89, 255, 184, 255, 22, 1, 230, 0, 104, 254, 250, 254, 11, 2, 62, 3, 145, 5, 72, 5, 96, 0, 47, 255, 176, 2, 147, 3, 208, 245, 22, 248, 191, 255, 212, 255, 224, 1, 38, 0, 242, 3, 240, 3, 25, 11, 255, 12, 105, 193, 140, 194, 2, 152, 145, 151, 220, 215, 14, 215, 7, 57, 33, 57, 162, 111, 238, 112, 50, 66, 65, 67, 76, 217, 205, 216, 243, 168, 39, 168, 190, 213, 61, 214, 236, 28, 240, 29, 219, 53, 33, 54, 120, 10, 10, 10, 91, 250, 223, 249, 37, 0, 112, 0, 237, 251, 218, 252, 24, 12, 18, 12, 24, 3, 19, 2, 24, 254, 234, 253, 236, 254, 118, 255, 12, 251, 246, 250, 32, 3, 5, 3, 62, 1, 76, 1, 157, 0, 158, 255, 198, 0, 225, 255, 49, 5, 20, 6, 244, 12, 160, 13, 108, 8, 63, 7, 182, 250, 170, 249, 88, 250, 85, 250, 167, 255, 123, 255, 118, 3, 121, 3, 31, 9, 131, 9, 190, 2, 6, 2, 247, 1, 165, 0, 61, 253, 58, 253, 237, 251, 128, 252, 164, 4, 125, 4, 102, 2, 44, 2, 92, 1, 28, 1, 194, 253, 247, 252, 189, 251, 138, 251, 106, 2, 49, 3, 92, 10, 115, 10, 77, 8, 164, 7, 146, 255, 145, 255, 38, 252, 62, 252, 27, 252, 160, 251, 105, 255, 145, 255, 151, 2, 77, 3, 214, 7, 137, 7, 182, 7, 19, 7, 34, 254, 126, 254, 115, 250, 173, 250, 191, 253, 26, 253, 156, 252, 136, 252, 94, 0, 17, 1, 93, 5, 109, 5, 18, 254, 99, 253, 225, 253, 63, 253, 6, 1, 202, 0, 28, 254, 169, 254, 66, 251, 255, 251, 9, 3, 84, 2, 252, 12, 119, 11, 232, 0, 227, 0, 126, 246, 71, 247, 2, 251, 140, 250, 215, 5, 103, 5, 3, 6, 197, 6, 3, 1, 93, 0, 162, 254, 67, 252, 167, 209, 208, 209, 119, 214, 56, 217, 219, 63, 252, 63, 196, 101, 240, 98, 116, 37, 68, 36, 22, 188, 31, 189, 0, 128, 219, 128, 92, 198, 31, 199, 168, 48, 40, 48, 172, 122, 50, 120, 211, 99, 32, 99, 134, 244, 94, 247, 236, 216, 98, 218, 191, 245, 161, 243, 14, 255, 167, 253, 74, 7, 70, 8, 76, 4, 36, 5, 210, 253, 5, 254, 230, 249, 40, 250, 115, 250, 26, 250, 165, 250, 16, 250, 153, 252, 254, 252, 166, 254, 136, 255, 62, 7, 154, 7, 91, 9, 50, 9, 230, 249, 162, 249, 175, 248, 193, 248, 3, 245, 133, 245, 47, 0, 162, 0, 187, 13, 242, 13, 53, 254, 97, 254, 216, 0, 197, 0, 77, 5, 24, 5, 144, 2, 255, 2, 224, 0, 226, 1, 75, 255, 179, 255, 112, 0, 229, 255, 193, 246, 104, 246, 154, 244, 21, 245, 0, 246, 170, 246, 14, 251, 145, 251, 155, 255, 3, 0, 208, 255, 137, 255, 170, 4, 247, 3, 167, 255, 78, 0, 146, 252, 110, 254, 248, 254, 148, 255, 71, 4, 26, 3, 101, 255, 96, 254, 210, 248, 7, 249, 145, 0, 169, 1, 225, 0, 227, 1, 27, 5, 242, 4, 105, 1, 210, 0, 88, 251, 147, 251, 141, 0, 32, 1, 59, 255, 145, 255, 124, 253, 122, 253, 93, 245, 35, 244, 109, 251, 60, 249, 109, 4, 10, 4, 208, 255, 227, 1, 251, 6, 215, 8, 199, 5, 147, 5, 131, 254, 171, 252, 61, 0, 40, 254, 207, 248, 76, 248, 251, 242, 132, 244, 68, 3, 80, 3, 11, 8, 173, 5, 48, 0, 248, 255, 47, 0, 136, 2, 2, 249, 6, 250, 254, 254, 96, 254, 15, 3, 127, 2, 161, 1, 138, 255, 91, 250, 170, 247, 165, 234, 210, 235, 57, 13, 38, 16, 76, 53, 185, 52, 125, 41, 235, 39, 27, 218, 26, 219, 223, 144, 215, 143, 128, 197, 108, 194, 75, 4, 99, 5, 167, 3, 98, 6, 74, 7, 199, 6, 172, 6, 151, 5, 117, 253, 142, 254, 78, 254, 20, 254, 4, 6, 8, 3, 28, 6, 125, 4, 72, 3, 39, 5, 110, 250, 234, 253, 109, 249, 86, 250, 96, 255, 252, 252, 10, 0, 63, 255, 231, 6, 164, 9, 63, 254, 86, 254, 207, 40, 228, 36, 206, 87, 236, 87, 38, 9, 226, 12, 158, 179, 59, 181, 20, 173, 218, 172, 198, 234, 127, 233, 161, 63, 26, 61, 204, 72, 52, 71, 28, 14, 172, 15, 245, 197, 246, 200, 40, 185, 11, 188, 157, 251, 128, 252, 209, 32, 25, 29, 98, 5, 57, 0, 91, 0, 124, 255, 246, 15, 43, 18, 62, 4, 45, 4, 158, 1, 77, 1, 74, 2, 204, 3, 81, 252, 160, 253, 101, 255, 156, 1, 58, 2, 158, 3, 241, 8, 194, 5, 96, 5, 124, 255, 200, 2, 224, 0, 27, 2, 84, 6, 123, 246, 239, 251, 185, 249, 227, 252, 108, 2, 255, 2, 243, 4, 165, 3, 105, 4, 10, 2, 155, 1, 194, 255, 180, 2, 65, 1, 29, 3, 248, 1, 0, 1, 0, 2, 148, 255, 247, 0, 184, 255, 187, 0, 218, 1, 166, 4, 87, 9, 232, 11, 220, 8, 51, 6, 220, 2, 232, 252, 17, 7, 145, 5, 6, 4, 235, 6, 132, 252, 77, 253, 219, 253, 127, 251, 66, 253, 57, 252, 16, 251, 23, 253, 155, 251, 253, 255, 66, 249, 145, 252, 97, 251, 52, 249, 80, 3, 39, 255, 243, 5, 141, 3, 75, 7, 27, 6, 168, 2, 78, 3, 175, 253, 169, 255, 28, 253, 12, 255, 14, 251, 148, 252, 223, 254, 234, 255, 251, 252, 157, 253, 190, 252, 204, 252, 165, 2, 112, 0, 143, 5, 68, 2, 86, 7, 189, 5, 17, 255, 99, 255, 24, 253, 44, 0, 194, 255, 78, 2, 2, 1, 199, 0, 174, 1, 27, 1, 118, 254, 175, 252, 212, 3, 110, 1, 78, 251, 237, 249, 20, 255, 10, 255, 66, 252, 212, 252, 181, 182, 18, 182, 34, 162, 147, 163, 241, 242, 119, 247, 90, 83, 200, 84, 185, 121, 61, 120, 99, 47, 84, 47, 55, 199, 240, 198, 113, 161, 34, 160, 53, 200, 19, 199, 0, 37, 112, 35, 108, 66, 76, 65, 227, 19, 98, 22, 3, 1, 224, 7, 240, 1, 11, 6, 52, 0, 87, 252, 252, 1, 7, 252, 230, 0, 93, 254, 208, 0, 153, 0, 140, 0, 224, 1, 105, 1, 66, 3, 44, 3, 117, 3, 44, 2, 187, 2, 38, 255, 49, 0, 114, 1, 37, 0, 119, 254, 110, 252, 51, 252, 152, 254, 34, 249, 77, 253, 129, 218, 236, 214, 234, 238, 127, 232, 191, 51, 192, 51, 105, 49, 45, 52, 154, 2, 109, 5, 11, 230, 86, 233, 53, 236, 190, 238, 177, 4, 217, 3, 192, 8, 63, 4, 215, 1, 27, 254, 170, 249, 208, 248, 176, 251, 145, 253, 77, 6, 163, 9, 13, 5, 229, 7, 229, 251, 162, 252, 123, 248, 252, 245, 174, 2, 237, 255, 160, 8, 218, 8, 105, 3, 14, 4, 105, 251, 230, 248, 121, 248, 239, 245, 157, 254, 199, 255, 170, 255, 207, 1, 180, 1, 31, 2, 19, 254, 76, 253, 11, 247, 226, 246, 50, 255, 221, 255, 117, 254, 130, 253, 147, 254, 65, 253, 95, 3, 15, 4, 13, 253, 92, 253, 217, 0, 111, 0, 20, 5, 237, 5, 245, 4, 37, 6, 33, 1, 202, 1, 216, 251, 164, 252, 200, 2, 187, 2, 62, 255, 78, 253, 155, 253, 13, 253, 99, 5, 151, 6, 51, 4, 30, 3, 123, 4, 14, 2, 251, 1, 163, 1, 226, 254, 5, 1, 85, 249, 248, 250, 22, 247, 225, 246, 34, 0, 105, 255, 204, 5, 37, 4, 225, 11, 71, 10, 241, 3, 253, 3, 254, 248, 140, 250, 20, 252, 151, 253, 140, 255, 243, 254, 137, 22, 138, 21, 17, 25, 169, 25, 203, 245, 219, 246, 152, 243, 142, 244, 18, 0, 235, 255, 19, 254, 255, 251, 28, 2, 13, 1, 252, 255, 35, 1, 238, 254, 222, 255, 194, 2, 118, 3, 23, 255, 253, 0, 15, 254, 174, 255, 218, 251, 74, 251, 73, 250, 123, 249, 202, 2, 199, 1, 144, 3, 173, 0, 81, 253, 27, 252, 14, 250, 73, 253, 21, 234, 0, 238, 52, 4, 99, 4, 70, 72, 84, 69, 248, 55, 158, 51, 116, 238, 138, 235, 176, 186, 52, 188, 226, 194, 43, 199, 187, 26, 233, 29, 33, 73, 184, 71, 119, 39, 60, 37, 12, 219, 112, 219, 85, 165, 126, 165, 161, 215, 141, 215, 8, 5, 126, 4, 4, 255, 145, 255, 3, 252, 10, 254, 122, 251, 234, 252, 17, 3, 180, 4, 143, 2, 133, 1, 39, 0, 154, 251, 40, 254, 49, 251, 169, 253, 216, 254, 97, 3, 27, 6, 15, 2, 166, 4, 208, 1, 75, 3, 216, 253, 182, 251, 105, 252, 203, 248, 95, 254, 168, 252, 14, 1, 243, 1, 103, 5, 243, 5, 235, 1, 4, 2, 37, 3, 88, 5, 196, 2, 112, 2, 44, 255, 241, 252, 68, 1, 52, 1, 8, 255, 181, 254, 190, 250, 87, 249, 82, 253, 111, 253, 86, 254, 154, 1, 10, 254, 63, 1, 122, 2, 127, 1, 43, 0, 207, 251, 20, 5, 100, 2, 78, 5, 176, 6, 203, 251, 179, 255, 22, 3, 121, 6, 149, 4, 192, 3, 149, 5, 121, 2, 37, 7, 221, 4, 82, 0, 255, 255, 229, 255, 30, 1, 158, 251, 194, 252, 125, 251, 30, 253, 191, 0, 55, 1, 221, 3, 255, 1, 1, 8, 141, 4, 110, 7, 236, 4, 214, 255, 224, 0, 73, 253, 93, 0, 13, 1, 6, 4, 81, 255, 150, 255, 153, 255, 122, 253, 59, 251, 42, 248, 93, 252, 89, 250, 61, 1, 191, 2, 69, 253, 76, 0, 248, 3, 2, 7, 171, 2, 19, 4, 90, 0, 9, 0, 199, 3, 212, 2, 4, 0, 107, 254, 146, 253, 96, 252, 80, 15, 120, 14, 198, 47, 16, 48, 192, 5, 27, 6, 246, 183, 61, 185, 41, 173, 44, 176, 230, 229, 124, 230, 36, 60, 115, 57, 234, 71, 231, 67, 178, 15, 205, 14, 190, 209, 114, 211, 93, 186, 107, 187, 42, 247, 55, 249, 92, 27, 49, 27, 164, 4, 210, 1, 176, 252, 253, 251, 226, 255, 7, 1, 242, 253, 70, 254, 96, 248, 57, 248, 175, 253, 231, 255, 25, 4, 17, 7, 145, 7, 221, 6, 222, 8, 58, 4, 99, 2, 209, 253, 37, 1, 211, 0, 103, 255, 151, 4, 195, 0, 255, 6, 42, 5, 107, 5, 6, 13, 228, 8, 70, 252, 225, 248, 251, 186, 209, 186, 190, 175, 179, 179, 146, 253, 171, 255, 189, 81, 67, 80, 80, 110, 128, 109, 211, 44, 223, 41, 60, 215, 1, 211, 196, 197, 4, 198, 165, 232, 46, 236, 113, 13, 118, 15, 181, 9, 237, 7, 27, 254, 134, 252, 98, 2, 238, 3, 105, 0, 2, 2, 177, 0, 200, 0, 190, 254, 149, 252, 38, 0, 237, 253, 144, 4, 165, 6, 155, 255, 27, 3, 251, 2, 252, 3, 242, 3, 129, 3, 239, 252, 218, 250, 15, 254, 81, 252, 239, 0, 178, 2, 198, 0, 207, 1, 75, 254, 143, 252, 63, 255, 122, 254, 152, 2, 163, 3, 68, 3, 210, 4, 114, 8, 62, 9, 167, 7, 242, 7, 50, 0, 232, 254, 187, 1, 70, 253, 190, 2, 171, 255, 158, 0, 156, 3, 5, 255, 137, 4, 81, 0, 246, 1, 187, 4, 139, 1, 224, 4, 14, 1, 100, 4, 207, 3, 218, 250, 164, 252, 117, 246, 232, 248, 195, 255, 43, 1, 166, 0, 243, 254, 148, 6, 247, 4, 36, 9, 84, 9, 221, 255, 65, 0, 148, 251, 190, 252, 44, 249, 14, 251, 244, 253, 152, 254, 235, 4, 40, 3, 18, 3, 9, 1, 187, 254, 186, 253, 76, 1, 63, 2, 9, 2, 147, 4, 5, 253, 21, 254, 69, 254, 24, 254, 71, 0, 81, 255, 226, 255, 216, 253, 177, 252, 231, 249, 40, 255, 165, 253, 156, 4, 121, 5, 191, 1, 49, 2, 185, 0, 63, 2, 219, 255, 204, 2, 56, 1, 30, 1, 186, 2, 212, 255, 169, 5, 234, 3, 95, 5, 77, 5, 224, 0, 180, 0, 84, 246, 123, 247, 37, 207, 77, 210, 43, 226, 244, 228, 154, 52, 116, 51, 254, 70, 149, 66, 242, 21, 61, 19, 111, 195, 133, 195, 19, 159, 35, 162, 254, 222, 237, 226, 85, 60, 241, 61, 78, 114, 118, 113, 242, 62, 144, 59, 180, 234, 233, 231, 87, 238, 9, 237, 90, 5, 89, 3, 47, 253, 60, 253, 28, 250, 60, 253, 29, 248, 70, 250, 5, 246, 182, 246, 5, 247, 93, 247, 123, 248, 62, 247, 20, 1, 62, 0, 6, 5, 49, 6, 44, 3, 121, 4, 127, 255, 166, 253, 161, 253, 16, 249, 106, 6, 242, 5, 90, 1, 153, 4, 178, 244, 159, 247, 12, 248, 57, 251, 7, 255, 7, 0, 139, 3, 184, 1, 47, 254, 59, 251, 114, 246, 140, 243, 188, 246, 174, 247, 117, 251, 95, 255, 13, 4, 87, 6, 238, 2, 82, 3, 178, 253, 164, 252, 34, 254, 218, 252, 76, 254, 234, 254, 39, 254, 222, 253, 42, 252, 54, 248, 240, 0, 129, 252, 192, 5, 144, 6, 28, 0, 69, 6, 89, 249, 49, 253, 218, 244, 15, 244, 134, 252, 104, 251, 211, 5, 13, 4, 74, 4, 28, 2, 99, 3, 48, 3, 40, 255, 152, 255, 178, 251, 139, 252, 115, 250, 236, 252, 172, 249, 68, 253, 207, 2, 70, 4, 98, 8, 178, 4, 9, 3, 6, 254, 241, 254, 226, 253, 59, 253, 83, 0, 182, 252, 62, 1, 173, 1, 225, 3, 19, 5, 30, 2, 79, 2, 142, 252, 65, 254, 213, 250, 154, 253, 5, 254, 178, 0, 145, 4, 121, 1, 143, 6, 106, 3, 38, 5, 153, 0, 168, 251, 251, 251, 189, 245, 5, 248, 69, 249, 173, 245, 20, 249, 234, 6, 98, 5, 155, 11, 99, 9, 98, 248, 37, 250, 91, 220, 102, 223, 59, 221, 174, 220, 124, 30, 13, 29, 182, 70, 11, 71, 79, 38, 52, 38, 174, 213, 0, 211, 216, 167, 22, 166, 112, 222, 0, 226, 180, 3, 93, 6, 218, 251, 100, 250, 224, 253, 254, 252, 5, 254, 209, 0, 101, 2, 153, 4, 98, 6, 144, 2, 205, 7, 68, 3, 202, 6, 186, 4, 172, 3, 243, 3, 52, 252, 54, 254, 222, 252, 238, 253, 75, 255, 15, 1, 204, 254, 172, 0, 203, 6, 226, 6, 231, 2, 23, 1, 213, 52, 122, 50, 53, 83, 31, 80, 45, 247, 65, 244, 54, 178, 215, 180, 79, 178, 251, 183, 17, 243, 83, 246, 27, 70, 168, 69, 184, 61, 184, 59, 157, 3, 219, 1, 187, 196, 208, 194, 203, 195, 42, 198, 29, 3, 29, 8, 235, 14, 143, 16, 14, 1, 53, 255, 105, 9, 195, 4, 203, 4, 164, 0, 11, 252, 229, 252, 184, 254, 106, 3, 207, 0, 75, 4, 201, 2, 47, 4, 227, 1, 51, 1, 39, 2, 52, 254, 248, 4, 192, 255, 159, 4, 116, 2, 223, 3, 74, 8, 248, 254, 145, 5, 97, 255, 108, 2, 210, 0, 107, 255, 11, 2, 67, 253, 198, 2, 223, 254, 204, 250, 96, 250, 78, 255, 30, 2, 106, 6, 20, 11, 190, 6, 132, 9, 44, 4, 32, 2, 83, 254, 94, 250, 243, 253, 174, 251, 190, 251, 69, 252, 130, 254, 140, 2, 108, 3, 99, 6, 23, 6, 210, 5, 13, 5, 34, 4, 78, 255, 174, 254, 110, 0, 237, 255, 254, 253, 89, 251, 81, 253, 205, 250, 66, 0, 92, 1, 132, 3, 244, 5, 73, 5, 177, 5, 55, 254, 168, 252, 97, 254, 89, 254, 184, 0, 139, 2, 30, 3, 175, 3, 207, 6, 138, 3, 105, 3, 17, 254, 206, 253, 24, 251, 122, 249, 211, 251, 111, 253, 64, 4, 73, 2, 160, 8, 13, 2, 84, 3, 107, 254, 251, 249, 133, 0, 165, 250, 224, 5, 124, 3, 89, 1, 103, 1, 161, 0, 188, 2, 196, 254, 111, 2, 88, 254, 226, 255, 40, 0, 37, 254, 251, 0, 210, 253, 109, 5, 255, 4, 105, 253, 183, 255, 14, 3, 61, 4, 248, 232, 63, 230, 164, 166, 119, 162, 200, 191, 192, 191, 227, 21, 63, 25, 218, 88, 134, 90, 235, 99, 201, 99, 164, 15, 61, 16, 46, 192, 0, 193, 38, 178, 150, 176, 181, 229, 172, 225, 83, 57, 6, 54, 179, 52, 199, 52, 51, 3, 40, 7, 66, 251, 20, 1, 245, 251, 214, 255, 208, 0, 87, 255, 247, 4, 245, 254, 11, 4, 255, 255, 87, 3, 229, 4, 167, 251, 176, 255, 101, 248, 213, 250, 172, 253, 175, 253, 39, 4, 222, 2, 84, 8, 35, 6, 182, 4, 252, 2, 46, 252, 7, 254, 64, 255, 25, 4, 66, 244, 86, 244, 87, 220, 61, 215, 232, 247, 115, 246, 72, 27, 145, 28, 240, 13, 192, 13, 159, 0, 174, 255, 72, 2, 240, 1, 174, 254, 62, 0, 205, 248, 155, 250, 135, 250, 223, 251, 89, 4, 172, 5, 219, 9, 90, 9, 173, 5, 191, 2, 187, 0, 247, 253, 58, 255, 104, 0, 163, 254, 215, 2, 87, 1, 163, 2, 17, 5, 144, 3, 11, 3, 60, 4, 125, 253, 227, 254, 4, 254, 167, 252, 87, 1, 34, 0, 77, 1, 72, 0, 7, 0, 98, 255, 60, 254, 153, 254, 30, 1, 119, 1, 125, 2, 68, 2, 101, 1, 111, 0, 46, 2, 232, 1, 215, 254, 124, 0, 122, 253, 186, 255, 93, 252, 56, 252, 116, 251, 104, 248, 158, 0, 98, 253, 80, 4, 95, 3, 166, 1, 193, 2, 122, 253, 204, 255, 6, 254, 90, 2, 96, 0, 64, 3, 51, 4, 212, 1, 155, 5, 23, 1, 43, 3, 41, 1, 32, 255, 178, 255, 144, 250, 30, 251, 239, 255, 8, 1, 204, 1, 92, 3, 44, 255, 48, 0, 189, 3, 39, 5, 189, 3, 146, 3, 42, 1, 20, 255, 22, 251, 234, 250, 137, 247, 89, 248, 56, 255, 97, 252, 97, 24, 39, 21, 164, 54, 165, 57, 136, 25, 131, 29, 208, 233, 91, 232, 225, 246, 165, 244, 241, 4, 37, 4, 32, 255, 87, 253, 138, 2, 73, 1, 13, 254, 77, 255, 132, 251, 154, 254, 47, 255, 39, 2, 193, 255, 180, 0, 60, 2, 163, 255, 53, 0, 167, 252, 175, 250, 194, 250, 56, 251, 246, 252, 192, 251, 244, 252, 107, 254, 197, 0, 205, 251, 135, 254, 45, 241, 84, 240, 22, 29, 214, 24, 143, 77, 194, 74, 102, 33, 57, 32, 124, 217, 232, 217, 103, 177, 91, 181, 103, 218, 29, 223, 201, 47, 163, 46, 157, 63, 174, 56, 111, 19, 200, 16, 195, 192, 129, 195, 38, 170, 43, 173, 102, 234, 115, 236, 33, 1, 163, 0, 80, 255, 111, 253, 55, 1, 117, 254, 83, 253, 254, 251, 132, 254, 39, 1, 233, 255, 243, 2, 84, 4, 209, 4, 81, 253, 196, 251, 96, 254, 202, 252, 106, 1, 194, 0, 94, 252, 164, 253, 82, 0, 175, 1, 24, 255, 167, 254, 163, 1, 11, 2, 202, 3, 119, 5, 19, 1, 31, 2, 23, 3, 114, 1, 103, 1, 133, 255, 50, 0, 251, 255, 84, 1, 2, 0, 26, 1, 137, 0, 99, 0, 229, 0, 244, 255, 47, 255, 121, 254, 2, 254, 122, 255, 38, 1, 222, 255, 62, 2, 81, 254, 11, 255, 1, 0, 111, 254, 118, 0, 137, 252, 200, 254, 31, 251, 152, 250, 217, 250, 189, 254, 70, 3, 58, 3, 171, 7, 2, 255, 105, 255, 142, 254, 251, 252, 138, 250, 152, 249, 158, 254, 149, 254, 247, 7, 95, 7, 65, 6, 168, 4, 51, 2, 188, 1, 15, 252, 250, 253, 135, 252, 145, 254, 179, 2, 86, 2, 47, 2, 21, 2, 114, 254, 176, 255, 21, 255, 94, 255, 246, 0, 74, 255, 94, 0, 104, 253, 0, 0, 183, 253, 122, 254, 144, 253, 51, 253, 226, 254, 132, 254, 100, 2, 181, 1, 194, 4, 8, 0, 29, 0, 87, 2, 45, 0, 38, 5, 237, 2, 47, 1, 224, 254, 182, 254, 232, 253, 109, 2, 175, 4, 178, 50, 203, 54, 175, 58, 194, 59, 89, 223, 96, 219, 47, 172, 194, 170, 100, 191, 232, 193, 196, 6, 190, 8, 224, 75, 100, 76, 129, 51, 90, 50, 246, 242, 86, 241, 153, 187, 78, 186, 250, 204, 107, 205, 136, 18, 12, 20, 122, 21, 188, 21, 113, 0, 206, 0, 154, 0, 54, 1, 205, 255, 133, 254, 192, 1, 200, 255, 160, 5, 115, 5, 120, 4, 164, 4, 24, 254, 135, 254, 126, 255, 165, 0, 104, 1, 87, 0, 110, 1, 2, 255, 194, 1, 161, 1, 132, 0, 118, 2, 140, 0, 40, 0, 6, 0, 153, 253, 247, 2, 164, 4, 113, 219, 46, 223, 13, 167, 234, 167, 81, 208, 150, 208, 116, 42, 251, 42, 152, 96, 70, 96, 205, 75, 223, 73, 60, 0, 223, 252, 218, 221, 24, 222, 183, 233, 181, 236, 172, 251, 47, 251, 101, 5, 134, 3, 104, 2, 239, 3, 4, 4, 94, 7, 216, 255, 9, 0, 245, 250, 183, 248, 2, 255, 250, 253, 254, 2, 67, 2, 219, 4, 251, 3, 205, 255, 97, 0, 20, 254, 86, 255, 222, 255, 79, 0, 46, 1, 182, 1, 151, 254, 246, 253, 159, 250, 117, 249, 171, 1, 0, 3, 89, 6, 131, 6, 175, 3, 102, 1, 88, 0, 92, 255, 245, 254, 37, 1, 23, 254, 243, 1, 234, 254, 212, 0, 17, 2, 138, 1, 89, 1, 166, 254, 232, 3, 125, 0, 73, 2, 215, 1, 139, 254, 164, 1, 34, 0, 8, 3, 138, 1, 226, 1, 193, 5, 242, 3, 82, 2, 164, 254, 121, 254, 32, 253, 44, 254, 93, 0, 116, 251, 73, 253, 54, 252, 233, 252, 194, 254, 91, 254, 34, 3, 14, 2, 80, 0, 73, 254, 224, 253, 48, 252, 66, 2, 226, 3, 121, 3, 230, 6, 36, 0, 23, 2, 58, 251, 240, 251, 243, 253, 225, 253, 85, 2, 182, 255, 35, 6, 216, 3, 81, 3, 58, 3, 25, 253, 109, 254, 142, 1, 219, 4, 155, 1, 17, 3, 77, 1, 116, 0, 238, 2, 108, 1, 30, 1, 199, 254, 18, 0, 148, 254, 59, 253, 228, 252, 172, 254, 0, 0, 86, 2, 234, 2, 213, 3, 153, 1, 109, 2, 75, 1, 170, 253, 118, 255, 5, 249, 188, 250, 94, 0, 45, 0, 242, 241, 247, 239, 135, 210, 172, 206, 64, 5, 116, 3, 105, 66, 125, 67, 101, 44, 145, 44, 252, 240, 155, 241, 36, 173, 164, 175, 90, 182, 46, 186, 177, 7, 69, 9, 31, 86, 102, 83, 205, 113, 165, 110, 157, 27, 92, 24, 61, 220, 183, 217, 216, 246, 99, 246, 191, 254, 82, 255, 206, 255, 187, 3, 29, 0, 193, 4, 126, 250, 154, 250, 184, 254, 181, 252, 208, 2, 180, 0, 59, 4, 147, 0, 8, 253, 215, 249, 116, 253, 236, 253, 2, 254, 66, 1, 226, 253, 143, 1, 205, 2, 9, 5, 220, 253, 11, 253, 248, 255, 65, 251, 3, 0, 123, 250, 86, 253, 216, 252, 146, 255, 111, 2, 35, 252, 125, 255, 214, 255, 119, 4, 195, 0, 224, 2, 93, 252, 9, 251, 134, 253, 8, 251, 157, 254, 185, 252, 252, 253, 220, 254, 152, 253, 207, 254, 223, 252, 78, 253, 157, 251, 92, 252, 147, 255, 154, 255, 27, 1, 228, 0, 63, 2, 26, 3, 14, 3, 169, 4, 142, 254, 160, 255, 20, 253, 0, 252, 235, 250, 105, 247, 123, 1, 3, 255, 116, 4, 237, 4, 227, 251, 179, 254, 56, 252, 80, 0, 99, 252, 162, 253, 115, 254, 88, 253, 223, 0, 171, 0, 104, 253, 2, 252, 147, 0, 147, 253, 1, 5, 105, 3, 113, 0, 163, 1, 23, 250, 26, 254, 136, 249, 13, 254, 184, 254, 181, 0, 252, 5, 41, 5, 175, 2, 246, 254, 149, 253, 35, 250, 242, 253, 76, 254, 64, 254, 74, 0, 4, 254, 27, 1, 224, 250, 147, 253, 130, 255, 249, 254, 115, 3, 169, 1, 24, 2, 250, 1, 219, 251, 252, 251, 147, 4, 105, 2, 71, 28, 105, 25, 211, 10, 5, 10, 58, 224, 31, 226, 130, 194, 42, 196, 132, 236, 4, 237, 20, 61, 27, 60, 197, 61, 85, 57, 211, 7, 219, 4, 84, 182, 182, 182, 60, 172, 133, 175, 28, 247, 47, 252, 218, 5, 112, 5, 133, 1, 136, 253, 33, 1, 44, 255, 51, 253, 149, 252, 173, 5, 139, 4, 167, 2, 254, 1, 18, 4, 50, 6, 125, 254, 42, 1, 196, 252, 100, 254, 75, 1, 60, 2, 80, 3, 99, 2, 18, 2, 107, 253, 28, 0, 129, 252, 48, 1, 145, 3, 13, 11, 102, 14, 17, 66, 79, 68, 251, 52, 183, 52, 6, 213, 65, 210, 204, 173, 137, 172, 31, 198, 115, 196, 168, 25, 190, 23, 115, 79, 156, 78, 186, 44, 117, 44, 196, 232, 179, 233, 94, 182, 8, 184, 106, 221, 102, 224, 175, 17, 46, 21, 104, 14, 136, 14, 165, 7, 19, 3, 252, 3, 106, 254, 32, 2, 198, 254, 140, 255, 230, 0, 158, 251, 34, 1, 198, 252, 216, 1, 17, 1, 153, 4, 116, 4, 134, 4, 196, 4, 47, 1, 50, 3, 177, 255, 104, 0, 109, 253, 54, 0, 206, 254, 98, 0, 110, 1, 146, 3, 174, 5, 78, 4, 137, 6, 210, 0, 86, 1, 126, 1, 73, 0, 170, 2, 161, 2, 44, 4, 218, 3, 194, 5, 211, 3, 253, 6, 60, 6, 167, 4, 81, 3, 183, 1, 56, 255, 146, 0, 53, 0, 63, 252, 129, 255, 237, 249, 249, 255, 158, 252, 43, 0, 121, 4, 206, 3, 96, 8, 82, 6, 62, 5, 113, 1, 156, 255, 1, 252, 136, 250, 84, 251, 182, 252, 3, 1, 149, 254, 20, 3, 113, 0, 243, 1, 220, 1, 157, 255, 223, 1, 45, 0, 19, 5, 149, 4, 209, 255, 125, 254, 51, 252, 6, 251, 175, 1, 216, 255, 34, 0, 123, 254, 20, 255, 77, 0, 227, 1, 26, 5, 19, 1, 12, 4, 40, 4, 140, 4, 37, 3, 250, 0, 2, 254, 59, 252, 167, 254, 32, 253, 176, 253, 213, 252, 209, 1, 177, 3, 28, 2, 124, 3, 96, 254, 197, 254, 133, 3, 39, 5, 32, 0, 251, 0, 71, 255, 97, 254, 228, 255, 137, 253, 211, 2, 154, 1, 185, 9, 83, 11, 54, 213, 116, 214, 4, 161, 134, 161, 27, 212, 154, 213, 27, 47, 82, 47, 72, 108, 192, 105, 45, 84, 110, 81, 166, 237, 70, 236, 99, 178, 240, 178, 194, 189, 52, 190, 48, 1, 129, 0, 37, 67, 42, 68, 32, 38, 186, 38, 222, 253, 177, 253, 107, 2, 51, 2, 58, 4, 126, 0, 143, 5, 193, 1, 17, 255, 3, 0, 198, 249, 62, 254, 29, 254, 85, 2, 145, 255, 220, 255, 222, 0, 81, 253, 123, 254, 135, 249, 133, 253, 94, 250, 195, 254, 156, 0, 58, 252, 162, 1, 207, 254, 244, 2, 125, 2, 177, 3, 17, 244, 46, 242, 237, 239, 173, 236, 27, 8, 91, 7, 121, 13, 86, 14, 149, 1, 240, 2, 176, 254, 127, 0, 251, 251, 181, 251, 222, 250, 185, 249, 163, 252, 104, 253, 181, 254, 94, 1, 249, 3, 76, 6, 95, 7, 250, 5, 251, 3, 10, 1, 73, 255, 212, 253, 158, 251, 100, 249, 190, 253, 61, 252, 139, 2, 134, 4, 82, 2, 53, 6, 181, 2, 2, 6, 45, 255, 51, 255, 178, 253, 3, 251, 52, 2, 166, 255, 135, 2, 5, 1, 26, 0, 198, 0, 248, 253, 198, 1, 106, 0, 93, 4, 109, 1, 213, 1, 191, 0, 119, 254, 3, 1, 33, 255, 200, 0, 231, 1, 21, 1, 122, 3, 184, 254, 93, 255, 18, 1, 95, 0, 119, 255, 29, 253, 159, 254, 66, 253, 96, 4, 87, 6, 17, 254, 156, 0, 36, 250, 196, 251, 222, 255, 164, 254, 54, 7, 61, 2, 22, 9, 64, 4, 162, 2, 209, 1, 153, 254, 157, 1, 179, 255, 105, 3, 213, 2, 119, 4, 19, 255, 114, 254, 30, 255, 13, 253, 108, 1, 157, 253, 49, 2, 131, 255, 134, 1, 235, 2, 96, 235, 61, 239, 58, 231, 138, 235, 195, 8, 203, 10, 72, 62, 198, 61, 96, 83, 139, 81, 232, 13, 151, 9, 147, 226, 125, 223, 17, 251, 173, 252, 183, 252, 52, 255, 112, 252, 34, 253, 30, 1, 113, 0, 151, 255, 81, 255, 77, 1, 149, 2, 210, 253, 11, 254, 31, 254, 63, 252, 133, 0, 4, 253, 35, 3, 140, 254, 215, 4, 13, 3, 170, 0, 88, 3, 210, 250, 152, 255, 138, 252, 186, 0, 244, 244, 54, 245, 70, 247, 6, 243, 23, 49, 166, 44, 75, 66, 115, 64, 40, 4, 110, 5, 233, 199, 108, 204, 141, 182, 12, 187, 139, 249, 25, 251, 156, 59, 222, 57, 53, 51, 202, 48, 141, 252, 8, 252, 230, 173, 112, 173, 140, 182, 9, 183, 128, 245, 176, 247, 14, 255, 146, 0, 123, 0, 200, 1, 223, 1, 86, 2, 59, 1, 132, 255, 183, 3, 72, 1, 191, 253, 222, 252, 237, 248, 47, 250, 173, 247, 87, 249, 122, 0, 243, 0, 124, 3, 22, 4, 137, 0, 74, 2, 210, 0, 7, 1, 200, 254, 112, 253, 127, 1, 167, 0, 212, 1, 135, 1, 132, 1, 239, 1, 150, 0, 50, 1, 206, 252, 4, 254, 55, 253, 89, 254, 211, 251, 160, 250, 148, 254, 152, 252, 58, 3, 15, 2, 88, 1, 100, 0, 120, 0, 163, 0, 104, 0, 218, 1, 246, 255, 1, 1, 228, 254, 73, 255, 182, 254, 215, 254, 237, 0, 71, 1, 134, 0, 235, 0, 101, 2, 154, 1, 168, 2, 77, 1, 18, 255, 123, 253, 25, 3, 202, 1, 65, 3, 143, 4, 17, 254, 121, 1, 50, 252, 224, 254, 231, 250, 88, 251, 201, 253, 211, 251, 252, 254, 47, 252, 230, 0, 110, 254, 188, 4, 96, 2, 52, 3, 115, 3, 145, 255, 43, 3, 115, 251, 175, 254, 179, 253, 220, 254, 43, 3, 78, 2, 141, 3, 172, 1, 63, 255, 73, 253, 70, 252, 144, 250, 41, 2, 73, 2, 253, 7, 80, 9, 119, 3, 45, 4, 211, 251, 34, 253, 157, 250, 58, 253, 101, 250, 125, 252, 81, 1, 236, 1, 3, 3, 113, 1, 64, 17, 243, 13, 81, 68, 158, 65, 149, 36, 134, 35, 101, 194, 11, 196, 152, 170, 240, 173, 58, 210, 156, 212, 214, 36, 175, 37, 229, 78, 146, 77, 126, 31, 104, 28, 181, 221, 188, 218, 36, 181, 175, 179, 242, 228, 172, 229, 5, 30, 140, 32, 91, 10, 147, 12, 156, 253, 141, 254, 110, 1, 183, 1, 215, 254, 197, 253, 56, 1, 220, 255, 64, 2, 221, 1, 72, 253, 41, 254, 204, 252, 84, 254, 27, 1, 233, 0, 99, 1, 56, 0, 124, 5, 164, 4, 93, 1, 95, 1, 188, 254, 44, 255, 178, 253, 109, 252, 15, 0, 47, 254, 199, 2, 46, 2, 83, 202, 143, 202, 175, 168, 204, 168, 185, 233, 72, 234, 184, 52, 187, 52, 232, 77, 244, 75, 109, 38, 23, 37, 27, 244, 91, 244, 92, 241, 7, 242, 225, 254, 18, 255, 122, 1, 255, 1, 223, 1, 144, 3, 82, 3, 10, 4, 150, 2, 120, 2, 55, 4, 1, 4, 81, 255, 48, 255, 232, 252, 205, 253, 142, 1, 222, 2, 140, 0, 3, 2, 27, 1, 125, 2, 115, 254, 179, 254, 200, 0, 52, 255, 65, 3, 145, 1, 150, 2, 123, 2, 252, 5, 114, 6, 110, 0, 40, 1, 165, 1, 157, 2, 93, 0, 36, 1, 0, 254, 19, 254, 59, 4, 137, 3, 159, 255, 236, 254, 88, 255, 61, 254, 173, 254, 84, 253, 145, 254, 31, 254, 245, 2, 142, 3, 237, 255, 100, 1, 92, 0, 32, 2, 139, 254, 229, 254, 143, 254, 226, 252, 137, 1, 71, 255, 212, 255, 142, 254, 137, 1, 225, 1, 111, 3, 127, 4, 7, 1, 93, 2, 113, 254, 239, 255, 42, 0, 105, 0, 177, 1, 209, 0, 206, 1, 220, 0, 245, 0, 26, 0, 203, 2, 160, 2, 43, 3, 211, 3, 228, 254, 125, 255, 72, 2, 251, 2, 112, 254, 24, 255, 131, 0, 86, 0, 122, 14, 220, 13, 161, 5, 156, 4, 52, 252, 234, 251, 223, 255, 5, 1, 60, 0, 228, 0, 28, 254, 235, 253, 31, 255, 131, 254, 144, 4, 28, 4, 135, 2, 50, 3, 76, 253, 87, 254, 49, 254, 25, 255, 3, 1, 237, 0, 192, 0, 212, 254, 68, 2, 164, 0, 240, 1, 87, 2, 194, 254, 217, 255, 29, 254, 203, 254, 60, 223, 43, 223, 76, 217, 0, 216, 211, 34, 143, 33, 225, 70, 233, 70, 146, 27, 62, 28, 47, 211, 126, 211, 112, 162, 68, 162, 128, 206, 22, 207, 151, 37, 174, 38, 105, 103, 229, 103, 71, 92, 189, 92, 105, 252, 94, 252, 24, 223, 125, 222, 7, 254, 251, 253, 150, 251, 0, 252, 235, 250, 239, 251, 35, 251, 32, 252, 187, 255, 100, 255, 134, 5, 181, 4, 140, 253, 2, 254, 233, 253, 87, 255, 206, 251, 121, 252, 148, 249, 230, 248, 113, 254, 253, 252, 243, 1, 18, 1, 149, 0, 207, 0, 107, 253, 4, 254, 161, 254, 216, 254, 35, 253, 175, 252, 6, 255, 90, 255, 180, 1, 254, 2, 66, 0, 28, 1, 244, 254, 59, 255, 180, 253, 251, 252, 40, 255, 194, 253, 227, 253, 80, 253, 133, 252, 116, 253, 113, 251, 68, 253, 170, 252, 237, 253, 219, 255, 125, 255, 159, 254, 245, 252, 0, 255, 142, 253, 15, 0, 100, 255, 30, 1, 255, 0, 85, 0, 61, 0, 230, 253, 136, 253, 55, 250, 248, 249, 153, 251, 37, 251, 41, 3, 232, 2, 127, 0, 98, 0, 170, 252, 152, 251, 40, 251, 1, 250, 198, 252, 158, 252, 88, 3, 249, 3, 6, 3, 177, 3, 212, 255, 192, 255, 39, 254, 158, 253, 249, 0, 250, 0, 105, 1, 23, 2, 170, 255, 158, 0, 7, 254, 79, 254, 215, 254, 168, 253, 26, 3, 6, 2, 76, 252, 113, 252, 242, 251, 57, 253, 180, 0, 250, 2, 229, 2, 27, 4, 79, 5, 156, 4, 68, 253, 44, 252, 162, 251, 88, 251, 43, 255, 21, 0, 76, 252, 138, 253, 231, 254, 194, 255, 137, 29, 87, 30, 201, 43, 125, 44, 17, 251, 179, 251, 40, 193, 195, 193, 55, 189, 201, 188, 220, 8, 174, 7, 255, 65, 48, 65, 225, 45, 128, 45, 13, 238, 254, 238, 184, 164, 62, 166, 211, 198, 106, 198, 170, 7, 118, 5, 0, 1, 154, 254, 229, 254, 145, 253, 47, 2, 222, 1, 60, 6, 209, 5, 149, 255, 67, 255, 228, 249, 212, 249, 148, 2, 67, 2, 0, 3, 195, 2, 223, 4, 173, 4, 226, 254, 116, 254, 140, 0, 27, 0, 35, 2, 243, 1, 213, 0, 33, 2, 183, 253, 116, 0, 183, 21, 80, 23, 250, 76, 153, 76, 14, 24, 206, 22, 44, 186, 228, 184, 121, 176, 88, 176, 248, 222, 22, 224, 96, 52, 131, 53, 194, 76, 113, 77, 213, 21, 203, 21, 120, 218, 12, 218, 27, 207, 169, 206, 153, 250, 136, 249, 120, 12, 97, 11, 168, 3, 8, 3, 97, 2, 88, 2, 152, 1, 232, 2, 57, 254, 216, 255, 236, 252, 99, 253, 68, 1, 161, 0, 33, 3, 169, 1, 128, 7, 43, 6, 53, 4, 107, 4, 247, 254, 160, 0, 254, 255, 21, 2, 209, 255, 5, 1, 72, 2, 251, 1, 203, 255, 42, 255, 105, 1, 158, 0, 189, 3, 145, 2, 198, 2, 31, 2, 84, 3, 61, 3, 193, 254, 146, 255, 215, 254, 63, 0, 10, 255, 98, 255, 60, 0, 41, 255, 113, 4, 25, 2, 8, 5, 109, 2, 141, 4, 162, 3, 93, 255, 240, 255, 58, 254, 27, 255, 65, 0, 228, 0, 145, 254, 65, 254, 12, 255, 71, 254, 171, 1, 20, 1, 20, 4, 111, 3, 33, 1, 241, 0, 104, 254, 111, 254, 137, 1, 166, 1, 135, 1, 143, 2, 210, 255, 44, 1, 167, 255, 168, 0, 35, 0, 82, 0, 29, 2, 248, 0, 188, 255, 201, 254, 5, 0, 111, 0, 95, 1, 139, 2, 7, 253, 109, 254, 65, 255, 201, 255, 60, 1, 176, 0, 34, 2, 197, 1, 199, 255, 202, 255, 64, 251, 178, 251, 76, 2, 204, 2, 0, 2, 221, 1, 228, 255, 21, 0, 126, 255, 42, 0, 102, 253, 14, 254, 189, 0, 125, 1, 243, 251, 252, 251, 166, 0, 45, 0, 151, 2, 231, 2, 237, 4, 225, 5, 101, 255, 128, 0, 148, 187, 22, 188, 72, 167, 130, 166, 10, 248, 57, 247, 89, 75, 73, 75, 178, 113, 37, 114, 173, 51, 80, 52, 8, 206, 126, 205, 211, 171, 84, 170, 16, 202, 234, 200, 143, 32, 216, 31, 43, 72, 47, 72, 35, 22, 77, 22, 253, 252, 100, 252, 131, 1, 183, 0, 114, 0, 197, 255, 168, 0, 105, 0, 48, 254, 111, 254, 45, 1, 187, 0, 120, 2, 164, 1, 191, 3, 193, 3, 141, 5, 52, 6, 213, 255, 251, 0, 158, 251, 99, 252, 44, 250, 149, 249, 108, 253, 112, 252, 111, 4, 214, 3, 203, 0, 49, 1, 39, 243, 153, 244, 219, 247, 213, 248, 234, 2, 72, 3, 242, 251, 53, 252, 3, 255, 0, 255, 249, 4, 62, 5, 181, 1, 231, 1, 167, 1, 105, 1, 86, 252, 198, 252, 20, 251, 80, 252, 46, 2, 228, 3, 94, 5, 7, 7, 242, 255, 27, 0, 67, 252, 8, 251, 109, 2, 234, 0, 14, 3, 62, 2, 157, 252, 115, 253, 93, 253, 164, 254, 205, 3, 10, 4, 197, 2, 29, 2, 82, 254, 170, 252, 104, 253, 124, 251, 55, 0, 196, 254, 130, 5, 248, 3, 214, 0, 193, 255, 164, 251, 106, 251, 211, 253, 18, 254, 65, 255, 250, 255, 66, 0, 56, 0, 114, 1, 9, 0, 45, 3, 120, 1, 235, 1, 191, 0, 110, 4, 3, 5, 24, 5, 91, 7, 157, 254, 156, 0, 138, 253, 136, 254, 78, 254, 13, 254, 231, 1, 194, 0, 205, 3, 27, 3, 60, 0, 211, 255, 25, 254, 205, 253, 97, 254, 150, 254, 155, 3, 215, 3, 23, 5, 132, 5, 76, 255, 114, 255, 76, 252, 245, 250, 1, 254, 194, 251, 218, 3, 148, 1, 129, 10, 85, 9, 172, 240, 156, 241, 131, 204, 52, 206, 199, 227, 227, 228, 100, 41, 122, 41, 49, 109, 8, 108, 239, 82, 252, 81, 123, 242, 133, 242, 131, 229, 1, 230, 144, 250, 148, 251, 62, 249, 54, 250, 199, 0, 139, 1, 186, 252, 172, 253, 83, 254, 104, 254, 34, 1, 28, 0, 38, 0, 159, 254, 38, 1, 154, 255, 27, 254, 237, 253, 34, 254, 49, 255, 173, 253, 136, 254, 5, 0, 25, 0, 230, 0, 163, 255, 51, 2, 116, 0, 123, 243, 209, 242, 177, 1, 220, 1, 232, 65, 173, 66, 29, 54, 17, 55, 226, 236, 98, 237, 237, 184, 193, 185, 130, 193, 131, 194, 67, 20, 190, 20, 138, 64, 183, 64, 33, 42, 204, 41, 234, 225, 229, 225, 255, 156, 47, 158, 105, 200, 211, 201, 246, 255, 241, 0, 226, 253, 213, 253, 84, 1, 28, 0, 215, 1, 7, 1, 151, 0, 149, 0, 211, 0, 48, 1, 124, 252, 0, 253, 60, 254, 253, 253, 115, 0, 243, 255, 151, 255, 188, 255, 84, 253, 166, 253, 144, 254, 2, 255, 98, 1, 117, 1, 33, 2, 157, 1, 121, 0, 151, 0, 228, 251, 162, 252, 164, 252, 130, 253, 144, 0, 69, 1, 65, 3, 243, 2, 87, 4, 204, 3, 171, 255, 212, 255, 236, 251, 99, 252, 171, 253, 79, 254, 173, 0, 169, 0, 232, 1, 251, 0, 40, 0, 170, 255, 243, 253, 26, 254, 114, 253, 28, 254, 28, 253, 229, 253, 89, 253, 30, 253, 105, 255, 196, 254, 182, 0, 125, 0, 147, 2, 174, 2, 148, 3, 62, 4, 214, 1, 58, 2, 200, 0, 142, 0, 88, 255, 122, 255, 48, 1, 143, 1, 134, 1, 3, 2, 40, 255, 101, 255, 14, 3, 37, 2, 202, 2, 177, 1, 233, 0, 142, 0, 218, 255, 58, 0, 27, 252, 46, 253, 254, 254, 96, 255, 30, 0, 63, 255, 25, 1, 254, 255, 15, 255, 23, 254, 17, 249, 226, 248, 77, 255, 197, 255, 173, 1, 178, 1, 174, 255, 163, 255, 24, 0, 48, 0, 192, 2, 207, 2, 65, 7, 119, 7, 152, 2, 2, 2, 125, 0, 41, 255, 234, 251, 16, 251, 237, 30, 203, 30, 149, 74, 121, 75, 7, 4, 21, 5, 239, 178, 159, 178, 9, 179, 202, 177, 40, 231, 158, 229, 155, 60, 134, 59, 22, 70, 61, 70, 75, 9, 162, 9, 61, 199, 73, 199, 83, 179, 96, 179, 18, 252, 226, 251, 41, 34, 62, 34, 53, 10, 54, 10, 165, 1, 205, 0, 240, 253, 29, 253, 3, 255, 178, 254, 196, 0, 93, 1, 238, 1, 129, 3, 189, 1, 161, 2, 50, 2, 213, 1, 244, 2, 221, 1, 214, 0, 133, 255, 50, 0, 242, 255, 218, 252, 112, 253, 200, 0, 26, 1, 198, 253, 226, 253, 154, 3, 59, 3, 129, 244, 8, 244, 197, 180, 175, 180, 140, 191, 229, 190, 77, 8, 45, 7, 82, 44, 77, 43, 205, 39, 43, 39, 65, 8, 219, 8, 39, 254, 44, 255, 84, 5, 123, 5, 0, 3, 104, 2, 148, 2, 93, 1, 84, 3, 160, 2, 253, 2, 166, 3, 175, 1, 183, 2, 137, 2, 148, 3, 64, 0, 17, 1, 156, 254, 30, 255, 186, 255, 224, 0, 150, 0, 232, 1, 250, 1, 199, 2, 29, 2, 179, 2, 148, 3, 234, 3, 210, 0, 210, 1, 168, 1, 174, 3, 226, 1, 155, 3, 190, 0, 177, 1, 168, 3, 140, 3, 143, 254, 183, 253, 114, 1, 79, 1, 157, 3, 246, 3, 161, 253, 222, 253, 102, 254, 109, 254, 246, 255, 73, 255, 152, 2, 12, 2, 18, 0, 25, 0, 92, 254, 21, 254, 177, 255, 23, 255, 190, 254, 164, 253, 52, 3, 18, 2, 191, 4, 231, 4, 63, 1, 46, 2, 168, 0, 145, 1, 192, 1, 39, 2, 193, 0, 12, 0, 3, 2, 82, 1, 118, 1, 132, 1, 212, 0, 27, 1, 105, 1, 226, 1, 98, 253, 94, 253, 189, 2, 74, 2, 248, 2, 14, 3, 90, 1, 108, 1, 169, 255, 82, 255, 68, 247, 82, 246, 6, 19, 57, 17, 72, 35, 9, 34, 95, 8, 79, 8, 196, 252, 55, 253, 203, 254, 87, 255, 46, 1, 186, 0, 170, 0, 97, 255, 88, 255, 142, 254, 244, 255, 176, 255, 214, 255, 50, 0, 194, 2, 90, 3, 44, 2, 57, 2, 53, 1, 131, 1, 242, 252, 160, 253, 115, 251, 240, 251, 11, 253, 68, 253, 68, 1, 124, 0, 84, 252, 38, 251, 229, 213, 169, 213, 169, 234, 45, 235, 212, 55, 213, 56, 85, 59, 215, 59, 229, 7, 249, 6, 115, 192, 54, 191, 20, 163, 57, 162, 99, 231, 42, 231, 109, 60, 2, 61, 138, 112, 213, 112, 109, 67, 119, 67, 112, 228, 228, 228, 148, 231, 26, 232, 110, 3, 38, 4, 184, 255, 12, 0, 204, 1, 73, 1, 77, 252, 48, 252, 230, 253, 148, 254, 245, 250, 84, 252, 36, 245, 204, 246, 102, 254, 217, 254, 200, 0, 51, 0, 189, 250, 38, 250, 42, 248, 235, 247, 247, 252, 170, 253, 138, 1, 106, 2, 175, 3, 213, 3, 58, 255, 75, 255, 32, 248, 48, 248, 148, 252, 233, 252, 231, 0, 147, 1, 78, 255, 69, 255, 143, 252, 60, 252, 29, 255, 59, 255, 251, 1, 146, 2, 231, 253, 64, 255, 242, 251, 238, 252, 249, 252, 197, 252, 141, 255, 0, 255, 36, 254, 161, 253, 233, 253, 28, 254, 56, 255, 25, 0, 61, 252, 104, 252, 79, 254, 203, 253, 143, 255, 198, 254, 131, 253, 194, 252, 192, 252, 204, 252, 207, 3, 214, 3, 66, 7, 161, 6, 63, 252, 135, 251, 127, 249, 192, 248, 158, 252, 126, 252, 192, 254, 51, 255, 96, 255, 52, 255, 10, 252, 131, 251, 104, 253, 230, 252, 1, 0, 225, 255, 143, 1, 119, 2, 61, 0, 14, 1, 116, 254, 111, 254, 144, 255, 39, 255, 161, 1, 14, 1, 66, 2, 151, 2, 236, 255, 46, 1, 252, 253, 220, 254, 223, 253, 62, 254, 207, 1, 147, 1, 55, 0, 208, 255, 166, 250, 15, 251, 77, 253, 208, 253, 31, 1, 87, 1, 167, 250, 210, 250, 248, 10, 239, 10, 183, 59, 60, 60, 31, 46, 235, 46, 194, 228, 172, 228, 133, 183, 194, 182, 5, 210, 201, 208, 1, 37, 43, 36, 137, 67, 14, 68, 129, 29, 70, 30, 108, 209, 143, 209, 85, 162, 134, 161, 0, 221, 36, 219, 118, 8, 249, 6, 124, 1, 202, 0, 86, 1, 215, 0, 167, 253, 104, 253, 202, 254, 63, 254, 28, 254, 130, 253, 243, 255, 218, 255, 186, 0, 60, 0, 100, 4, 92, 3, 111, 5, 34, 4, 246, 0, 187, 255, 44, 3, 95, 3, 9, 2, 103, 3, 195, 4, 254, 5, 206, 254, 82, 255, 1, 39, 37, 38, 100, 70, 35, 69, 218, 240, 166, 240, 71, 175, 229, 175, 198, 186, 12, 188, 178, 251, 236, 252, 168, 67, 38, 68, 140, 50, 15, 51, 182, 254, 16, 255, 135, 221, 93, 221, 130, 229, 43, 229, 43, 6, 131, 5, 30, 8, 29, 8, 124, 1, 204, 2, 42, 253, 175, 254, 216, 251, 217, 252, 111, 255, 25, 255, 66, 1, 170, 255, 184, 2, 179, 1, 221, 2, 7, 3, 129, 2, 179, 3, 29, 2, 219, 3, 202, 3, 187, 4, 134, 0, 226, 0, 178, 0, 15, 1, 171, 255, 209, 255, 155, 250, 249, 250, 98, 1, 182, 1, 106, 3, 187, 3, 83, 255, 160, 0, 84, 252, 26, 254, 7, 253, 130, 254, 224, 1, 112, 2, 227, 255, 197, 254, 239, 255, 105, 254, 16, 4, 112, 3, 184, 4, 6, 5, 243, 0, 12, 2, 107, 255, 233, 255, 225, 2, 15, 2, 82, 1, 27, 0, 159, 255, 73, 254, 253, 3, 23, 3, 91, 5, 8, 5, 180, 0, 59, 0, 103, 252, 101, 252, 209, 251, 124, 252, 32, 0, 235, 0, 133, 2, 78, 3, 82, 0, 44, 0, 157, 254, 183, 253, 106, 254, 51, 254, 204, 0, 135, 1, 67, 254, 253, 255, 59, 252, 7, 254, 124, 253, 215, 253, 148, 255, 240, 254, 65, 5, 76, 4, 27, 3, 90, 2, 62, 1, 79, 1, 236, 255, 219, 255, 115, 0, 231, 255, 123, 3, 244, 2, 213, 253, 31, 253, 206, 255, 68, 255, 168, 255, 255, 254, 141, 0, 35, 255, 138, 2, 90, 1, 196, 251, 89, 251, 33, 0, 156, 0, 80, 255, 155, 0, 159, 6, 54, 7, 109, 241, 253, 240, 187, 171, 29, 171, 96, 185, 13, 185, 10, 19, 229, 19, 117, 91, 247, 92, 7, 104, 230, 104, 236, 16, 69, 17, 165, 184, 114, 184, 241, 174, 164, 174, 98, 228, 141, 228, 239, 56, 190, 56, 144, 59, 15, 59, 95, 4, 11, 4, 251, 252, 200, 252, 202, 0, 49, 1, 72, 2, 136, 2, 234, 4, 28, 4, 149, 0, 103, 255, 115, 1, 102, 0, 199, 251, 180, 251, 30, 252, 85, 253, 86, 1, 95, 2, 24, 2, 97, 2, 246, 255, 144, 255, 202, 251, 0, 251, 130, 255, 142, 255, 237, 255, 155, 0, 210, 254, 104, 255, 66, 253, 221, 253, 254, 254, 65, 255, 55, 3, 136, 3, 175, 255, 76, 0, 28, 4, 18, 4, 123, 0, 250, 255, 209, 248, 74, 248, 83, 254, 48, 254, 69, 0, 99, 1, 127, 1, 242, 2, 57, 0, 213, 0, 188, 253, 110, 253, 193, 253, 142, 252, 196, 255, 243, 254, 10, 2, 103, 2, 80, 255, 2, 0, 49, 255, 217, 255, 164, 1, 173, 1, 173, 2, 244, 1, 94, 254, 206, 253, 118, 252, 194, 251, 196, 254, 183, 253, 193, 1, 188, 0, 83, 8, 69, 7, 234, 1, 163, 1, 210, 251, 90, 252, 174, 255, 202, 255, 231, 255, 77, 255, 248, 1, 132, 0, 234, 1, 91, 0, 27, 0, 248, 255, 251, 253, 250, 254, 162, 253, 16, 255, 232, 0, 29, 2, 7, 255, 57, 255, 112, 253, 113, 253, 132, 0, 228, 0, 178, 3, 32, 4, 208, 3, 134, 4, 16, 1, 162, 1, 31, 254, 166, 254, 145, 253, 177, 254, 135, 0, 117, 1, 21, 3, 78, 3, 225, 254, 61, 254, 215, 253, 82, 252, 91, 11, 107, 10, 208, 20, 9, 21, 85, 254, 14, 255, 221, 199, 149, 200, 63, 185, 229, 184, 68, 247, 9, 246, 167, 72, 196, 71, 89, 111, 232, 110, 181, 47, 232, 47, 177, 226, 54, 227, 187, 239, 231, 239, 61, 1, 180, 1, 103, 254, 35, 255, 105, 0, 234, 0, 53, 255, 121, 255, 169, 2, 42, 2, 76, 2, 175, 1, 94, 0, 182, 0, 185, 252, 174, 253, 89, 249, 138, 250, 35, 248, 165, 248, 11, 254, 47, 253, 36, 1, 10, 0, 253, 253, 71, 253, 115, 253, 82, 253, 170, 240, 32, 241, 143, 22, 141, 22, 219, 73, 106, 73, 143, 32, 69, 32, 30, 221, 200, 220, 150, 184, 117, 184, 197, 220, 112, 220, 27, 45, 69, 44, 152, 63, 62, 63, 75, 20, 146, 20, 33, 192, 215, 192, 248, 164, 189, 165, 183, 233, 111, 233, 190, 6, 207, 5, 7, 251, 99, 250, 96, 0, 64, 0, 247, 254, 174, 255, 19, 254, 189, 254, 247, 254, 198, 254, 248, 252, 132, 252, 237, 1, 97, 1, 120, 0, 51, 0, 211, 252, 239, 252, 122, 255, 26, 255, 169, 0, 28, 0, 66, 3, 2, 3, 245, 0, 242, 0, 170, 251, 30, 252, 93, 252, 115, 252, 129, 254, 202, 253, 255, 0, 84, 0, 169, 1, 92, 1, 143, 1, 19, 2, 164, 255, 190, 0, 80, 252, 198, 252, 124, 253, 100, 253, 61, 255, 254, 254, 250, 1, 233, 1, 198, 4, 128, 5, 124, 3, 68, 4, 44, 3, 118, 3, 171, 1, 217, 1, 46, 254, 55, 254, 224, 255, 65, 0, 16, 2, 175, 2, 233, 1, 224, 1, 229, 0, 131, 0, 57, 254, 212, 253, 158, 252, 134, 252, 74, 252, 243, 252, 31, 0, 149, 0, 26, 1, 211, 0, 42, 1, 138, 0, 168, 5, 227, 4, 230, 255, 214, 255, 5, 253, 158, 253, 250, 1, 64, 2, 220, 2, 210, 2, 93, 1, 251, 0, 230, 253, 135, 253, 246, 255, 63, 0, 160, 254, 220, 254, 201, 255, 165, 255, 52, 5, 232, 4, 38, 1, 179, 0, 111, 255, 142, 255, 101, 253, 229, 253, 23, 2, 22, 2, 158, 2, 54, 2, 186, 254, 245, 253, 68, 1, 185, 0, 79, 0, 175, 0, 203, 45, 80, 46, 156, 57, 217, 57, 5, 224, 235, 223, 16, 171, 157, 170, 21, 191, 55, 191, 70, 7, 248, 7, 19, 73, 168, 73, 48, 51, 168, 51, 241, 245, 7, 246, 93, 186, 136, 186, 250, 199, 205, 200, 222, 20, 163, 21, 26, 31, 141, 31, 9, 3, 12, 3, 172, 253, 67, 253, 63, 0, 91, 0, 7, 0, 140, 0, 71, 254, 146, 254, 148, 2, 136, 2, 193, 4, 8, 4, 79, 3, 137, 2, 57, 0, 21, 0, 2, 1, 250, 0, 229, 0, 199, 0, 196, 254, 64, 254, 186, 255, 197, 254, 240, 254, 119, 254, 111, 5, 101, 5, 73, 235, 61, 235, 219, 197, 171, 197, 127, 228, 182, 227, 37, 15, 93, 14, 28, 19, 236, 18, 155, 9, 143, 9, 137, 2, 127, 2, 44, 0, 182, 255, 214, 253, 231, 252, 191, 0, 64, 0, 213, 2, 183, 2, 137, 3, 129, 3, 209, 3, 175, 3, 112, 2, 180, 1, 31, 2, 112, 1, 140, 255, 128, 255, 177, 3, 247, 3, 60, 4, 184, 4, 152, 254, 178, 254, 58, 254, 217, 253, 53, 255, 55, 255, 28, 3, 133, 3, 254, 2, 178, 3, 210, 1, 145, 2, 129, 3, 168, 3, 254, 2, 19, 3, 55, 2, 162, 2, 10, 0, 143, 0, 59, 0, 217, 0, 17, 1, 47, 1, 172, 1, 72, 1, 101, 3, 79, 3, 56, 4, 109, 4, 224, 2, 84, 3, 30, 255, 113, 255, 33, 255, 170, 254, 115, 255, 203, 254, 43, 255, 211, 254, 119, 1, 118, 1, 223, 2, 74, 3, 209, 1, 234, 1, 5, 255, 166, 254, 33, 254, 226, 253, 242, 254, 212, 254, 141, 0, 190, 0, 153, 1, 213, 1, 173, 4, 96, 4, 195, 5, 117, 5, 27, 3, 19, 3, 252, 1, 52, 2, 5, 251, 126, 251, 4, 243, 247, 242, 147, 231, 248, 230, 34, 246, 165, 245, 111, 41, 56, 41, 203, 43, 39, 44, 47, 7, 177, 7, 75, 252, 57, 252, 84, 253, 7, 253, 252, 0, 177, 0, 187, 0, 180, 0, 35, 253, 155, 253, 35, 255, 107, 255, 1, 2, 8, 2, 116, 0, 150, 0, 88, 1, 143, 1, 79, 3, 226, 3, 115, 252, 252, 252, 128, 251, 115, 251, 78, 253, 32, 253, 237, 3, 220, 3, 161, 244, 245, 244, 0, 211, 200, 211, 165, 4, 2, 5, 150, 68, 96, 68, 172, 47, 52, 47, 217, 240, 89, 240, 92, 170, 108, 170, 19, 179, 99, 179, 186, 5, 184, 5, 95, 83, 51, 83, 206, 113, 110, 113, 119, 32, 54, 32, 227, 214, 246, 214, 229, 240, 183, 240, 40, 2, 202, 1, 102, 253, 25, 253, 161, 254, 129, 254, 27, 255, 138, 255, 222, 1, 85, 2, 196, 0, 175, 0, 170, 255, 64, 255, 172, 251, 18, 251, 40, 249, 250, 248, 198, 252, 68, 253, 113, 254, 228, 254, 111, 254, 156, 254, 79, 255, 22, 255, 82, 255, 204, 254, 124, 253, 71, 253, 41, 254, 20, 254, 11, 254, 214, 253, 202, 252, 156, 252, 216, 253, 147, 253, 210, 255, 210, 255, 162, 2, 233, 2, 91, 2, 71, 2, 53, 254, 200, 253, 17, 249, 105, 248, 214, 252, 85, 252, 79, 3, 155, 3, 54, 255, 232, 255, 113, 252, 255, 252, 88, 253, 139, 253, 56, 254, 222, 253, 61, 252, 245, 251, 128, 250, 167, 250, 201, 0, 18, 1, 16, 1, 122, 1, 218, 250, 29, 251, 30, 251, 54, 251, 248, 254, 65, 255, 104, 255, 132, 255, 133, 254, 71, 254, 140, 252, 15, 252, 103, 251, 188, 250, 144, 2, 96, 2, 124, 3, 223, 3, 186, 254, 29, 255, 59, 255, 89, 255, 123, 253, 252, 252, 152, 254, 204, 253, 142, 0, 56, 0, 65, 2, 95, 2, 40, 4, 163, 4, 214, 255, 106, 0, 239, 0, 52, 1, 145, 2, 219, 2, 152, 252, 244, 252, 130, 250, 185, 250, 76, 250, 124, 250, 57, 0, 57, 0, 148, 254, 172, 254, 137, 246, 34, 247, 63, 35, 242, 35, 209, 72, 78, 73, 9, 23, 248, 22, 189, 207, 253, 206, 68, 177, 145, 176, 119, 232, 46, 232, 101, 59, 114, 59, 216, 67, 24, 68, 115, 14, 82, 14, 38, 184, 168, 183, 191, 170, 71, 170, 78, 240, 211, 239, 227, 8, 145, 8, 132, 3, 67, 3, 255, 1, 171, 1, 152, 255, 156, 255, 73, 255, 148, 255, 140, 253, 219, 253, 214, 253, 255, 253, 227, 251, 135, 251, 1, 2, 124, 1, 42, 4, 9, 4, 155, 1, 223, 1, 18, 0, 177, 0, 202, 1, 68, 2, 65, 3, 50, 3, 191, 7, 134, 7, 30, 56, 232, 55, 160, 49, 156, 49, 240, 207, 49, 208, 142, 164, 176, 164, 138, 202, 166, 202, 97, 21, 160, 21, 37, 57, 98, 57, 168, 21, 238, 21, 236, 244, 240, 244, 30, 243, 206, 242, 86, 2, 46, 2, 143, 5, 172, 5, 110, 1, 213, 1, 17, 3, 137, 3, 197, 255, 190, 255, 146, 0, 42, 0, 211, 254, 96, 254, 203, 0, 125, 0, 210, 2, 234, 2, 118, 252, 156, 252, 30, 0, 10, 0, 243, 2, 212, 2, 82, 255, 34, 255, 84, 0, 66, 0, 72, 3, 88, 3, 250, 2, 222, 2, 255, 4, 236, 4, 177, 5, 208, 5, 214, 254, 37, 255, 150, 254, 29, 255, 55, 255, 131, 255, 250, 254, 221, 254, 53, 2, 254, 1, 181, 253, 142, 253, 49, 252, 101, 252, 142, 0, 254, 0, 183, 2, 224, 2, 190, 1, 154, 1, 212, 255, 111, 255, 2, 5, 138, 4, 63, 6, 7, 6, 1, 254, 212, 253, 29, 250, 227, 249, 147, 252, 104, 252, 115, 255, 70, 255, 26, 1, 21, 1, 96, 3, 101, 3, 97, 2, 37, 2, 234, 254, 158, 254, 160, 255, 110, 255, 47, 2, 74, 2, 153, 4, 38, 5, 123, 2, 1, 3, 47, 254, 103, 254, 102, 254, 85, 254, 216, 255, 148, 255, 42, 2, 30, 2, 143, 0, 201, 0, 79, 1, 138, 1, 15, 4, 64, 4, 106, 252, 105, 252, 43, 253, 9, 253, 6, 3, 238, 2, 19, 1, 211, 0, 175, 254, 80, 254, 115, 252, 29, 252, 205, 2, 147, 2, 252, 4, 30, 5, 225, 1, 45, 2, 143, 253, 163, 253, 138, 250, 95, 250, 81, 5, 234, 4, 59, 219, 240, 218, 67, 164, 104, 164, 93, 216, 191, 216, 137, 52, 254, 52, 206, 106, 35, 107, 103, 79, 124, 79, 17, 233, 38, 233, 173, 175, 196, 175, 16, 186, 26, 186, 135, 254, 158, 254, 234, 69, 0, 70, 20, 42, 78, 42, 144, 0, 251, 0, 81, 2, 154, 2, 192, 254, 202, 254, 229, 0, 168, 0, 106, 2, 11, 2, 238, 1, 218, 1, 119, 1, 178, 1, 93, 249, 182, 249, 39, 250, 115, 250, 78, 253, 78, 253, 133, 254, 96, 254, 122, 2, 102, 2, 223, 2, 213, 2, 42, 255, 62, 255, 229, 252, 1, 253, 196, 253, 223, 253, 109, 254, 176, 254, 119, 0, 187, 0, 77, 1, 110, 1, 53, 3, 42, 3, 146, 4, 81, 4, 121, 1, 76, 1, 141, 2, 168, 2, 89, 255, 152, 255, 238, 248, 52, 249, 210, 250, 220, 250, 208, 254, 146, 254, 54, 0, 246, 255, 24, 254, 229, 253, 197, 255, 172, 255, 178, 2, 173, 2, 39, 2, 10, 2, 70, 5, 44, 5, 95, 3, 84, 3, 202, 254, 178, 254, 170, 255, 137, 255, 106, 254, 38, 254, 21, 254, 192, 253, 206, 0, 170, 0, 54, 4, 60, 4, 221, 3, 255, 3, 126, 253, 149, 253, 212, 251, 176, 251, 91, 253, 38, 253, 165, 0, 133, 0, 240, 4, 236, 4, 155, 254, 188, 254, 72, 250, 94, 250, 35, 1, 34, 1, 123, 3, 129, 3, 93, 0, 102, 0, 252, 254, 16, 255, 178, 250, 194, 250, 18, 251, 2, 251, 158, 3, 148, 3, 80, 3, 94, 3, 238, 255, 15, 0, 214, 254, 6, 255, 177, 1, 190, 1, 30, 2, 9, 2, 134, 246, 119, 246, 86, 7, 85, 7, 85, 37, 114, 37, 18, 29, 50, 29, 123, 230, 119, 230, 212, 166, 194, 166, 65, 188, 46, 188, 41, 17, 36, 17, 61, 93, 76, 93, 225, 106, 221, 106, 110, 16, 85, 16, 19, 217, 251, 216, 200, 243, 179, 243, 110, 252, 111, 252, 53, 254, 54, 254, 124, 1, 100, 1, 202, 253, 178, 253, 89, 253, 73, 253, 110, 0, 115, 0, 213, 255, 239, 255, 41, 253, 47, 253, 190, 2, 175, 2, 69, 1, 53, 1, 235, 254, 229, 254, 163, 253, 191, 253, 160, 0, 198, 0, 254, 250, 14, 251, 9, 246, 13, 246, 183, 45, 174, 45, 177, 69, 176, 69, 215, 7, 233, 7, 133, 200, 142, 200, 42, 180, 44, 180, 56, 244, 58, 244, 123, 59, 127, 59, 103, 52, 125, 52, 49, 250, 66, 250, 238, 189, 232, 189, 25, 209, 10, 209, 131, 255, 117, 255, 202, 254, 213, 254, 209, 254, 248, 254, 143, 255, 175, 255, 222, 252, 238, 252, 65, 0, 62, 0, 250, 254, 239, 254, 21, 252, 28, 252, 49, 249, 65, 249, 103, 253, 114, 253, 221, 0, 230, 0, 82, 254, 83, 254, 115, 254, 121, 254, 145, 255, 157, 255, 28, 3, 23, 3, 45, 3, 28, 3, 49, 0, 25, 0, 31, 2, 13, 2, 160, 1, 169, 1, 250, 253, 13, 254, 35, 253, 45, 253, 227, 255, 223, 255, 132, 0, 111, 0, 54, 252, 40, 252, 87, 251, 91, 251, 144, 255, 152, 255, 100, 4, 111, 4, 156, 2, 161, 2, 197, 252, 198, 252, 143, 251, 153, 251, 240, 249, 245, 249, 70, 253, 66, 253, 252, 3, 240, 3, 184, 4, 164, 4, 218, 3, 211, 3, 70, 255, 78, 255, 255, 254, 6, 255, 39, 3, 39, 3, 224, 254, 206, 254, 211, 249, 186, 249, 106, 253, 93, 253, 120, 5, 116, 5, 33, 6, 34, 6, 8, 0, 9, 0, 12, 250, 7, 250, 196, 248, 196, 248, 83, 0, 89, 0, 216, 6, 219, 6, 150, 2, 150, 2, 164, 251, 156, 251, 66, 0, 57, 0, 103, 3, 108, 3, 230, 0, 240, 0, 56, 1, 66, 1, 101, 253, 103, 253, 69, 255, 57, 255, 59, 0, 47, 0, 144, 3, 138, 3, 148, 2, 145, 2, 153, 6, 153, 6, 212, 53, 207, 53, 114, 34, 108, 34, 49, 199, 49, 199, 128, 175, 130, 175, 76, 212, 79, 212, 233, 32, 232, 32, 69, 76, 62, 76, 196, 31, 195, 31, 218, 223, 226, 223, 192, 180, 205, 180, 0, 222, 16, 222, 214, 33, 222, 33, 179, 22, 181, 22, 188, 0, 192, 0, 83, 2, 89, 2, 225, 1, 234, 1, 179, 0, 187, 0, 15, 2, 18, 2, 74, 3, 79, 3, 224, 255, 231, 255, 2, 255, 8, 255, 156, 0, 160, 0, 32, 0, 27, 0, 152, 251, 145, 251, 121, 252, 118, 252, 146, 254, 147, 254, 212, 1, 218, 1, 231, 1, 234, 1, 224, 230, 221, 230, 251, 227, 246, 227, 186, 254, 181, 254, 47, 1, 44, 1, 16, 2, 15, 2, 28, 5, 26, 5, 84, 3, 83, 3, 199, 4, 199, 4, 252, 2, 254, 2, 110, 255, 113, 255, 122, 251, 121, 251, 83, 0, 78, 0, 47, 5, 43, 5, 250, 2, 249, 2, 174, 2, 177, 2, 173, 0, 177, 0, 189, 255, 191, 255, 180, 2, 179, 2, 19, 5, 16, 5, 232, 2, 229, 2, 104, 255, 104, 255, 83, 253, 83, 253, 41, 254, 40, 254, 232, 2, 232, 2, 58, 5, 58, 5, 155, 3, 156, 3, 83, 254, 84, 254, 221, 254, 219, 254, 108, 3, 105, 3, 209, 2, 206, 2, 208, 3, 207, 3, 203, 0, 204, 0, 73, 253, 74, 253, 14, 1, 14, 1, 250, 2, 249, 2, 214, 255, 213, 255, 74, 255, 73, 255, 48, 2, 48, 2, 109, 0, 110, 0, 193, 0, 193, 0, 125, 2, 125, 2, 112, 2, 112, 2, 146, 1, 147, 1, 108, 253, 108, 253, 224, 252, 224, 252, 220, 0, 219, 0, 194, 7, 194, 7, 41, 3, 42, 3, 140, 3, 140, 3, 96, 11, 96, 11, 210, 242, 210, 242, 160, 215, 159, 215, 250, 213, 249, 213, 62, 8, 62, 8, 41, 69, 41, 69, 73, 38, 73, 38, 48, 252, 48, 252, 66, 1, 66, 1, 13, 3, 13, 3, 109, 2, 109, 2, 245, 252, 245, 252, 24, 251, 24, 251, 22, 254, 22, 254, 209, 0, 209, 0, 241, 2, 241, 2, 220, 2, 220, 2, 244, 1, 244, 1, 176, 252, 176, 252, 128, 254, 128, 254, 22, 254, 22, 254, 48, 1, 48, 1, 19, 237, 19, 237, 161, 220, 161, 220, 222, 32, 222, 32, 100, 71, 100, 71, 243, 28, 243, 28, 47, 216, 47, 216, 142, 157, 142, 157, 72, 198, 72, 198, 19, 30, 19, 30, 213, 99, 213, 99, 71, 96, 71, 96, 175, 252, 175, 252, 226, 220, 226, 220, 166, 254, 166, 254, 189, 0, 189, 0, 186, 249, 186, 249, 205, 246, 205, 246, 157, 0, 157, 0, 21, 4, 21, 4, 4, 0, 4, 0, 176, 254, 176, 254, 54, 250, 54, 250, 203, 255, 203, 255, 62, 2, 62, 2, 48, 255, 48, 255, 191, 253, 191, 253, 72, 252, 72, 252, 63, 253, 63, 253, 88, 254, 88, 254, 31, 255, 31, 255, 23, 251, 23, 251, 49, 253, 49, 253, 83, 2, 83, 2, 19, 1, 19, 1, 38, 1, 38, 1, 88, 251, 88, 251, 213, 248, 213, 248, 111, 253, 111, 253, 143, 255, 143, 255, 175, 2, 175, 2, 80, 1, 80, 1, 132, 0, 132, 0, 206, 254, 206, 254, 159, 248, 159, 248, 241, 252, 241, 252, 157, 1, 157, 1, 236, 255, 236, 255, 135, 254, 135, 254, 173, 249, 173, 249, 167, 250, 167, 250, 167, 1, 167, 1, 173, 3, 173, 3, 166, 1, 166, 1, 56, 0, 56, 0, 149, 255, 149, 255, 209, 252, 209, 252, 146, 253, 146, 253, 64, 254, 64, 254, 11, 252, 11, 252, 91, 255, 91, 255, 193, 3, 193, 3, 213, 4, 213, 4, 10, 2, 10, 2, 84, 255, 84, 255, 67, 254, 67, 254, 59, 255, 59, 255, 221, 253, 221, 253, 199, 248, 199, 248, 185, 255, 185, 255, 54, 3, 54, 3, 219, 0, 219, 0, 38, 249, 38, 249, 106, 253, 106, 253, 139, 55, 139, 55, 158, 67, 158, 67, 251, 252, 251, 252, 154, 192, 154, 192, 238, 183, 238, 183, 31, 3, 31, 3, 54, 69, 54, 69, 235, 53, 235, 53, 177, 243, 177, 243, 141, 163, 141, 163, 129, 188, 129, 188, 43, 2, 43, 2, 57, 3, 57, 3, 139, 255, 139, 255, 148, 1, 148, 1, 99, 1, 99, 1, 193, 0, 193, 0, 57, 252, 57, 252, 255, 1, 255, 1, 16, 6, 16, 6, 146, 1, 146, 1, 86, 251, 86, 251, 98, 255, 98, 255, 152, 5, 152, 5, 198, 8, 198, 8, 101, 253, 101, 253, 96, 7, 96, 7, 98, 59, 98, 59, 50, 25, 50, 25, 244, 194, 244, 194, 24, 190, 24, 190, 164, 231, 164, 231, 96, 20, 96, 20, 122, 27, 122, 27, 232, 6, 232, 6, 107, 1, 107, 1, 121, 253, 121, 253, 253, 255, 253, 255, 162, 1, 162, 1, 0, 2, 0, 2, 58, 3, 58, 3, 176, 255, 176, 255, 128, 2, 128, 2, 133, 2, 133, 2, 147, 255, 147, 255, 3, 254, 3, 254, 178, 255, 178, 255, 51, 1, 51, 1, 39, 255, 39, 255, 149, 0, 149, 0, 34, 255, 34, 255, 19, 0, 19, 0, 8, 1, 8, 1, 232, 253, 232, 253, 209, 253, 209, 253, 14, 254, 14, 254, 29, 3, 29, 3, 12, 6, 12, 6, 237, 1, 237, 1, 181, 252, 181, 252, 100, 255, 100, 255, 100, 10, 100, 10, 8, 9, 8, 9, 162, 255, 162, 255, 196, 250, 196, 250, 131, 252, 131, 252, 168, 1, 168, 1, 38, 0, 38, 0, 37, 0, 37, 0, 69, 1, 69, 1, 149, 255, 149, 255, 236, 2, 236, 2, 36, 4, 36, 4, 162, 255, 162, 255, 142, 252, 142, 252, 16, 254, 16, 254, 96, 5, 96, 5, 13, 7, 13, 7, 103, 255, 103, 255, 6, 252, 6, 252, 45, 247, 45, 247, 74, 251, 74, 251, 102, 12, 102, 12, 125, 8, 125, 8, 87, 0, 87, 0, 27, 5, 27, 5, 56, 2, 56, 2, 249, 255, 249, 255, 95, 0, 95, 0, 236, 254, 236, 254, 40, 1, 40, 1, 43, 254, 43, 254, 218, 250, 218, 250, 215, 255, 215, 255, 4, 255, 4, 255, 194, 0, 194, 0, 73, 5, 73, 5, 113, 4, 113, 4, 216, 252, 216, 252, 42, 195, 42, 195, 211, 163, 211, 163, 10, 242, 10, 242, 98, 72, 98, 72, 6, 110, 6, 110, 103, 61, 103, 61, 134, 211, 134, 211, 83, 171, 83, 171, 43, 196, 43, 196, 46, 20, 46, 20, 183, 70, 183, 70, 160, 25, 160, 25, 175, 3, 175, 3, 60, 5, 60, 5, 208, 250, 208, 250, 145, 254, 145, 254, 104, 254, 104, 254, 36, 1, 36, 1, 235, 0, 235, 0, 155, 253, 155, 253, 105, 1, 105, 1, 47, 3, 47, 3, 182, 2, 182, 2, 203, 252, 203, 252, 190, 249, 190, 249, 205, 253, 205, 253, 100, 3, 100, 3, 76, 1, 76, 1, 237, 251, 237, 251, 199, 254, 199, 254, 41, 255, 41, 255, 248, 255, 248, 255, 78, 254, 78, 254, 173, 253, 173, 253, 113, 5, 113, 5, 40, 1, 40, 1, 252, 249, 252, 249, 116, 251, 116, 251, 221, 0, 221, 0, 136, 4, 136, 4, 223, 1, 223, 1, 111, 1, 111, 1, 182, 251, 182, 251, 236, 250, 236, 250, 155, 3, 155, 3, 205, 1, 205, 1, 54, 1, 54, 1, 184, 2, 184, 2, 174, 2, 174, 2, 180, 3, 180, 3, 183, 254, 183, 254, 63, 252, 63, 252, 82, 252, 82, 252, 215, 253, 215, 253, 220, 255, 220, 255, 91, 0, 91, 0, 106, 4, 106, 4, 192, 2, 192, 2, 117, 254, 117, 254, 155, 252, 155, 252, 54, 252, 54, 252, 149, 0, 149, 0, 115, 4, 115, 4, 228, 4, 228, 4, 209, 254, 209, 254, 250, 253, 250, 253, 101, 0, 101, 0, 11, 255, 11, 255, 77, 1, 77, 1, 223, 253, 223, 253, 7, 2, 7, 2, 30, 250, 30, 250, 234, 240, 234, 240, 219, 26, 219, 26, 189, 52, 189, 52, 79, 22, 79, 22, 193, 208, 193, 208, 237, 159, 237, 159, 167, 213, 167, 213, 128, 46, 128, 46, 201, 104, 201, 104, 227, 77, 227, 77, 116, 237, 116, 237, 149, 224, 149, 224, 71, 4, 71, 4, 171, 3, 171, 3, 56, 253, 56, 253, 107, 249, 107, 249, 119, 252, 119, 252, 2, 253, 2, 253, 241, 250, 241, 250, 40, 251, 40, 251, 152, 1, 152, 1, 106, 7, 106, 7, 214, 0, 214, 0, 144, 252, 144, 252, 206, 248, 206, 248, 10, 255, 10, 255, 81, 248, 81, 248, 130, 1, 130, 1, 3, 63, 3, 63, 142, 56, 142, 56, 86, 242, 86, 242, 59, 194, 59, 194, 225, 196, 225, 196, 15, 20, 15, 20, 174, 67, 174, 67, 170, 30, 170, 30, 249, 228, 249, 228, 147, 201, 147, 201, 19, 232, 19, 232, 14, 0, 14, 0, 68, 251, 68, 251, 63, 251, 63, 251, 131, 251, 131, 251, 13, 0, 13, 0, 33, 3, 33, 3, 121, 3, 121, 3, 131, 3, 131, 3, 77, 254, 77, 254, 228, 248, 228, 248, 76, 249, 76, 249, 84, 255, 84, 255, 220, 0, 220, 0, 152, 255, 152, 255, 221, 253, 221, 253, 237, 248, 237, 248, 214, 247, 214, 247, 186, 254, 186, 254, 149, 5, 149, 5, 135, 2, 135, 2, 58, 253, 58, 253, 169, 251, 169, 251, 175, 252, 175, 252, 5, 254, 5, 254, 73, 254, 73, 254, 25, 2, 25, 2, 148, 255, 148, 255, 137, 251, 137, 251, 125, 2, 125, 2, 136, 3, 136, 3, 128, 252, 128, 252, 110, 253, 110, 253, 128, 2, 128, 2, 43, 0, 43, 0, 242, 251, 242, 251, 115, 253, 115, 253, 130, 1, 130, 1, 179, 3, 179, 3, 59, 1, 59, 1, 60, 253, 60, 253, 147, 250, 147, 250, 19, 252, 19, 252, 24, 0, 24, 0, 49, 0, 49, 0, 162, 255, 162, 255, 79, 253, 79, 253, 47, 253, 47, 253, 198, 1, 198, 1, 40, 0, 40, 0, 193, 0, 193, 0, 15, 2, 15, 2, 174, 253, 174, 253, 176, 254, 176, 254, 74, 254, 74, 254, 245, 0, 245, 0, 58, 1, 58, 1, 180, 252, 180, 252, 195, 5, 195, 5, 51, 0, 51, 0, 55, 17, 55, 17, 251, 55, 251, 55, 47, 4, 47, 4, 2, 186, 2, 186, 254, 182, 254, 182, 253, 232, 253, 232, 137, 56, 137, 56, 171, 69, 171, 69, 219, 8, 219, 8, 119, 201, 119, 201, 5, 187, 5, 187, 68, 0, 68, 0, 251, 38, 251, 38, 63, 6, 63, 6, 6, 254, 6, 254, 222, 5, 222, 5, 246, 2, 246, 2, 15, 0, 15, 0, 142, 254, 142, 254, 99, 254, 99, 254, 67, 252, 67, 252, 33, 253, 33, 253, 192, 1, 192, 1, 85, 3, 85, 3, 8, 3, 8, 3, 157, 4, 157, 4, 70, 4, 70, 4, 146, 3, 146, 3, 98, 252, 98, 252, 236, 242, 236, 242, 249, 249, 249, 249, 12, 0, 12, 0, 160, 1, 160, 1, 74, 5, 74, 5, 103, 255, 103, 255, 209, 251, 209, 251, 102, 0, 102, 0, 91, 6, 91, 6, 179, 7, 179, 7, 120, 4, 120, 4, 122, 0, 122, 0, 140, 251, 140, 251, 192, 253, 192, 253, 215, 1, 215, 1, 29, 0, 29, 0, 40, 255, 40, 255, 111, 2, 111, 2, 176, 1, 176, 1, 254, 250, 254, 250, 159, 252, 159, 252, 167, 4, 167, 4, 228, 6, 228, 6, 60, 254, 60, 254, 169, 249, 169, 249, 35, 1, 35, 1, 47, 3, 47, 3, 170, 2, 170, 2, 106, 255, 106, 255, 11, 252, 11, 252, 79, 255, 79, 255, 237, 2, 237, 2, 137, 8, 137, 8, 77, 3, 77, 3, 161, 251, 161, 251, 93, 252, 93, 252, 19, 253, 19, 253, 2, 4, 2, 4, 132, 4, 132, 4, 197, 1, 197, 1, 41, 3, 41, 3, 101, 254, 101, 254, 1, 255, 1, 255, 152, 0, 152, 0, 53, 253, 53, 253, 229, 254, 229, 254, 205, 254, 205, 254, 43, 10, 43, 10, 26, 35, 26, 35, 239, 16, 239, 16, 23, 221, 23, 221, 250, 190, 250, 190, 41, 209, 41, 209, 8, 34, 8, 34, 187, 69, 187, 69, 57, 20, 57, 20, 49, 255, 49, 255, 143, 1, 143, 1, 60, 255, 60, 255, 178, 1, 178, 1, 21, 251, 21, 251, 105, 250, 105, 250, 87, 0, 87, 0, 85, 2, 85, 2, 215, 253, 215, 253, 203, 253, 203, 253, 125, 0, 125, 0, 129, 255, 129, 255, 129, 254, 129, 254, 130, 254, 130, 254, 172, 254, 172, 254, 25, 225, 25, 225, 123, 235, 123, 235, 139, 52, 139, 52, 175, 62, 175, 62, 60, 12, 60, 12, 171, 195, 171, 195, 171, 163, 171, 163, 24, 229, 24, 229, 176, 54, 176, 54, 188, 105, 188, 105, 64, 69, 64, 69, 57, 234, 57, 234, 132, 221, 132, 221, 247, 246, 247, 246, 166, 251, 166, 251, 201, 252, 201, 252, 186, 255, 186, 255, 60, 2, 60, 2, 142, 0, 142, 0, 171, 254, 171, 254, 62, 252, 62, 252, 37, 253, 37, 253, 170, 253, 170, 253, 172, 255, 172, 255, 85, 2, 85, 2, 147, 254, 147, 254, 12, 254, 12, 254, 209, 251, 209, 251, 230, 253, 230, 253, 233, 2, 233, 2, 46, 0, 46, 0, 218, 254, 218, 254, 229, 251, 229, 251, 177, 252, 177, 252, 234, 255, 234, 255, 206, 254, 206, 254, 74, 254, 74, 254, 166, 250, 166, 250, 190, 250, 190, 250, 172, 1, 172, 1, 79, 2, 79, 2, 218, 252, 218, 252, 105, 0, 105, 0, 84, 3, 84, 3, 34, 251, 34, 251, 24, 251, 24, 251, 144, 1, 144, 1, 89, 2, 89, 2, 27, 255, 27, 255, 22, 252, 22, 252, 104, 253, 104, 253, 19, 1, 19, 1, 145, 1, 145, 1, 27, 254, 27, 254, 122, 254, 122, 254, 78, 253, 78, 253, 213, 252, 213, 252, 240, 4, 240, 4, 18, 5, 18, 5, 223, 254, 223, 254, 243, 249, 243, 249, 201, 248, 201, 248, 214, 1, 214, 1, 136, 4, 136, 4, 214, 254, 214, 254, 107, 252, 107, 252, 123, 253, 123, 253, 48, 6, 48, 6, 64, 5, 64, 5, 216, 253, 216, 253, 10, 0, 10, 0, 104, 244, 104, 244, 4, 10, 4, 10, 83, 66, 83, 66, 164, 47, 164, 47, 72, 232, 72, 232, 255, 183, 255, 183, 149, 206, 149, 206, 118, 35, 118, 35, 28, 67, 28, 67, 80, 29, 80, 29, 221, 211, 221, 211, 104, 165, 104, 165, 18, 219, 18, 219, 249, 7, 249, 7, 186, 251, 186, 251, 109, 251, 109, 251, 6, 255, 6, 255, 159, 254, 159, 254, 176, 2, 176, 2, 121, 3, 121, 3, 137, 1, 137, 1, 34, 6, 34, 6, 11, 7, 11, 7, 249, 3, 249, 3, 103, 255, 103, 255, 193, 243, 193, 243, 53, 247, 53, 247, 228, 255, 228, 255, 176, 31, 176, 31, 85, 58, 85, 58, 142, 250, 142, 250, 121, 197, 121, 197, 81, 223, 81, 223, 181, 255, 181, 255, 115, 10, 115, 10, 30, 252, 30, 252, 41, 251, 41, 251, 54, 8, 54, 8, 98, 10, 98, 10, 80, 13, 80, 13, 86, 4, 86, 4, 45, 251, 45, 251, 71, 245, 71, 245, 79, 245, 79, 245, 97, 3, 97, 3, 178, 8, 178, 8, 76, 12, 76, 12, 51, 9, 51, 9, 75, 254, 75, 254, 218, 247, 218, 247, 151, 245, 151, 245, 233, 1, 233, 1, 170, 5, 170, 5, 196, 0, 196, 0, 194, 1, 194, 1, 206, 249, 206, 249, 129, 245, 129, 245, 214, 1, 214, 1, 244, 16, 244, 16, 57, 6, 57, 6, 255, 244, 255, 244, 188, 249, 188, 249, 87, 0, 87, 0, 167, 9, 167, 9, 111, 10, 111, 10, 198, 255, 198, 255, 75, 252, 75, 252, 11, 254, 11, 254, 180, 4, 181, 4, 31, 4, 32, 4, 218, 2, 217, 2, 55, 252, 53, 252, 42, 243, 45, 243, 65, 255, 67, 255, 64, 8, 59, 8, 14, 14, 14, 14, 31, 3, 36, 3, 39, 239, 36, 239, 179, 250, 176, 250, 94, 0, 99, 0, 19, 4, 18, 4, 231, 252, 224, 252, 110, 237, 118, 237, 187, 16, 194, 16, 72, 25, 54, 25, 164, 247, 159, 247, 87, 243, 113, 243, 171, 243, 172, 243, 100, 254, 68, 254, 178, 14, 181, 14, 62, 11, 97, 11, 236, 11, 230, 11, 187, 4, 150, 4, 37, 242, 44, 242, 240, 244, 20, 245, 119, 251, 114, 251, 80, 255, 45, 255, 61, 14, 65, 14, 168, 6, 200, 6, 7, 254, 4, 254, 115, 235, 89, 235, 219, 173, 223, 173, 218, 188, 235, 188, 161, 28, 158, 28, 139, 91, 134, 91, 33, 94, 33, 94, 171, 13, 162, 13, 203, 186, 209, 186, 59, 182, 80, 182, 201, 233, 185, 233, 187, 53, 159, 53, 4, 64, 31, 64, 208, 17, 235, 17, 161, 254, 127, 254, 141, 249, 124, 249, 64, 252, 99, 252, 49, 7, 53, 7, 65, 7, 37, 7, 25, 249, 36, 249, 18, 242, 33, 242, 11, 255, 244, 254, 183, 10, 183, 10, 236, 10, 11, 11, 223, 249, 208, 249, 110, 238, 76, 238, 232, 248, 2, 249, 5, 2, 40, 2, 38, 11, 5, 11, 121, 7, 85, 7, 217, 251, 253, 251, 68, 252, 102, 252, 201, 249, 163, 249, 249, 252, 219, 252, 86, 5, 126, 5, 120, 8, 139, 8, 229, 1, 190, 1, 194, 241, 193, 241, 149, 243, 181, 243, 58, 8, 36, 8, 74, 21, 58, 21, 213, 2, 1, 3, 188, 232, 181, 232, 3, 239, 199, 238, 250, 255, 25, 0, 83, 13, 146, 13, 104, 12, 52, 12, 122, 254, 68, 254, 68, 252, 127, 252, 170, 250, 206, 250, 119, 255, 70, 255, 226, 4, 210, 4, 159, 0, 183, 0, 15, 4, 14, 4, 127, 3, 140, 3, 223, 4, 233, 4, 100, 3, 46, 3, 77, 243, 65, 243, 28, 238, 120, 238, 136, 248, 150, 248, 86, 13, 218, 12, 200, 19, 182, 19, 255, 2, 152, 3, 104, 247, 131, 247, 26, 243, 100, 242, 144, 246, 107, 246, 141, 255, 96, 0, 2, 9, 40, 9, 206, 10, 225, 9, 213, 252, 187, 252, 248, 248, 244, 249, 113, 5, 108, 5, 139, 4, 152, 3, 177, 236, 225, 236, 154, 247, 98, 248, 14, 48, 179, 47, 200, 50, 78, 50, 226, 245, 85, 246, 150, 188, 169, 188, 2, 186, 149, 185, 60, 252, 151, 252, 166, 63, 234, 63, 104, 87, 177, 86, 223, 43, 225, 43, 110, 233, 90, 234, 144, 242, 65, 242, 151, 9, 163, 8, 127, 249, 12, 250, 97, 245, 49, 246, 107, 249, 194, 248, 23, 253, 134, 252, 69, 2, 221, 2, 207, 3, 30, 4, 244, 4, 151, 4, 98, 254, 70, 254, 75, 245, 85, 245, 172, 249, 177, 249, 8, 254, 84, 254, 62, 252, 53, 252, 226, 4, 79, 4, 113, 8, 143, 8, 6, 30, 195, 30, 193, 62, 141, 62, 204, 19, 254, 18, 98, 202, 164, 202, 253, 183, 197, 184, 111, 227, 46, 227, 253, 39, 70, 39, 165, 47, 217, 47, 53, 9, 219, 9, 144, 239, 107, 239, 134, 231, 247, 230, 21, 244, 48, 244, 147, 248, 252, 248, 39, 250, 28, 250, 144, 6, 77, 6, 240, 8, 234, 8, 189, 4, 221, 4, 104, 251, 116, 251, 149, 245, 170, 245, 5, 252, 229, 251, 131, 5, 56, 5, 254, 3, 72, 4, 208, 246, 52, 247, 246, 244, 129, 244, 175, 250, 76, 250, 50, 252, 205, 252, 26, 0, 82, 0, 42, 4, 141, 3, 221, 255, 231, 255, 220, 249, 51, 250, 128, 251, 115, 251, 16, 250, 229, 249, 127, 255, 124, 255, 174, 8, 232, 8, 7, 1, 184, 0, 149, 248, 175, 248, 60, 249, 178, 249, 49, 6, 128, 5, 171, 9, 182, 9, 189, 248, 88, 249, 68, 244, 252, 243, 6, 250, 206, 249, 10, 7, 240, 6, 201, 13, 65, 14, 26, 253, 45, 253, 46, 240, 124, 239, 52, 246, 137, 246, 169, 8, 255, 8, 33, 10, 228, 9, 92, 251, 42, 251, 132, 246, 155, 246, 129, 252, 208, 252, 191, 10, 114, 10, 177, 2, 163, 2, 90, 242, 151, 242, 192, 249, 164, 249, 117, 2, 106, 2, 220, 6, 220, 6, 131, 1, 167, 1, 53, 254, 17, 254, 118, 6, 119, 6, 79, 6, 111, 6, 206, 251, 151, 251, 229, 240, 39, 241, 229, 248, 204, 248, 199, 2, 154, 2, 42, 8, 79, 8, 36, 16, 57, 16, 127, 3, 161, 3, 24, 239, 112, 238, 173, 234, 40, 235, 185, 30, 62, 31, 109, 68, 87, 67, 16, 243, 152, 243, 63, 172, 133, 172, 151, 191, 34, 191, 110, 0, 192, 0, 28, 67, 193, 66, 54, 51, 154, 51, 239, 238, 215, 238, 79, 186, 226, 185, 15, 203, 214, 203, 50, 32, 157, 31, 198, 46, 164, 46, 22, 0, 206, 0, 224, 244, 83, 244, 17, 248, 255, 247, 14, 251, 100, 251, 177, 2, 148, 2, 127, 11, 103, 11, 20, 10, 34, 10, 218, 253, 223, 253, 106, 247, 96, 247, 113, 250, 136, 250, 67, 2, 39, 2, 36, 3, 52, 3, 117, 4, 114, 4, 42, 4, 22, 4, 70, 255, 135, 255, 104, 2, 26, 2, 121, 252, 135, 252, 198, 248, 16, 249, 47, 2, 211, 1, 80, 6, 119, 6, 226, 8, 246, 8, 162, 1, 119, 1, 172, 248, 205, 248, 124, 252, 118, 252, 175, 255, 166, 255, 215, 1, 210, 1, 199, 4, 221, 4, 245, 4, 235, 4, 186, 253, 167, 253, 95, 250, 129, 250, 6, 0, 232, 255, 63, 248, 78, 248, 19, 243, 26, 243, 30, 4, 253, 3, 242, 19, 31, 20, 177, 13, 152, 13, 23, 247, 7, 247, 117, 239, 160, 239, 78, 250, 45, 250, 6, 255, 5, 255, 196, 3, 224, 3, 32, 15, 3, 15, 210, 14, 219, 14, 137, 0, 151, 0, 76, 244, 45, 244, 220, 243, 253, 243, 17, 1, 6, 1, 118, 11, 89, 11, 105, 11, 161, 11, 30, 9, 245, 8, 253, 251, 244, 251, 68, 241, 116, 241, 200, 246, 161, 246, 202, 253, 202, 253, 81, 1, 97, 1, 236, 0, 247, 0, 68, 2, 30, 2, 228, 3, 244, 3, 236, 6, 26, 7, 235, 5, 146, 5, 14, 242, 79, 242, 140, 240, 145, 240, 209, 11, 144, 11, 74, 44, 161, 44, 247, 57, 165, 57, 187, 8, 242, 8, 6, 200, 17, 200, 193, 183, 86, 183, 18, 225, 186, 225, 164, 39, 48, 39, 214, 45, 181, 45, 23, 14, 190, 14, 20, 12, 106, 11, 126, 3, 176, 3, 51, 255, 124, 255, 72, 1, 225, 0, 107, 248, 158, 248, 158, 246, 158, 246, 229, 247, 222, 247, 23, 253, 23, 253, 6, 4, 251, 3, 194, 7, 217, 7, 66, 7, 63, 7, 53, 2, 24, 2, 253, 253, 10, 254, 213, 251, 12, 252, 168, 240, 66, 240, 82, 216, 130, 216, 164, 250, 242, 250, 160, 64, 2, 64, 161, 53, 18, 54, 111, 247, 124, 247, 215, 185, 111, 185, 168, 177, 18, 178, 125, 251, 64, 251, 153, 68, 182, 68, 92, 93, 83, 93, 24, 44, 243, 43, 231, 238, 78, 239, 30, 244, 164, 243, 4, 254, 59, 254, 57, 253, 111, 253, 98, 1, 238, 0, 16, 1, 109, 1, 13, 254, 237, 253, 92, 244, 84, 244, 131, 245, 154, 245, 107, 250, 60, 250, 147, 255, 226, 255, 58, 6, 239, 5, 227, 1, 236, 1, 1, 255, 76, 255, 236, 252, 136, 252, 119, 254, 167, 254, 46, 255, 74, 255, 29, 247, 228, 246, 72, 247, 102, 247, 63, 250, 70, 250, 90, 253, 76, 253, 255, 2, 254, 2, 129, 3, 139, 3, 22, 3, 18, 3, 164, 254, 164, 254, 216, 248, 213, 248, 186, 250, 186, 250, 174, 253, 192, 253, 60, 253, 25, 253, 112, 252, 136, 252, 135, 255, 151, 255, 66, 3, 17, 3, 47, 0, 92, 0, 16, 251, 7, 251, 121, 249, 93, 249, 53, 254, 91, 254, 86, 4, 63, 4, 34, 3, 36, 3, 132, 0, 143, 0, 27, 253, 13, 253, 222, 251, 236, 251, 138, 254, 129, 254, 167, 251, 168, 251, 177, 251, 186, 251, 78, 255, 68, 255, 131, 0, 136, 0, 0, 4, 1, 4, 23, 4, 19, 4, 249, 255, 249, 255, 28, 253, 29, 253, 98, 253, 98, 253, 172, 255, 170, 255, 136, 253, 138, 253, 49, 250, 49, 250, 202, 251, 200, 251, 65, 253, 67, 253, 85, 2, 84, 2, 193, 6, 192, 6, 210, 1, 211, 1, 191, 254, 191, 254, 49, 246, 49, 246, 58, 255, 58, 255, 238, 36, 237, 36, 83, 34, 83, 34, 175, 254, 175, 254, 229, 234, 229, 234, 30, 239, 30, 239, 251, 13, 251, 13, 162, 29, 162, 29, 173, 5, 173, 5, 161, 219, 161, 219, 254, 207, 254, 207, 151, 241, 151, 241, 1, 2, 1, 2, 74, 253, 74, 253, 101, 0, 101, 0, 163, 2, 163, 2, 96, 3, 96, 3, 161, 1, 161, 1, 237, 255, 237, 255, 29, 255, 29, 255, 122, 255, 122, 255, 59, 0, 59, 0, 250, 253, 250, 253, 197, 252, 197, 252, 2, 255, 2, 255, 99, 2, 99, 2, 168, 2, 168, 2, 59, 13, 59, 13, 108, 19, 108, 19, 57, 1, 57, 1, 105, 249, 105, 249, 201, 252, 201, 252, 179, 249, 179, 249, 208, 252, 208, 252, 202, 2, 202, 2, 180, 3, 180, 3, 153, 1, 153, 1, 189, 253, 189, 253, 61, 250, 61, 250, 13, 252, 13, 252, 165, 255, 165, 255, 230, 0, 230, 0, 165, 0, 165, 0, 247, 252, 247, 252, 131, 250, 131, 250, 113, 253, 113, 253, 27, 3, 27, 3, 116, 2, 116, 2, 216, 253, 216, 253, 45, 1, 45, 1, 13, 5, 13, 5, 247, 1, 247, 1, 235, 252, 235, 252, 60, 251, 60, 251, 184, 253, 184, 253, 93, 3, 93, 3, 115, 7, 115, 7, 198, 2, 198, 2, 145, 252, 145, 252, 156, 251, 156, 251, 14, 253, 14, 253, 222, 255, 222, 255, 221, 1, 221, 1, 11, 1, 11, 1, 84, 254, 84, 254, 15, 253, 15, 253, 175, 252, 175, 252, 50, 254, 50, 254, 173, 1, 173, 1, 136, 1, 136, 1, 30, 0, 30, 0, 147, 254, 147, 254, 95, 254, 95, 254, 152, 255, 152, 255, 26, 255, 26, 255, 233, 0, 233, 0, 67, 1, 67, 1, 219, 254, 219, 254, 130, 254, 130, 254, 171, 255, 171, 255, 93, 253, 93, 253, 115, 253, 115, 253, 65, 8, 65, 8, 132, 9, 132, 9, 205, 0, 205, 0, 166, 254, 166, 254, 117, 254, 117, 254, 55, 254, 55, 254, 42, 254, 42, 254, 48, 0, 48, 0, 40, 0, 40, 0, 77, 0, 77, 0, 241, 2, 241, 2, 53, 0, 53, 0, 114, 253, 114, 253, 147, 252, 147, 252, 165, 253, 165, 253, 11, 0, 11, 0, 208, 1, 208, 1, 64, 250, 64, 250, 217, 233, 217, 233, 61, 238, 61, 238, 109, 5, 109, 5, 244, 23, 244, 23, 30, 26, 30, 26, 57, 9, 57, 9, 63, 247, 63, 247, 130, 238, 130, 238, 248, 239, 248, 239, 45, 250, 45, 250, 158, 1, 158, 1, 205, 1, 205, 1, 38, 1, 38, 1, 70, 2, 70, 2, 38, 1, 38, 1, 128, 254, 128, 254, 233, 254, 233, 254, 138, 0, 138, 0, 4, 1, 4, 1, 149, 1, 149, 1, 245, 255, 245, 255, 235, 253, 235, 253, 186, 254, 186, 254, 238, 0, 238, 0, 43, 2, 43, 2, 79, 0, 79, 0, 21, 255, 21, 255, 68, 255, 68, 255, 178, 255, 178, 255, 28, 1, 28, 1, 76, 2, 76, 2, 142, 2, 142, 2, 89, 1, 89, 1, 60, 1, 60, 1, 15, 0, 15, 0, 177, 253, 177, 253, 79, 254, 79, 254, 176, 254, 176, 254, 89, 255, 89, 255, 170, 1, 170, 1, 140, 2, 141, 2, 54, 1, 55, 1, 243, 254, 244, 254, 207, 254, 207, 254, 92, 1, 90, 1, 224, 2, 222, 2, 167, 1, 167, 1, 10, 0, 12, 0, 216, 254, 218, 254, 52, 254, 52, 254, 253, 255, 254, 255, 51, 2, 55, 2, 37, 3, 41, 3, 18, 3, 18, 3, 156, 0, 154, 0, 31, 254, 33, 254, 147, 253, 151, 253, 207, 255, 204, 255, 5, 3, 251, 2, 137, 3, 121, 3, 146, 2, 128, 2, 13, 0, 3, 0, 135, 254, 139, 254, 129, 255, 145, 255, 225, 255, 241, 255, 77, 255, 87, 255, 51, 255, 52, 255, 77, 1, 67, 1, 118, 2, 108, 2, 222, 0, 222, 0, 128, 255, 135, 255, 234, 255, 242, 255, 51, 1, 53, 1, 223, 2, 221, 2, 80, 1, 77, 1, 51, 250, 43, 250, 46, 246, 37, 246, 129, 248, 111, 248, 136, 0, 128, 0, 108, 11, 128, 11, 253, 15, 15, 16, 28, 10, 25, 10, 124, 0, 114, 0, 204, 254, 226, 254, 37, 0, 78, 0, 227, 254, 13, 255, 80, 254, 134, 254, 134, 254, 150, 254, 11, 0, 227, 255, 118, 1, 48, 1, 227, 1, 165, 1, 140, 255, 117, 255, 255, 253, 4, 254, 153, 254, 171, 254, 219, 255, 199, 255, 137, 1, 98, 1, 4, 1, 247, 0, 200, 1, 197, 1, 163, 253, 166, 253, 185, 248, 199, 248, 199, 253, 242, 253, 125, 3, 148, 3, 2, 6, 236, 5, 235, 4, 229, 4, 52, 2, 83, 2, 199, 255, 25, 0, 85, 253, 182, 253, 142, 254, 200, 254, 90, 255, 65, 255, 74, 255, 245, 254, 136, 0, 68, 0, 41, 0, 227, 255, 113, 255, 74, 255, 31, 255, 50, 255, 137, 255, 142, 255, 4, 1, 223, 0, 210, 0, 167, 0, 8, 0, 25, 0, 83, 255, 123, 255, 113, 254, 133, 254, 221, 255, 242, 255, 51, 1, 60, 1, 115, 0, 121, 0, 10, 255, 4, 255, 173, 254, 149, 254, 80, 255, 58, 255, 47, 255, 45, 255, 201, 255, 240, 255, 78, 0, 117, 0, 186, 255, 182, 255, 104, 255, 60, 255, 3, 255, 181, 254, 90, 255, 11, 255, 231, 255, 210, 255, 50, 0, 111, 0, 220, 0, 75, 1, 255, 255, 107, 0, 245, 254, 65, 255, 87, 255, 109, 255, 233, 254, 196, 254, 45, 255, 23, 255, 120, 0, 139, 0, 75, 0, 73, 0, 38, 255, 245, 254, 140, 254, 83, 254, 159, 255, 146, 255, 109, 0, 97, 0, 65, 0, 25, 0, 36, 0, 252, 255, 157, 255, 148, 255, 110, 255, 161, 255, 129, 255, 180, 255, 197, 255, 208, 255, 151, 255, 122, 255, 204, 255, 135, 255, 177, 0, 123, 0, 67, 0, 82, 0, 86, 0, 223, 0, 223, 255, 126, 0, 58, 255, 96, 255, 239, 255, 169, 255, 200, 255, 88, 255, 100, 0, 46, 0, 58, 0, 90, 0, 182, 255, 20, 0, 32, 0, 135, 0, 32, 255, 79, 255, 158, 255, 196, 255, 82, 0, 100, 0, 150, 0, 131, 0, 92, 2, 74, 2, 246, 2, 216, 2, 124, 1, 84, 1, 60, 254, 22, 254, 38, 251, 35, 251, 231, 248, 231, 248, 103, 250, 73, 250, 163, 1, 141, 1, 54, 7, 30, 7, 16, 8, 12, 8, 76, 4, 121, 4, 158, 254, 230, 254, 4, 254, 61, 254, 196, 255, 198, 255, 129, 255, 85, 255, 142, 255, 70, 255, 90, 0, 22, 0, 176, 0, 140, 0, 156, 0, 177, 0, 203, 255, 35, 0, 13, 255, 115, 255, 241, 254, 62, 255, 69, 255, 90, 255, 119, 0, 76, 0, 123, 0, 21, 0, 244, 255, 113, 255, 234, 255, 158, 255, 67, 255, 82, 255, 198, 255, 9, 0, 66, 0, 97, 0, 254, 255, 231, 255, 51, 255, 11, 255, 45, 254, 6, 254, 117, 255, 117, 255, 164, 0, 204, 0, 113, 0, 164, 0, 180, 255, 215, 255, 162, 254, 193, 254, 0, 255, 38, 255, 110, 0, 124, 0, 70, 1, 85, 1, 136, 0, 158, 0, 104, 255, 105, 255, 1, 255, 222, 254, 210, 255, 172, 255, 67, 0, 68, 0, 3, 255, 8, 255, 55, 255, 67, 255, 158, 255, 174, 255, 183, 255, 188, 255, 31, 0, 39, 0, 237, 255, 245, 255, 155, 0, 166, 0, 235, 255, 215, 255, 251, 254, 213, 254, 76, 255, 21, 255, 197, 255, 113, 255, 112, 0, 79, 0, 162, 255, 202, 255, 107, 255, 180, 255, 137, 255, 168, 255, 105, 255, 95, 255, 106, 255, 96, 255, 207, 254, 197, 254, 11, 0, 43, 0, 148, 0, 173, 0, 246, 255, 214, 255, 114, 0, 50, 0, 210, 0, 165, 0, 169, 0, 171, 0, 130, 255, 137, 255, 162, 254, 206, 254, 174, 254, 237, 254, 34, 0, 81, 0, 237, 1, 16, 2, 214, 2, 221, 2, 232, 2, 225, 2, 118, 1, 70, 1, 222, 0, 167, 0, 138, 255, 89, 255, 4, 253, 208, 252, 62, 251, 62, 251, 63, 251, 95, 251, 217, 254, 249, 254, 138, 0, 134, 0, 84, 0, 82, 0, 89, 0, 86, 0, 16, 255, 201, 254, 198, 255, 118, 255, 125, 0, 73, 0, 13, 0, 11, 0, 37, 0, 99, 0, 252, 255, 122, 0, 94, 255, 239, 255, 95, 255, 150, 255, 121, 0, 99, 0, 142, 0, 65, 0, 80, 0, 252, 255, 159, 255, 104, 255, 61, 1, 30, 1, 207, 4, 212, 4, 203, 1, 173, 1, 93, 251, 37, 251, 20, 248, 237, 247, 85, 250, 78, 250, 9, 0, 22, 0, 94, 3, 64, 3, 59, 4, 33, 4, 82, 2, 97, 2, 145, 0, 229, 0, 168, 0, 42, 1, 86, 0, 183, 0, 15, 0, 80, 0, 176, 255, 172, 255, 173, 0, 108, 0, 245, 0, 165, 0, 39, 0, 240, 255, 41, 0, 44, 0, 116, 255, 123, 255, 189, 255, 182, 255, 82, 0, 41, 0, 162, 0, 98, 0, 248, 0, 190, 0, 89, 0, 43, 0, 244, 255, 12, 0, 44, 255, 127, 255, 38, 255, 110, 255, 226, 255, 209, 255, 232, 255, 136, 255, 3, 0, 174, 255, 71, 0, 5, 0, 14, 1, 234, 0, 12, 1, 25, 1, 86, 0, 165, 0, 229, 255, 95, 0, 111, 255, 206, 255, 32, 0, 83, 0, 6, 1, 238, 0, 251, 0, 158, 0, 14, 0, 166, 255, 141, 255, 67, 255, 26, 0, 17, 0, 176, 255, 205, 255, 253, 255, 47, 0, 1, 1, 65, 1, 105, 0, 165, 0, 212, 255, 25, 0, 74, 255, 135, 255, 122, 255, 158, 255, 180, 0, 169, 0, 200, 0, 117, 0, 175, 0, 77, 0, 143, 0, 100, 0, 86, 0, 95, 0, 180, 0, 193, 0, 115, 0, 121, 0, 37, 0, 69, 0, 46, 0, 80, 0, 41, 0, 42, 0, 243, 255, 230, 255, 165, 255, 153, 255, 45, 0, 46, 0, 62, 0, 88, 0, 169, 255, 225, 255, 148, 255, 218, 255, 151, 255, 166, 255, 85, 0, 6, 0, 17, 1, 129, 0, 201, 0, 67, 0, 101, 0, 63, 0, 2, 0, 51, 0, 104, 255, 139, 255, 200, 253, 164, 253, 63, 253, 7, 253, 100, 0, 116, 0, 181, 3, 32, 4, 90, 5, 226, 5, 211, 3, 37, 4, 32, 254, 6, 254, 184, 249, 86, 249, 56, 249, 218, 248, 222, 253, 205, 253, 223, 3, 39, 4, 56, 3, 113, 3, 141, 0, 124, 0, 9, 0, 211, 255, 122, 255, 87, 255, 100, 255, 88, 255, 167, 255, 155, 255, 152, 0, 141, 0, 245, 0, 216, 0, 60, 0, 36, 0, 48, 0, 49, 0, 67, 0, 43, 0, 7, 0, 192, 255, 248, 255, 181, 255, 248, 255, 25, 0, 177, 255, 47, 0, 239, 255, 124, 0, 222, 255, 57, 0, 48, 255, 23, 255, 234, 255, 85, 255, 156, 0, 222, 255, 31, 0, 192, 255, 95, 255, 137, 255, 92, 255, 205, 255, 9, 0, 123, 0, 53, 0, 118, 0, 34, 0, 56, 0, 170, 255, 175, 255, 179, 255, 182, 255, 108, 0, 87, 0, 127, 0, 70, 0, 84, 0, 50, 0, 245, 255, 15, 0, 216, 255, 17, 0, 245, 255, 10, 0, 41, 0, 254, 255, 178, 0, 106, 0, 94, 0, 40, 0, 138, 255, 141, 255, 135, 255, 172, 255, 249, 255, 19, 0, 229, 255, 216, 255, 13, 0, 203, 255, 153, 0, 91, 0, 98, 0, 119, 0, 210, 255, 62, 0, 120, 255, 206, 255, 146, 255, 130, 255, 254, 255, 190, 255, 45, 0, 8, 0, 239, 255, 229, 255, 209, 255, 219, 255, 36, 0, 68, 0, 245, 255, 29, 0, 134, 255, 165, 255, 186, 255, 179, 255, 51, 0, 245, 255, 54, 0, 199, 255, 21, 0, 176, 255, 207, 255, 170, 255, 157, 255, 169, 255, 255, 255, 54, 0, 215, 255, 255, 255, 91, 0, 85, 0, 205, 0, 191, 0, 220, 255, 246, 255, 120, 255, 226, 255, 154, 254, 19, 255, 148, 254, 211, 254, 152, 0, 137, 0, 103, 3, 48, 3, 84, 4, 51, 4, 213, 0, 179, 0, 230, 254, 195, 254, 224, 255, 180, 255, 17, 0, 236, 255, 46, 0, 73, 0, 23, 0, 105, 0, 16, 0, 112, 0, 200, 255, 223, 255, 164, 255, 100, 255, 185, 255, 75, 255, 166, 255, 53, 255, 21, 0, 224, 255, 24, 0, 19, 0, 235, 255, 251, 255, 197, 255, 197, 255, 35, 0, 40, 0, 22, 255, 73, 255, 152, 253, 203, 253, 50, 1, 89, 1, 116, 5, 133, 5, 45, 5, 61, 5, 79, 1, 126, 1, 14, 253, 78, 253, 57, 252, 102, 252, 190, 253, 143, 253, 37, 0, 180, 255, 64, 1, 237, 0, 51, 0, 56, 0, 152, 255, 234, 255, 164, 255, 225, 255, 170, 255, 159, 255, 173, 255, 99, 255, 240, 255, 183, 255, 212, 255, 248, 255, 91, 255, 184, 255, 74, 255, 138, 255, 116, 255, 105, 255, 22, 0, 222, 255, 123, 0, 86, 0, 37, 0, 61, 0, 121, 255, 176, 255, 109, 255, 100, 255, 29, 0, 199, 255, 57, 0, 11, 0, 217, 255, 40, 0, 57, 255, 190, 255, 39, 255, 103, 255, 229, 255, 188, 255, 97, 0, 255, 255, 141, 0, 64, 0, 7, 0, 8, 0, 108, 255, 177, 255, 210, 255, 11, 0, 2, 0, 235, 255, 144, 255, 42, 255, 191, 255, 91, 255, 35, 0, 8, 0, 29, 0, 61, 0, 11, 0, 27, 0, 202, 255, 171, 255, 131, 255, 108, 255, 91, 255, 111, 255, 236, 255, 24, 0, 113, 0, 128, 0, 12, 0, 218, 255, 230, 255, 167, 255, 208, 255, 213, 255, 212, 255, 72, 0, 226, 255, 123, 0, 213, 255, 37, 0, 219, 255, 224, 255, 139, 255, 105, 255, 234, 255, 198, 255, 67, 0, 44, 0, 255, 255, 248, 255, 230, 255, 211, 255, 224, 255, 159, 255, 27, 0, 226, 255, 231, 255, 241, 255, 198, 255, 11, 0, 250, 255, 45, 0, 1, 0, 207, 255, 33, 0, 181, 255, 221, 255, 172, 255, 131, 255, 195, 255, 101, 255, 201, 255, 191, 255, 220, 255, 44, 0, 237, 255, 189, 0, 96, 0, 13, 2, 232, 1, 251, 0, 52, 1, 11, 253, 122, 253, 206, 250, 40, 251, 112, 252, 132, 252, 155, 0, 116, 0, 95, 4, 38, 4, 44, 5, 7, 5, 184, 2, 175, 2, 202, 254, 206, 254, 237, 252, 3, 253, 103, 254, 179, 254, 178, 255, 35, 0, 208, 255, 35, 0, 32, 0, 45, 0, 1, 0, 217, 255, 241, 255, 195, 255, 249, 255, 239, 255, 221, 255, 254, 255, 250, 255, 12, 0, 236, 255, 201, 255, 226, 255, 185, 255, 208, 255, 203, 255, 187, 255, 197, 255, 229, 255, 205, 255, 248, 255, 204, 255, 4, 0, 235, 255, 158, 0, 160, 0, 166, 0, 215, 0, 161, 255, 251, 255, 193, 255, 16, 0, 172, 0, 177, 0, 4, 1, 190, 0, 126, 0, 52, 0, 222, 255, 199, 255, 89, 0, 108, 0, 69, 0, 40, 0, 182, 255, 70, 255, 199, 255, 78, 255, 221, 255, 156, 255, 50, 0, 35, 0, 89, 0, 103, 0, 39, 0, 95, 0, 159, 255, 243, 255, 75, 255, 166, 255, 227, 255, 71, 0, 84, 0, 156, 0, 54, 0, 40, 0, 235, 255, 142, 255, 154, 255, 67, 255, 177, 255, 154, 255, 75, 0, 124, 0, 85, 0, 185, 0, 192, 255, 9, 0, 171, 255, 151, 255, 250, 255, 171, 255, 61, 0, 15, 0, 38, 0, 34, 0, 2, 0, 242, 255, 1, 0, 203, 255, 30, 0, 242, 255, 113, 0, 136, 0, 102, 0, 180, 0, 83, 0, 158, 0, 20, 0, 32, 0, 139, 255, 105, 255, 90, 255, 74, 255, 218, 255, 235, 255, 121, 0, 151, 0, 218, 255, 208, 255, 109, 255, 31, 255, 253, 255, 136, 255, 87, 0, 32, 0, 69, 0, 155, 0, 210, 255, 100, 0, 223, 255, 45, 0, 36, 0, 227, 255, 48, 0, 131, 255, 77, 0, 191, 255, 80, 0, 73, 0, 3, 0, 108, 0, 183, 255, 20, 0, 145, 0, 176, 0, 255, 0, 250, 0, 61, 0, 51, 0, 214, 255, 220, 255, 188, 255, 201, 255, 12, 0, 8, 0, 78, 0, 30, 0, 40, 0, 237, 255, 236, 255, 197, 255, 221, 255, 204, 255, 218, 255, 226, 255, 172, 255, 185, 255, 216, 255, 240, 255, 238, 255, 38, 0, 10, 0, 116, 0, 30, 0, 123, 0, 152, 0, 133, 0, 128, 0, 22, 0, 247, 253, 150, 253, 39, 253, 44, 253, 154, 254, 246, 254, 146, 255, 214, 255, 182, 0, 166, 0, 9, 1, 168, 0, 28, 1, 178, 0, 27, 1, 229, 0, 235, 0, 247, 0, 220, 0, 14, 1, 148, 255, 160, 255, 46, 255, 5, 255, 206, 255, 166, 255, 168, 255, 185, 255, 232, 255, 45, 0, 67, 0, 132, 0, 70, 0, 116, 0, 88, 0, 122, 0, 87, 0, 104, 0, 93, 0, 94, 0, 85, 0, 46, 0, 32, 0, 173, 255, 195, 255, 50, 255, 132, 255, 87, 255, 187, 255, 43, 0, 2, 0, 179, 0, 5, 0, 131, 0, 28, 0, 54, 0, 55, 0, 230, 255, 55, 0, 164, 255, 39, 0, 174, 255, 12, 0, 239, 255, 245, 255, 42, 0, 225, 255, 53, 0, 242, 255, 47, 0, 212, 255, 228, 255, 202, 255, 204, 255, 81, 0, 83, 0, 128, 0, 100, 0, 19, 0, 225, 255, 204, 255, 189, 255, 234, 255, 255, 255, 53, 0, 60, 0, 64, 0, 60, 0, 203, 255, 211, 255, 161, 255, 176, 255, 51, 0, 69, 0, 130, 0, 137, 0, 47, 0, 13, 0, 177, 255, 95, 255, 192, 255, 113, 255, 51, 0, 21, 0, 75, 0, 79, 0, 255, 255, 24, 0, 123, 255, 155, 255, 177, 255, 188, 255, 78, 0, 53, 0, 65, 0, 34, 0, 52, 0, 60, 0, 54, 0, 94, 0, 56, 0, 93, 0, 41, 0, 36, 0, 233, 255, 199, 255, 250, 255, 252, 255, 11, 0, 54, 0, 235, 255, 13, 0, 166, 255, 177, 255, 137, 255, 169, 255, 206, 255, 2, 0, 244, 255, 4, 0, 197, 255, 183, 255, 143, 255, 132, 255, 190, 0, 183, 0, 199, 2, 189, 2, 214, 2, 201, 2, 204, 0, 193, 0, 72, 254, 57, 254, 42, 253, 25, 253, 30, 254, 11, 254, 199, 255, 179, 255, 84, 1, 82, 1, 155, 1, 143, 1, 128, 0, 61, 0, 230, 255, 145, 255, 206, 255, 182, 255, 175, 255, 234, 255, 194, 255, 37, 0, 193, 255, 27, 0, 203, 255, 244, 255, 10, 0, 240, 255, 2, 0, 210, 255, 187, 255, 155, 255, 247, 255, 219, 255, 71, 0, 36, 0, 7, 0, 244, 255, 210, 255, 229, 255, 224, 255, 9, 0, 249, 255, 51, 0, 24, 0, 87, 0, 79, 0, 82, 0, 55, 0, 219, 255, 137, 255, 15, 255, 251, 254, 189, 254, 251, 254, 15, 255, 244, 255, 50, 0, 84, 1, 129, 1, 110, 1, 119, 1, 107, 0, 126, 0, 138, 255, 187, 255, 36, 255, 85, 255, 63, 255, 101, 255, 204, 255, 248, 255, 28, 0, 57, 0, 39, 0, 30, 0, 65, 0, 73, 0, 21, 0, 65, 0, 185, 255, 206, 255, 145, 255, 107, 255, 39, 0, 235, 255, 169, 0, 126, 0, 60, 0, 44, 0, 245, 255, 27, 0, 187, 255, 3, 0, 129, 255, 183, 255, 186, 255, 240, 255, 16, 0, 95, 0, 47, 0, 114, 0, 241, 255, 242, 255, 246, 255, 187, 255, 224, 255, 143, 255, 193, 255, 131, 255, 22, 0, 9, 0, 236, 255, 248, 255, 176, 255, 183, 255, 186, 255, 186, 255, 229, 255, 228, 255, 73, 0, 74, 0, 54, 0, 83, 0, 201, 255, 26, 0, 162, 255, 231, 255, 3, 0, 255, 255, 51, 0, 14, 0, 213, 255, 222, 255, 190, 255, 243, 255, 229, 255, 252, 255, 5, 0, 217, 255, 90, 0, 246, 255, 172, 0, 67, 0, 80, 0, 35, 0, 185, 255, 224, 255, 155, 255, 243, 255, 145, 255, 207, 255, 177, 255, 157, 255, 10, 0, 168, 255, 64, 0, 222, 255, 44, 0, 24, 0, 6, 0, 62, 0, 9, 0, 88, 0, 212, 255, 22, 0, 206, 255, 249, 255, 8, 0, 21, 0, 252, 255, 245, 255, 37, 0, 14, 0, 103, 0, 46, 0, 62, 0, 253, 255, 237, 255, 225, 255, 219, 255, 0, 0, 27, 0, 42, 0, 58, 0, 19, 0, 238, 255, 165, 255, 228, 255, 131, 255, 74, 0, 245, 255, 111, 0, 94, 0, 57, 0, 126, 0, 244, 255, 104, 0, 232, 255, 77, 0, 225, 255, 29, 0, 158, 255, 184, 255, 83, 255, 88, 255, 120, 255, 91, 255, 135, 0, 65, 0, 252, 0, 191, 0, 68, 0, 81, 0, 15, 0, 100, 0, 5, 0, 91, 0, 193, 255, 233, 255, 175, 255, 162, 255, 215, 255, 161, 255, 47, 0, 0, 0, 23, 0, 25, 0, 194, 255, 227, 255, 120, 255, 135, 255, 156, 255, 142, 255, 90, 0, 61, 0, 127, 0, 91, 0, 6, 0, 2, 0, 144, 255, 182, 255, 142, 255, 174, 255, 29, 0, 21, 0, 124, 0, 86, 0, 140, 0, 99, 0, 54, 0, 11, 0, 187, 255, 136, 255, 160, 255, 111, 255, 151, 255, 131, 255, 187, 255, 237, 255, 29, 0, 130, 0, 86, 0, 163, 0, 37, 0, 62, 0, 212, 255, 206, 255, 231, 255, 197, 255, 13, 0, 223, 255, 252, 255, 2, 0, 182, 255, 6, 0, 154, 255, 233, 255, 42, 0, 52, 0, 156, 0, 91, 0, 83, 0, 213, 255, 207, 255, 59, 255, 170, 255, 66, 255, 243, 255, 234, 255, 251, 255, 83, 0, 200, 255, 82, 0, 208, 255, 62, 0, 6, 0, 25, 0, 70, 0, 22, 0, 241, 255, 215, 255, 104, 255, 145, 255, 132, 255, 225, 255, 231, 255, 60, 0, 94, 0, 96, 0, 130, 0, 34, 0, 76, 0, 213, 255, 67, 0, 8, 0, 35, 0, 51, 0, 25, 0, 110, 0, 2, 0, 138, 0, 195, 255, 52, 0, 137, 255, 162, 255, 47, 255, 11, 255, 176, 255, 136, 255, 125, 0, 66, 0, 113, 0, 25, 0, 47, 0, 253, 255, 221, 255, 254, 255, 190, 255, 16, 0, 28, 0, 90, 0, 158, 0, 180, 0, 111, 0, 118, 0, 164, 255, 191, 255, 123, 255, 168, 255, 168, 255, 173, 255, 227, 255, 176, 255, 54, 0, 250, 255, 86, 0, 44, 0, 54, 0, 55, 0, 196, 255, 253, 255, 179, 255, 253, 255, 243, 255, 254, 255, 58, 0, 246, 255, 112, 0, 35, 0, 45, 0, 14, 0, 12, 0, 43, 0, 212, 255, 19, 0, 156, 255, 188, 255, 223, 255, 209, 255, 245, 255, 232, 255, 212, 255, 236, 255, 151, 255, 160, 255, 175, 255, 118, 255, 121, 0, 31, 0, 111, 1, 61, 1, 169, 1, 198, 1, 132, 0, 219, 0, 34, 255, 121, 255, 124, 254, 164, 254, 207, 254, 202, 254, 12, 0, 5, 0, 220, 0, 246, 0, 195, 0, 12, 1, 53, 0, 120, 0, 219, 255, 173, 255, 61, 0, 151, 255, 92, 0, 195, 255, 246, 255, 221, 255, 186, 255, 12, 0, 142, 255, 239, 255, 170, 255, 226, 255, 3, 0, 255, 255, 48, 0, 1, 0, 30, 0, 228, 255, 232, 255, 178, 255, 10, 0, 219, 255, 66, 0, 34, 0, 76, 0, 82, 0, 51, 0, 96, 0, 217, 255, 31, 0, 200, 255, 14, 0, 3, 0, 32, 0, 27, 0, 25, 0, 202, 255, 214, 255, 130, 255, 172, 255, 212, 255, 255, 255, 27, 0, 25, 0, 65, 0, 7, 0, 45, 0, 223, 255, 208, 255, 198, 255, 183, 255, 20, 0, 221, 255, 57, 0, 66, 0, 58, 0, 127, 0, 40, 0, 95, 0, 12, 0, 241, 255, 196, 255, 161, 255, 150, 255, 193, 255, 213, 255, 188, 255, 203, 255, 230, 255, 218, 255, 249, 255, 228, 255, 218, 255, 227, 255, 236, 255, 33, 0, 202, 255, 5, 0, 29, 0, 48, 0, 94, 0, 65, 0, 25, 0, 8, 0, 232, 255, 9, 0, 190, 255, 225, 255, 5, 0, 8, 0, 67, 0, 53, 0, 44, 0, 33, 0, 19, 0, 4, 0, 243, 255, 221, 255, 29, 0, 7, 0, 60, 0, 23, 0, 243, 255, 201, 255, 163, 255, 159, 255, 151, 255, 201, 255, 190, 255, 2, 0, 243, 255, 56, 0, 242, 255, 51, 0, 246, 255, 17, 0, 17, 0, 251, 255, 255, 255, 200, 255, 105, 0, 40, 0, 93, 0, 27, 0, 113, 255, 59, 255, 24, 255, 18, 255, 123, 255, 180, 255, 158, 0, 250, 0, 61, 1, 126, 1, 210, 0, 228, 0, 200, 255, 220, 255, 52, 254, 95, 254, 102, 254, 127, 254, 213, 255, 176, 255, 67, 0, 247, 255, 62, 0, 2, 0, 72, 0, 47, 0, 52, 0, 59, 0, 231, 255, 0, 0, 13, 0, 30, 0, 81, 0, 67, 0, 10, 0, 234, 255, 203, 255, 182, 255, 166, 255, 160, 255, 178, 255, 185, 255, 251, 255, 253, 255, 41, 0, 29, 0, 249, 255, 0, 0, 49, 0, 103, 0, 229, 0, 43, 1, 170, 0, 194, 0, 22, 0, 248, 255, 241, 255, 197, 255, 4, 0, 240, 255, 254, 255, 12, 0, 214, 255, 231, 255, 52, 0, 50, 0, 55, 0, 50, 0, 240, 255, 0, 0, 246, 255, 250, 255, 182, 255, 121, 255, 217, 255, 117, 255, 51, 0, 217, 255, 97, 0, 49, 0, 77, 0, 105, 0, 177, 255, 30, 0, 127, 255, 4, 0, 170, 255, 236, 255, 247, 255, 229, 255, 99, 0, 70, 0, 34, 0, 61, 0, 171, 255, 250, 255, 161, 255, 208, 255, 218, 255, 178, 255, 64, 0, 237, 255, 112, 0, 57, 0, 50, 0, 45, 0, 18, 0, 49, 0, 72, 0, 116, 0, 70, 0, 88, 0, 234, 255, 215, 255, 132, 255, 122, 255, 114, 255, 142, 255, 226, 255, 10, 0, 100, 0, 109, 0, 104, 0, 72, 0, 4, 0, 202, 255, 180, 255, 139, 255, 171, 255, 184, 255, 237, 255, 16, 0, 61, 0, 57, 0, 50, 0, 6, 0, 242, 255, 210, 255, 166, 255, 173, 255, 187, 255, 206, 255, 40, 0, 39, 0, 47, 0, 31, 0, 23, 0, 40, 0, 243, 255, 62, 0, 202, 255, 47, 0, 249, 255, 69, 0, 237, 255, 10, 0, 183, 255, 177, 255, 247, 255, 206, 255, 100, 0, 52, 0, 69, 0, 59, 0, 249, 255, 253, 255, 48, 0, 30, 0, 67, 0, 33, 0, 21, 0, 17, 0, 252, 255, 30, 0, 227, 255, 252, 255, 236, 255, 219, 255, 214, 255, 147, 255, 217, 255, 146, 255, 14, 0, 17, 0, 11, 0, 99, 0, 242, 255, 102, 0, 165, 255, 250, 255, 145, 255, 178, 255, 225, 255, 208, 255, 96, 255, 38, 255, 147, 254, 76, 254, 38, 255, 247, 254, 143, 0, 131, 0, 73, 1, 94, 1, 241, 0, 22, 1, 32, 0, 68, 0, 111, 255, 147, 255, 64, 255, 85, 255, 218, 255, 191, 255, 84, 0, 25, 0, 58, 0, 34, 0, 48, 0, 82, 0, 7, 0, 48, 0, 235, 255, 1, 0, 241, 255, 2, 0, 210, 255, 225, 255, 216, 255, 216, 255, 230, 255, 222, 255, 239, 255, 253, 255, 224, 255, 8, 0, 220, 255, 10, 0, 36, 0, 46, 0, 84, 0, 36, 0, 100, 0, 35, 0, 50, 0, 9, 0, 202, 255, 194, 255, 164, 255, 200, 255, 184, 255, 1, 0, 251, 255, 44, 0, 43, 0, 14, 0, 28, 0, 201, 255, 31, 0, 224, 255, 40, 0, 42, 0, 36, 0, 95, 0, 44, 0, 116, 0, 33, 0, 61, 0, 25, 0, 248, 255, 16, 0, 220, 255, 9, 0, 226, 255, 57, 0, 38, 0, 21, 0, 26, 0, 137, 255, 172, 255, 79, 255, 132, 255, 167, 255, 204, 255, 62, 0, 54, 0, 112, 0, 76, 0, 87, 0, 71, 0, 253, 255, 26, 0, 149, 255, 213, 255, 224, 255, 36, 0, 36, 0, 72, 0, 33, 0, 254, 255, 89, 0, 234, 255, 94, 0, 232, 255, 37, 0, 247, 255, 236, 255, 9, 0, 243, 255, 34, 0, 255, 255, 27, 0, 179, 255, 192, 255, 159, 255, 166, 255, 227, 255, 225, 255, 31, 0, 10, 0, 73, 0, 24, 0, 75, 0, 16, 0, 28, 0, 1, 0, 233, 255, 9, 0, 231, 255, 46, 0, 241, 255, 60, 0, 236, 255, 20, 0, 17, 0, 254, 255, 5, 0, 208, 255, 229, 255, 186, 255, 118, 0, 110, 0, 212, 0, 231, 0, 55, 0, 80, 0, 80, 255, 104, 255, 153, 254, 179, 254, 197, 254, 234, 254, 233, 255, 3, 0, 34, 1, 253, 0, 136, 1, 35, 1, 165, 0, 70, 0, 226, 255, 198, 255, 17, 0, 53, 0, 229, 255, 38, 0, 147, 255, 210, 255, 247, 255, 23, 0, 73, 0, 58, 0, 78, 0, 48, 0, 53, 0, 52, 0, 195, 255, 229, 255, 111, 255, 159, 255, 148, 255, 173, 255, 15, 0, 7, 0, 67, 0, 41, 0, 3, 0, 223, 255, 8, 0, 224, 255, 236, 255, 213, 255, 227, 255, 252, 255, 141, 0, 204, 0, 185, 0, 240, 0, 5, 0, 19, 0, 76, 255, 46, 255, 95, 255, 44, 255, 35, 0, 18, 0, 131, 0, 175, 0, 51, 0, 113, 0, 165, 255, 203, 255, 150, 255, 158, 255, 23, 0, 1, 0, 83, 0, 36, 0, 61, 0, 21, 0, 11, 0, 14, 0, 210, 255, 247, 255, 220, 255, 0, 0, 253, 255, 12, 0, 254, 255, 1, 0, 233, 255, 242, 255, 208, 255, 228, 255, 212, 255, 235, 255, 218, 255, 236, 255, 249, 255, 16, 0, 43, 0, 61, 0, 21, 0, 255, 255, 0, 0, 218, 255, 22, 0, 15, 0, 24, 0, 47, 0, 24, 0, 51, 0, 239, 255, 1, 0, 196, 255, 216, 255, 241, 255, 7, 0, 36, 0, 41, 0, 40, 0, 23, 0, 24, 0, 245, 255, 254, 255, 218, 255, 211, 255, 200, 255, 173, 255, 195, 255, 201, 255, 3, 0, 252, 255, 75, 0, 16, 0, 73, 0, 10, 0, 6, 0, 226, 255, 171, 255, 230, 255, 172, 255, 8, 0, 238, 255, 255, 255, 3, 0, 252, 255, 7, 0, 13, 0, 10, 0, 28, 0, 14, 0, 17, 0, 13, 0, 7, 0, 13, 0, 27, 0, 14, 0, 19, 0, 239, 255, 248, 255, 225, 255, 232, 255, 241, 255, 255, 255, 34, 0, 17, 0, 66, 0, 249, 255, 42, 0, 5, 0, 30, 0, 9, 0, 253, 255, 16, 0, 253, 255, 27, 0, 31, 0, 224, 255, 237, 255, 201, 255, 201, 255, 238, 255, 207, 255, 28, 0, 240, 255, 43, 0, 34, 0, 241, 255, 11, 0, 211, 255, 232, 255, 209, 255, 200, 255, 46, 0, 26, 0, 23, 1, 13, 1, 219, 0, 225, 0, 109, 255, 126, 255, 190, 254, 203, 254, 61, 255, 53, 255, 90, 0, 83, 0, 244, 0, 8, 1, 110, 0, 136, 0, 145, 255, 153, 255, 72, 255, 55, 255, 253, 255, 209, 255, 120, 0, 71, 0, 4, 0, 242, 255, 183, 255, 213, 255, 213, 255, 0, 0, 33, 0, 38, 0, 48, 0, 25, 0, 236, 255, 229, 255, 194, 255, 234, 255, 167, 255, 244, 255, 237, 255, 37, 0, 73, 0, 76, 0, 71, 0, 37, 0, 50, 0, 2, 0, 239, 255, 192, 255, 201, 255, 178, 255, 232, 255, 236, 255, 243, 255, 249, 255, 14, 0, 10, 0, 9, 0, 9, 0, 238, 255, 255, 255, 11, 0, 26, 0, 26, 0, 17, 0, 31, 0, 10, 0, 30, 0, 16, 0, 247, 255, 4, 0, 240, 255, 22, 0, 245, 255, 16, 0, 255, 255, 255, 255, 29, 0, 21, 0, 9, 0, 6, 0, 220, 255, 222, 255, 204, 255, 203, 255, 217, 255, 208, 255, 7, 0, 254, 255, 36, 0, 36, 0, 0, 0, 9, 0, 237, 255, 247, 255, 16, 0, 10, 0, 32, 0, 10, 0, 32, 0, 5, 0, 27, 0, 3, 0, 4, 0, 1, 0, 234, 255, 250, 255, 231, 255, 239, 255, 252, 255, 243, 255, 234, 255, 226, 255, 220, 255, 250, 255, 243, 255, 45, 0, 249, 255, 33, 0, 1, 0, 2, 0, 21, 0, 242, 255, 39, 0, 246, 255, 24, 0, 239, 255, 14, 0, 247, 255, 14, 0, 12, 0, 240, 255, 2, 0, 244, 255, 10, 0, 254, 255, 16, 0, 246, 255, 5, 0, 225, 255, 236, 255, 214, 255, 215, 255, 233, 255, 223, 255, 211, 255, 203, 255, 217, 255, 216, 255, 84, 0, 74, 0, 216, 0, 202, 0, 172, 0, 165, 0, 221, 255, 216, 255, 46, 255, 55, 255, 65, 255, 91, 255, 63, 0, 79, 0, 238, 0, 222, 0, 145, 0, 115, 0, 22, 0, 13, 0, 241, 255, 3, 0, 224, 255, 252, 255, 217, 255, 234, 255, 252, 255, 248, 255, 255, 255, 237, 255, 221, 255, 210, 255, 221, 255, 217, 255, 219, 255, 214, 255, 242, 255, 239, 255, 24, 0, 6, 0, 48, 0, 18, 0, 22, 0, 13, 0, 222, 255, 242, 255, 210, 255, 233, 255, 144, 255, 136, 255, 164, 255, 134, 255, 124, 0, 105, 0, 251, 0, 248, 0, 126, 0, 138, 0, 114, 255, 128, 255, 243, 254, 241, 254, 111, 255, 102, 255, 79, 0, 83, 0, 243, 0, 6, 1, 176, 0, 201, 0, 2, 0, 22, 0, 240, 255, 242, 255, 25, 0, 10, 0, 248, 255, 226, 255, 239, 255, 216, 255, 9, 0, 247, 255, 1, 0, 241, 255, 235, 255, 231, 255, 227, 255, 239, 255, 226, 255, 248, 255, 226, 255, 246, 255, 243, 255, 234, 255, 17, 0, 225, 255, 20, 0, 224, 255, 0, 0, 238, 255, 232, 255, 248, 255, 222, 255, 243, 255, 247, 255, 253, 255, 15, 0, 11, 0, 21, 0, 17, 0, 255, 255, 9, 0, 212, 255, 245, 255, 222, 255, 5, 0, 7, 0, 25, 0, 25, 0, 14, 0, 15, 0, 244, 255, 220, 255, 203, 255, 213, 255, 225, 255, 244, 255, 16, 0, 250, 255, 12, 0, 238, 255, 246, 255, 215, 255, 219, 255, 244, 255, 250, 255, 21, 0, 21, 0, 1, 0, 251, 255, 247, 255, 240, 255, 245, 255, 238, 255, 253, 255, 0, 0, 253, 255, 9, 0, 246, 255, 248, 255, 254, 255, 242, 255, 11, 0, 251, 255, 9, 0, 250, 255, 241, 255, 234, 255, 244, 255, 250, 255, 239, 255, 253, 255, 245, 255, 251, 255, 13, 0, 8, 0, 244, 255, 248, 255, 246, 255, 12, 0, 4, 0, 34, 0, 250, 255, 17, 0, 255, 255, 252, 255, 18, 0, 251, 255, 30, 0, 12, 0, 236, 255, 227, 255, 216, 255, 214, 255, 237, 255, 251, 255, 234, 255, 2, 0, 11, 0, 27, 0, 4, 0, 1, 0, 40, 0, 29, 0, 201, 0, 188, 0, 179, 0, 161, 0, 221, 255, 209, 255, 72, 255, 73, 255, 81, 255, 86, 255, 17, 0, 26, 0, 207, 0, 214, 0, 207, 0, 206, 0, 243, 255, 243, 255, 252, 254, 5, 255, 56, 255, 75, 255, 235, 255, 255, 255, 2, 0, 9, 0, 243, 255, 232, 255, 244, 255, 218, 255, 16, 0, 236, 255, 35, 0, 10, 0, 20, 0, 8, 0, 252, 255, 250, 255, 227, 255, 241, 255, 246, 255, 3, 0, 14, 0, 14, 0, 2, 0, 1, 0, 243, 255, 247, 255, 240, 255, 246, 255, 249, 255, 2, 0, 63, 0, 76, 0, 105, 0, 123, 0, 234, 255, 247, 255, 150, 255, 152, 255, 216, 255, 209, 255, 9, 0, 250, 255, 21, 0, 2, 0, 8, 0, 251, 255, 3, 0, 0, 0, 0, 0, 8, 0, 234, 255, 247, 255, 236, 255, 243, 255, 1, 0, 249, 255, 18, 0, 6, 0, 12, 0, 7, 0, 251, 255, 0, 0, 249, 255, 0, 0, 253, 255, 255, 255, 4, 0, 254, 255, 22, 0, 6, 0, 28, 0, 12, 0, 1, 0, 253, 255, 250, 255, 253, 255, 5, 0, 10, 0, 0, 0, 7, 0, 250, 255, 250, 255, 254, 255, 248, 255, 254, 255, 252, 255, 251, 255, 255, 255, 12, 0, 21, 0, 14, 0, 23, 0, 251, 255, 7, 0, 240, 255, 255, 255, 242, 255, 253, 255, 2, 0, 8, 0, 248, 255, 248, 255, 239, 255, 235, 255, 248, 255, 245, 255, 5, 0, 0, 0, 15, 0, 4, 0, 5, 0, 250, 255, 3, 0, 253, 255, 249, 255, 249, 255, 5, 0, 7, 0, 20, 0, 22, 0, 255, 255, 255, 255, 254, 255, 243, 255, 2, 0, 245, 255, 254, 255, 252, 255, 249, 255, 255, 255, 12, 0, 24, 0, 39, 0, 49, 0, 16, 0, 12, 0, 188, 255, 176, 255, 112, 255, 106, 255, 218, 255, 223, 255, 92, 0, 107, 0, 46, 0, 62, 0, 1, 0, 11, 0, 254, 255, 254, 255, 243, 255, 237, 255, 3, 0, 0, 0, 22, 0, 19, 0, 1, 0, 1, 0, 236, 255, 241, 255, 243, 255, 241, 255, 3, 0, 253, 255, 31, 0, 25, 0, 15, 0, 10, 0, 248, 255, 248, 255, 254, 255, 255, 255, 10, 0, 18, 0, 2, 0, 14, 0, 108, 255, 111, 255, 29, 255, 25, 255, 219, 255, 213, 255, 182, 0, 172, 0, 241, 0, 238, 0, 96, 0, 100, 0, 144, 255, 143, 255, 67, 255, 63, 255, 193, 255, 186, 255, 178, 0, 167, 0, 218, 0, 211, 0, 60, 0, 60, 0, 245, 255, 250, 255, 250, 255, 0, 0, 248, 255, 250, 255, 4, 0, 7, 0, 13, 0, 16, 0, 3, 0, 3, 0, 240, 255, 244, 255, 241, 255, 247, 255, 254, 255, 4, 0, 253, 255, 6, 0, 254, 255, 8, 0, 245, 255, 250, 255, 235, 255, 233, 255, 244, 255, 242, 255, 248, 255, 252, 255, 251, 255, 4, 0, 248, 255, 1, 0, 248, 255, 0, 0, 6, 0, 6, 0, 252, 255, 248, 255, 239, 255, 239, 255, 245, 255, 252, 255, 3, 0, 14, 0, 12, 0, 23, 0, 253, 255, 3, 0, 245, 255, 242, 255, 4, 0, 2, 0, 18, 0, 23, 0, 19, 0, 29, 0, 251, 255, 7, 0, 224, 255, 236, 255, 221, 255, 230, 255, 244, 255, 247, 255, 18, 0, 20, 0, 19, 0, 24, 0, 246, 255, 255, 255, 217, 255, 231, 255, 221, 255, 239, 255, 240, 255, 254, 255, 239, 255, 243, 255, 249, 255, 243, 255, 255, 255, 245, 255, 250, 255, 243, 255, 254, 255, 0, 0, 1, 0, 13, 0, 13, 0, 23, 0, 14, 0, 15, 0, 9, 0, 4, 0, 6, 0, 255, 255, 251, 255, 250, 255, 246, 255, 1, 0, 239, 255, 252, 255, 233, 255, 241, 255, 235, 255, 238, 255, 4, 0, 5, 0, 26, 0, 28, 0, 8, 0, 13, 0, 2, 0, 9, 0, 237, 255, 242, 255, 154, 255, 152, 255, 179, 255, 175, 255, 132, 0, 128, 0, 218, 0, 212, 0, 73, 0, 69, 0, 125, 255, 121, 255, 236, 254, 231, 254, 69, 255, 69, 255, 50, 0, 49, 0, 206, 0, 201, 0, 159, 0, 151, 0, 214, 255, 204, 255, 177, 255, 175, 255, 251, 255, 0, 0, 241, 255, 250, 255, 246, 255, 0, 0, 12, 0, 12, 0, 22, 0, 13, 0, 3, 0, 255, 255, 239, 255, 237, 255, 245, 255, 248, 255, 245, 255, 253, 255, 2, 0, 6, 0, 25, 0, 24, 0, 14, 0, 10, 0, 243, 255, 240, 255, 249, 255, 245, 255, 231, 255, 225, 255, 39, 0, 37, 0, 197, 0, 199, 0, 128, 0, 133, 0, 162, 255, 170, 255, 80, 255, 82, 255, 159, 255, 151, 255, 24, 0, 13, 0, 60, 0, 53, 0, 26, 0, 28, 0, 242, 255, 249, 255, 248, 255, 252, 255, 16, 0, 13, 0, 9, 0, 255, 255, 1, 0, 246, 255, 246, 255, 244, 255, 255, 255, 4, 0, 12, 0, 17, 0, 7, 0, 10, 0, 255, 255, 254, 255, 244, 255, 241, 255, 248, 255, 249, 255, 1, 0, 6, 0, 3, 0, 8, 0, 1, 0, 2, 0, 248, 255, 248, 255, 243, 255, 241, 255, 2, 0, 251, 255, 11, 0, 3, 0, 3, 0, 254, 255, 10, 0, 6, 0, 0, 0, 2, 0, 249, 255, 254, 255, 1, 0, 3, 0, 2, 0, 251, 255, 3, 0, 248, 255, 247, 255, 240, 255, 249, 255, 250, 255, 0, 0, 11, 0, 2, 0, 16, 0, 8, 0, 13, 0, 6, 0, 255, 255, 13, 0, 3, 0, 2, 0, 252, 255, 240, 255, 241, 255, 243, 255, 249, 255, 1, 0, 5, 0, 11, 0, 7, 0, 254, 255, 248, 255, 2, 0, 252, 255, 4, 0, 254, 255, 4, 0, 255, 255, 17, 0, 10, 0, 11, 0, 4, 0, 4, 0, 1, 0, 237, 255, 237, 255, 220, 255, 225, 255, 243, 255, 245, 255, 0, 0, 253, 255, 254, 255, 253, 255, 255, 255, 255, 255, 242, 255, 247, 255, 240, 255, 253, 255, 10, 0, 18, 0, 15, 0, 18, 0, 1, 0, 2, 0, 246, 255, 243, 255, 250, 255, 247, 255, 10, 0, 6, 0, 12, 0, 5, 0, 8, 0, 2, 0, 246, 255, 237, 255, 39, 0, 34, 0, 126, 0, 122, 0, 22, 0, 12, 0, 106, 255, 100, 255, 113, 255, 112, 255, 15, 0, 17, 0, 167, 0, 176, 0, 160, 0, 166, 0, 13, 0, 10, 0, 114, 255, 108, 255, 84, 255, 82, 255, 237, 255, 243, 255, 76, 0, 88, 0, 0, 0, 8, 0, 242, 255, 238, 255, 26, 0, 7, 0, 11, 0, 247, 255, 255, 255, 249, 255, 246, 255, 254, 255, 241, 255, 0, 0, 247, 255, 3, 0, 255, 255, 253, 255, 9, 0, 252, 255, 12, 0, 255, 255, 13, 0, 9, 0, 249, 255, 1, 0, 238, 255, 248, 255, 242, 255, 250, 255, 253, 255, 252, 255, 22, 0, 8, 0, 14, 0, 253, 255, 3, 0, 245, 255, 6, 0, 255, 255, 255, 255, 2, 0, 246, 255, 254, 255, 245, 255, 249, 255, 11, 0, 3, 0, 21, 0, 7, 0, 10, 0, 255, 255, 0, 0, 253, 255, 241, 255, 250, 255, 238, 255, 251, 255, 249, 255, 250, 255, 5, 0, 249, 255, 10, 0, 250, 255, 255, 255, 248, 255, 250, 255, 1, 0, 2, 0, 19, 0, 6, 0, 21, 0, 13, 0, 16, 0, 20, 0, 11, 0, 250, 255, 245, 255, 227, 255, 233, 255, 241, 255, 255, 255, 6, 0, 24, 0, 13, 0, 24, 0, 11, 0, 8, 0, 2, 0, 247, 255, 250, 255, 238, 255, 249, 255, 239, 255, 1, 0, 251, 255, 13, 0, 12, 0, 10, 0, 9, 0, 252, 255, 249, 255, 250, 255, 244, 255, 7, 0, 255, 255, 12, 0, 4, 0, 0, 0, 252, 255, 255, 255, 2, 0, 254, 255, 6, 0, 250, 255, 254, 255, 252, 255, 252, 255, 254, 255, 249, 255, 225, 255, 216, 255, 168, 255, 165, 255, 226, 255, 227, 255, 108, 0, 104, 0, 157, 0, 153, 0, 78, 0, 71, 0, 169, 255, 165, 255, 90, 255, 97, 255, 184, 255, 193, 255, 90, 0, 96, 0, 138, 0, 136, 0, 56, 0, 47, 0, 24, 0, 19, 0, 24, 0, 25, 0, 250, 255, 254, 255, 236, 255, 241, 255, 240, 255, 234, 255, 253, 255, 240, 255, 10, 0, 1, 0, 9, 0, 4, 0, 248, 255, 251, 255, 244, 255, 252, 255, 252, 255, 1, 0, 0, 0, 4, 0, 0, 0, 4, 0, 251, 255, 3, 0, 223, 255, 235, 255, 150, 255, 158, 255, 184, 255, 191, 255, 92, 0, 95, 0, 178, 0, 175, 0, 96, 0, 94, 0, 179, 255, 177, 255, 92, 255, 88, 255, 149, 255, 148, 255, 38, 0, 40, 0, 129, 0, 131, 0, 67, 0, 67, 0, 9, 0, 6, 0, 8, 0, 6, 0, 251, 255, 253, 255, 233, 255, 242, 255, 231, 255, 246, 255, 246, 255, 255, 255, 255, 255, 252, 255, 13, 0, 1, 0, 16, 0, 3, 0, 3, 0, 252, 255, 240, 255, 243, 255, 235, 255, 242, 255, 247, 255, 250, 255, 1, 0, 252, 255, 7, 0, 4, 0, 244, 255, 245, 255, 240, 255, 246, 255, 245, 255, 0, 0, 237, 255, 246, 255, 2, 0, 7, 0, 7, 0, 11, 0, 3, 0, 8, 0, 250, 255, 0, 0, 248, 255, 247, 255, 3, 0, 253, 255, 253, 255, 245, 255, 4, 0, 252, 255, 253, 255, 251, 255, 244, 255, 250, 255, 247, 255, 252, 255, 241, 255, 245, 255, 0, 0, 7, 0, 11, 0, 20, 0, 8, 0, 20, 0, 236, 255, 250, 255, 225, 255, 238, 255, 253, 255, 7, 0, 255, 255, 9, 0, 255, 255, 8, 0, 251, 255, 0, 0, 248, 255, 247, 255, 254, 255, 248, 255, 245, 255, 239, 255, 250, 255, 246, 255, 3, 0, 1, 0, 8, 0, 7, 0, 8, 0, 0, 0, 2, 0, 248, 255, 0, 0, 253, 255, 252, 255, 255, 255, 255, 255, 6, 0, 6, 0, 12, 0, 12, 0, 7, 0, 9, 0, 254, 255, 254, 255, 244, 255, 240, 255, 240, 255, 243, 255, 254, 255, 5, 0, 14, 0, 14, 0, 16, 0, 20, 0, 11, 0, 5, 0, 244, 255, 34, 0, 25, 0, 116, 0, 117, 0, 81, 0, 85, 0, 216, 255, 224, 255, 160, 255, 161, 255, 185, 255, 178, 255, 39, 0, 30, 0, 135, 0, 125, 0, 100, 0, 94, 0, 221, 255, 222, 255, 115, 255, 119, 255, 156, 255, 164, 255, 244, 255, 248, 255, 253, 255, 252, 255, 4, 0, 2, 0, 21, 0, 18, 0, 16, 0, 20, 0, 251, 255, 8, 0, 230, 255, 241, 255, 242, 255, 246, 255, 4, 0, 0, 0, 10, 0, 3, 0, 13, 0, 10, 0, 6, 0, 9, 0, 2, 0, 8, 0, 255, 255, 0, 0, 0, 0, 247, 255, 9, 0, 1, 0, 12, 0, 9, 0, 254, 255, 3, 0, 253, 255, 9, 0, 6, 0, 16, 0, 255, 255, 1, 0, 244, 255, 240, 255, 243, 255, 240, 255, 251, 255, 253, 255, 245, 255, 246, 255, 238, 255, 240, 255, 252, 255, 253, 255, 11, 0, 8, 0, 17, 0, 14, 0, 15, 0, 13, 0, 17, 0, 12, 0, 7, 0, 2, 0, 251, 255, 247, 255, 254, 255, 254, 255, 251, 255, 0, 0, 252, 255, 1, 0, 249, 255, 254, 255, 5, 0, 4, 0, 15, 0, 10, 0, 0, 0, 0, 0, 250, 255, 250, 255, 241, 255, 240, 255, 245, 255, 246, 255, 8, 0, 7, 0, 16, 0, 16, 0, 6, 0, 11, 0, 239, 255, 243, 255, 234, 255, 232, 255, 245, 255, 238, 255, 8, 0, 1, 0, 24, 0, 24, 0, 18, 0, 23, 0, 248, 255, 255, 255, 240, 255, 240, 255, 4, 0, 249, 255, 10, 0, 251, 255, 11, 0, 1, 0, 4, 0, 3, 0, 255, 255, 2, 0, 2, 0, 6, 0, 0, 0, 255, 255, 12, 0, 5, 0, 254, 255, 251, 255, 241, 255, 242, 255, 255, 255, 1, 0, 20, 0, 25, 0, 55, 0, 57, 0, 27, 0, 27, 0, 200, 255, 199, 255, 165, 255, 164, 255, 221, 255, 220, 255, 26, 0, 22, 0, 17, 0, 15, 0, 4, 0, 9, 0, 250, 255, 254, 255, 238, 255, 240, 255, 250, 255, 250, 255, 3, 0, 253, 255, 6, 0, 3, 0, 255, 255, 5, 0, 248, 255, 2, 0, 4, 0, 13, 0, 12, 0, 10, 0, 5, 0, 247, 255, 7, 0, 245, 255, 9, 0, 253, 255, 14, 0, 17, 0, 10, 0, 20, 0, 203, 255, 208, 255, 160, 255, 161, 255, 206, 255, 201, 255, 37, 0, 30, 0, 96, 0, 98, 0, 65, 0, 74, 0, 235, 255, 248, 255, 187, 255, 200, 255, 228, 255, 236, 255, 50, 0, 52, 0, 62, 0, 56, 0, 19, 0, 7, 0, 0, 0, 246, 255, 7, 0, 0, 0, 252, 255, 253, 255, 251, 255, 1, 0, 10, 0, 10, 0, 9, 0, 255, 255, 253, 255, 239, 255, 254, 255, 245, 255, 7, 0, 9, 0, 248, 255, 3, 0, 239, 255, 251, 255, 245, 255, 246, 255, 1, 0, 247, 255, 19, 0, 10, 0, 11, 0, 7, 0, 3, 0, 9, 0, 0, 0, 10, 0, 242, 255, 247, 255, 240, 255, 238, 255, 0, 0, 248, 255, 8, 0, 3, 0, 245, 255, 250, 255, 247, 255, 255, 255, 248, 255, 4, 0, 243, 255, 255, 255, 5, 0, 7, 0, 9, 0, 7, 0, 10, 0, 4, 0, 5, 0, 252, 255, 254, 255, 251, 255, 2, 0, 5, 0, 4, 0, 10, 0, 5, 0, 9, 0, 0, 0, 251, 255, 2, 0, 245, 255, 9, 0, 252, 255, 17, 0, 11, 0, 6, 0, 15, 0, 242, 255, 3, 0, 245, 255, 2, 0, 244, 255, 249, 255, 251, 255, 249, 255, 12, 0, 8, 0, 13, 0, 14, 0, 250, 255, 2, 0, 241, 255, 247, 255, 254, 255, 255, 255, 254, 255, 251, 255, 250, 255, 244, 255, 249, 255, 245, 255, 254, 255, 250, 255, 3, 0, 254, 255, 253, 255, 252, 255, 7, 0, 7, 0, 3, 0, 4, 0, 247, 255, 249, 255, 255, 255, 254, 255, 8, 0, 8, 0, 252, 255, 253, 255, 214, 255, 217, 255, 226, 255, 234, 255, 40, 0, 45, 0, 76, 0, 74, 0, 40, 0, 39, 0, 222, 255, 223, 255, 186, 255, 189, 255, 211, 255, 217, 255, 13, 0, 17, 0, 66, 0, 66, 0, 71, 0, 66, 0, 20, 0, 16, 0, 254, 255, 255, 255, 10, 0, 12, 0, 250, 255, 254, 255, 242, 255, 248, 255, 244, 255, 247, 255, 239, 255, 243, 255, 245, 255, 254, 255, 251, 255, 2, 0, 1, 0, 5, 0, 0, 0, 2, 0, 252, 255, 255, 255, 248, 255, 0, 0, 235, 255, 248, 255, 234, 255, 248, 255, 250, 255, 0, 0, 18, 0, 11, 0, 37, 0, 27, 0, 48, 0, 42, 0, 27, 0, 29, 0, 230, 255, 240, 255, 212, 255, 223, 255, 245, 255, 248, 255, 9, 0, 5, 0, 10, 0, 9, 0, 8, 0, 12, 0, 246, 255, 253, 255, 232, 255, 242, 255, 237, 255, 246, 255, 255, 255, 5, 0, 11, 0, 17, 0, 254, 255, 2, 0, 240, 255, 241, 255, 242, 255, 242, 255, 250, 255, 251, 255, 254, 255, 4, 0, 11, 0, 18, 0, 16, 0, 20, 0, 244, 255, 247, 255, 231, 255, 230, 255, 244, 255, 245, 255, 255, 255, 10, 0, 4, 0, 17, 0, 5, 0, 15, 0, 2, 0, 7, 0, 247, 255, 245, 255, 244, 255, 243, 255, 244, 255, 249, 255, 244, 255, 254, 255, 245, 255, 0, 0, 245, 255, 247, 255, 255, 255, 251, 255, 12, 0, 7, 0, 16, 0, 16, 0, 0, 0, 8, 0, 248, 255, 1, 0, 1, 0, 2, 0, 2, 0, 254, 255, 0, 0, 255, 255, 246, 255, 248, 255, 250, 255, 252, 255, 10, 0, 7, 0, 15, 0, 5, 0, 8, 0, 255, 255, 250, 255, 247, 255, 2, 0, 4, 0, 254, 255, 0, 0, 243, 255, 247, 255, 251, 255, 253, 255, 251, 255, 253, 255, 255, 255, 3, 0, 246, 255, 251, 255, 239, 255, 247, 255, 251, 255, 255, 255, 0, 0, 3, 0, 1, 0, 5, 0, 248, 255, 247, 255, 242, 255, 238, 255, 246, 255, 244, 255, 4, 0, 2, 0, 18, 0, 20, 0, 17, 0, 21, 0, 10, 0, 11, 0, 6, 0, 3, 0, 255, 255, 249, 255, 244, 255, 241, 255, 2, 0, 2, 0, 5, 0, 7, 0, 6, 0, 9, 0, 32, 0, 30, 0, 11, 0, 3, 0, 237, 255, 228, 255, 239, 255, 228, 255, 254, 255, 246, 255, 34, 0, 33, 0, 45, 0, 45, 0, 3, 0, 0, 0, 203, 255, 200, 255, 197, 255, 195, 255, 241, 255, 245, 255, 16, 0, 26, 0, 11, 0, 27, 0, 4, 0, 17, 0, 2, 0, 4, 0, 246, 255, 242, 255, 254, 255, 251, 255, 7, 0, 7, 0, 253, 255, 1, 0, 250, 255, 255, 255, 250, 255, 253, 255, 8, 0, 1, 0, 12, 0, 255, 255, 6, 0, 249, 255, 0, 0, 246, 255, 240, 255, 240, 255, 239, 255, 249, 255, 254, 255, 9, 0, 6, 0, 13, 0, 4, 0, 3, 0, 254, 255, 249, 255, 251, 255, 251, 255, 253, 255, 2, 0, 254, 255, 10, 0, 2, 0, 11, 0, 11, 0, 8, 0, 11, 0, 2, 0, 9, 0, 1, 0, 12, 0, 9, 0, 3, 0, 12, 0, 245, 255, 1, 0, 247, 255, 252, 255, 254, 255, 253, 255, 255, 255, 252, 255, 4, 0, 6, 0, 7, 0, 15, 0, 254, 255, 9, 0, 238, 255, 247, 255, 241, 255, 240, 255, 7, 0, 253, 255, 7, 0, 253, 255, 5, 0, 251, 255, 6, 0, 255, 255, 1, 0, 0, 0, 255, 255, 0, 0, 252, 255, 254, 255, 4, 0, 5, 0, 251, 255, 251, 255, 239, 255, 239, 255, 252, 255, 255, 255, 3, 0, 12, 0, 2, 0, 16, 0, 4, 0, 16, 0, 2, 0, 5, 0, 255, 255, 243, 255, 0, 0, 237, 255, 8, 0, 250, 255, 8, 0, 4, 0, 2, 0, 4, 0, 1, 0, 0, 0, 6, 0, 255, 255, 13, 0, 2, 0, 250, 255, 244, 255, 196, 255, 206, 255, 192, 255, 208, 255, 248, 255, 2, 0, 27, 0, 31, 0, 31, 0, 31, 0, 250, 255, 253, 255, 216, 255, 225, 255, 229, 255, 238, 255, 5, 0, 8, 0, 39, 0, 32, 0, 26, 0, 15, 0, 251, 255, 243, 255, 248, 255, 240, 255, 252, 255, 246, 255, 10, 0, 6, 0, 9, 0, 5, 0, 0, 0, 255, 255, 3, 0, 5, 0, 11, 0, 10, 0, 13, 0, 9, 0, 4, 0, 251, 255, 254, 255, 244, 255, 251, 255, 245, 255, 0, 0, 255, 255, 5, 0, 8, 0, 247, 255, 249, 255, 214, 255, 216, 255, 188, 255, 192, 255, 227, 255, 229, 255, 36, 0, 32, 0, 41, 0, 38, 0, 251, 255, 255, 255, 212, 255, 218, 255, 194, 255, 200, 255, 213, 255, 217, 255, 8, 0, 7, 0, 23, 0, 20, 0, 10, 0, 6, 0, 6, 0, 255, 255, 6, 0, 254, 255, 8, 0, 6, 0, 3, 0, 5, 0, 1, 0, 2, 0, 7, 0, 1, 0, 9, 0, 254, 255, 12, 0, 3, 0, 15, 0, 9, 0, 17, 0, 16, 0, 12, 0, 14, 0, 1, 0, 255, 255, 253, 255, 247, 255, 9, 0, 3, 0, 21, 0, 15, 0, 17, 0, 13, 0, 14, 0, 11, 0, 9, 0, 4, 0, 4, 0, 253, 255, 6, 0, 254, 255, 13, 0, 6, 0, 17, 0, 14, 0, 6, 0, 6, 0, 253, 255, 255, 255, 254, 255, 0, 0, 9, 0, 8, 0, 13, 0, 12, 0, 6, 0, 4, 0, 10, 0, 8, 0, 11, 0, 10, 0, 252, 255, 254, 255, 246, 255, 251, 255, 251, 255, 255, 255, 8, 0, 7, 0, 18, 0, 11, 0, 17, 0, 8, 0, 12, 0, 7, 0, 255, 255, 255, 255, 252, 255, 252, 255, 3, 0, 0, 0, 5, 0, 254, 255, 15, 0, 5, 0, 15, 0, 5, 0, 5, 0, 255, 255, 1, 0, 253, 255, 254, 255, 249, 255, 6, 0, 254, 255, 4, 0, 253, 255, 2, 0, 250, 255, 9, 0, 1, 0, 7, 0, 255, 255, 7, 0, 254, 255, 2, 0, 254, 255, 1, 0, 0, 0, 255, 255, 254, 255, 1, 0, 253, 255, 12, 0, 4, 0, 2, 0, 251, 255, 250, 255, 247, 255, 238, 255, 239, 255, 227, 255, 233, 255, 6, 0, 6, 0, 12, 0, 9, 0, 243, 255, 245, 255, 227, 255, 230, 255, 190, 255, 195, 255, 194, 255, 200, 255, 253, 255, 253, 255, 37, 0, 32, 0, 49, 0, 40, 0, 2, 0, 254, 255, 223, 255, 222, 255, 2, 0, 251, 255, 8, 0, 0, 0, 4, 0, 1, 0, 11, 0, 9, 0, 255, 255, 0, 0, 4, 0, 6, 0, 5, 0, 7, 0, 6, 0, 5, 0, 9, 0, 7, 0, 4, 0, 5, 0, 2, 0, 8, 0, 0, 0, 9, 0, 6, 0, 13, 0, 12, 0, 10, 0, 12, 0, 3, 0, 11, 0, 255, 255, 3, 0, 251, 255, 7, 0, 5, 0, 3, 0, 3, 0, 253, 255, 250, 255, 9, 0, 255, 255, 10, 0, 255, 255, 1, 0, 252, 255, 3, 0, 2, 0, 3, 0, 4, 0, 255, 255, 0, 0, 2, 0, 254, 255, 1, 0, 251, 255, 4, 0, 253, 255, 7, 0, 1, 0, 6, 0, 0, 0, 7, 0, 255, 255, 8, 0, 255, 255, 10, 0, 1, 0, 9, 0, 255, 255, 14, 0, 4, 0, 15, 0, 6, 0, 3, 0, 251, 255, 2, 0, 250, 255, 3, 0, 253, 255, 3, 0, 252, 255, 7, 0, 255, 255, 9, 0, 254, 255, 5, 0, 250, 255, 6, 0, 253, 255, 11, 0, 4, 0, 1, 0, 255, 255, 255, 255, 254, 255, 4, 0, 1, 0, 0, 0, 251, 255, 3, 0, 253, 255, 7, 0, 5, 0, 4, 0, 7, 0, 251, 255, 255, 255, 248, 255, 251, 255, 1, 0, 2, 0, 2, 0, 4, 0, 254, 255, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 4, 0, 2, 0, 4, 0, 3, 0, 254, 255, 1, 0, 250, 255, 253, 255, 242, 255, 245, 255, 252, 255, 255, 255, 36, 0, 32, 0, 54, 0, 46, 0, 21, 0, 16, 0, 223, 255, 226, 255, 211, 255, 217, 255, 245, 255, 246, 255, 2, 0, 0, 0, 251, 255, 251, 255, 251, 255, 250, 255, 250, 255, 251, 255, 252, 255, 255, 255, 0, 0, 2, 0, 255, 255, 2, 0, 254, 255, 254, 255, 254, 255, 250, 255, 3, 0, 255, 255, 8, 0, 6, 0, 4, 0, 4, 0, 6, 0, 3, 0, 0, 0, 253, 255, 254, 255, 253, 255, 30, 0, 28, 0, 26, 0, 26, 0, 234, 255, 240, 255, 213, 255, 220, 255, 225, 255, 227, 255, 6, 0, 2, 0, 22, 0, 18, 0, 9, 0, 8, 0, 250, 255, 253, 255, 221, 255, 228, 255, 219, 255, 226, 255, 2, 0, 2, 0, 19, 0, 16, 0, 7, 0, 4, 0, 252, 255, 250, 255, 245, 255, 245, 255, 248, 255, 248, 255, 255, 255, 1, 0, 1, 0, 4, 0, 255, 255, 3, 0, 254, 255, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 254, 255, 253, 255, 5, 0, 2, 0, 7, 0, 4, 0, 2, 0, 1, 0, 254, 255, 253, 255, 1, 0, 255, 255, 5, 0, 1, 0, 2, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 1, 0, 2, 0, 6, 0, 5, 0, 8, 0, 5, 0, 1, 0, 255, 255, 246, 255, 246, 255, 252, 255, 253, 255, 1, 0, 3, 0, 254, 255, 0, 0, 253, 255, 254, 255, 253, 255, 254, 255, 4, 0, 3, 0, 0, 0, 255, 255, 249, 255, 247, 255, 2, 0, 254, 255, 5, 0, 1, 0, 253, 255, 254, 255, 251, 255, 255, 255, 254, 255, 2, 0, 4, 0, 4, 0, 3, 0, 0, 0, 0, 0, 253, 255, 1, 0, 254, 255, 254, 255, 253, 255, 254, 255, 254, 255, 254, 255, 255, 255, 251, 255, 251, 255, 0, 0, 255, 255, 3, 0, 1, 0, 2, 0, 0, 0, 255, 255, 0, 0, 254, 255, 253, 255, 1, 0, 254, 255, 0, 0, 255, 255, 1, 0, 2, 0, 1, 0, 2, 0, 0, 0, 255, 255, 3, 0, 255, 255, 1, 0, 255, 255, 11, 0, 9, 0, 252, 255, 255, 255, 202, 255, 215, 255, 212, 255, 223, 255, 13, 0, 14, 0, 45, 0, 41, 0, 51, 0, 45, 0, 23, 0, 20, 0, 241, 255, 244, 255, 219, 255, 225, 255, 233, 255, 236, 255, 24, 0, 20, 0, 30, 0, 23, 0, 5, 0, 2, 0, 255, 255, 253, 255, 249, 255, 248, 255, 0, 0, 255, 255, 6, 0, 3, 0, 1, 0, 254, 255, 5, 0, 2, 0, 1, 0, 254, 255, 255, 255, 253, 255, 0, 0, 0, 0, 251, 255, 251, 255, 253, 255, 253, 255, 255, 255, 0, 0, 253, 255, 1, 0, 255, 255, 3, 0, 255, 255, 0, 0, 242, 255, 243, 255, 239, 255, 239, 255, 8, 0, 5, 0, 17, 0, 14, 0, 254, 255, 255, 255, 251, 255, 253, 255, 2, 0, 2, 0, 3, 0, 2, 0, 1, 0, 1, 0, 249, 255, 250, 255, 255, 255, 254, 255, 6, 0, 2, 0, 2, 0, 254, 255, 0, 0, 255, 255, 252, 255, 253, 255, 255, 255, 1, 0, 1, 0, 2, 0, 254, 255, 253, 255, 1, 0, 255, 255, 253, 255, 253, 255, 253, 255, 255, 255, 254, 255, 2, 0, 249, 255, 254, 255, 0, 0, 1, 0, 3, 0, 2, 0, 0, 0, 254, 255, 3, 0, 1, 0, 3, 0, 3, 0, 254, 255, 0, 0, 254, 255, 1, 0, 255, 255, 1, 0, 250, 255, 251, 255, 252, 255, 250, 255, 3, 0, 254, 255, 4, 0, 0, 0, 3, 0, 0, 0, 253, 255, 254, 255, 250, 255, 254, 255, 253, 255, 255, 255, 2, 0, 0, 0, 3, 0, 0, 0, 0, 0, 255, 255, 0, 0, 2, 0, 252, 255, 1, 0, 251, 255, 1, 0, 0, 0, 4, 0, 255, 255, 1, 0, 3, 0, 3, 0, 5, 0, 3, 0, 253, 255, 252, 255, 254, 255, 255, 255, 254, 255, 0, 0, 6, 0, 5, 0, 26, 0, 18, 0, 18, 0, 7, 0, 4, 0, 250, 255, 4, 0, 250, 255, 1, 0, 250, 255, 253, 255, 252, 255, 252, 255, 253, 255, 4, 0, 5, 0, 6, 0, 6, 0, 0, 0, 1, 0, 255, 255, 1, 0, 248, 255, 251, 255, 250, 255, 252, 255, 1, 0, 2, 0, 254, 255, 1, 0, 1, 0, 4, 0, 1, 0, 3, 0, 249, 255, 251, 255, 237, 255, 242, 255, 251, 255, 253, 255, 38, 0, 32, 0, 43, 0, 33, 0, 12, 0, 6, 0, 251, 255, 248, 255, 251, 255, 251, 255, 9, 0, 10, 0, 32, 0, 28, 0, 40, 0, 34, 0, 6, 0, 5, 0, 225, 255, 230, 255, 241, 255, 246, 255, 1, 0, 7, 0, 253, 255, 4, 0, 0, 0, 6, 0, 252, 255, 0, 0, 248, 255, 252, 255, 249, 255, 255, 255, 246, 255, 0, 0, 246, 255, 1, 0, 244, 255, 253, 255, 245, 255, 252, 255, 252, 255, 0, 0, 253, 255, 0, 0, 249, 255, 253, 255, 252, 255, 254, 255, 0, 0, 1, 0, 249, 255, 252, 255, 249, 255, 252, 255, 1, 0, 4, 0, 255, 255, 1, 0, 250, 255, 252, 255, 249, 255, 252, 255, 250, 255, 255, 255, 250, 255, 3, 0, 244, 255, 0, 0, 244, 255, 0, 0, 246, 255, 254, 255, 251, 255, 255, 255, 253, 255, 2, 0, 246, 255, 253, 255, 250, 255, 1, 0, 253, 255, 3, 0, 253, 255, 0, 0, 5, 0, 6, 0, 255, 255, 0, 0, 248, 255, 251, 255, 255, 255, 1, 0, 2, 0, 2, 0, 2, 0, 1, 0, 0, 0, 0, 0, 255, 255, 1, 0, 254, 255, 2, 0, 254, 255, 2, 0, 255, 255, 1, 0, 253, 255, 251, 255, 253, 255, 249, 255, 1, 0, 254, 255, 4, 0, 3, 0, 2, 0, 4, 0, 253, 255, 0, 0, 254, 255, 255, 255, 254, 255, 253, 255, 1, 0, 255, 255, 2, 0, 1, 0, 0, 0, 1, 0, 4, 0, 4, 0, 2, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 253, 255, 0, 0, 14, 0, 14, 0, 21, 0, 16, 0, 10, 0, 3, 0, 246, 255, 243, 255, 222, 255, 227, 255, 251, 255, 1, 0, 39, 0, 40, 0, 41, 0, 39, 0, 28, 0, 26, 0, 0, 0, 0, 0, 239, 255, 243, 255, 253, 255, 1, 0, 0, 0, 4, 0, 254, 255, 2, 0, 251, 255, 255, 255, 250, 255, 254, 255, 253, 255, 2, 0, 251, 255, 1, 0, 252, 255, 2, 0, 250, 255, 254, 255, 251, 255, 255, 255, 251, 255, 1, 0, 243, 255, 253, 255, 249, 255, 3, 0, 254, 255, 6, 0, 251, 255, 0, 0, 248, 255, 252, 255, 248, 255, 251, 255, 4, 0, 4, 0, 249, 255, 249, 255, 218, 255, 221, 255, 234, 255, 233, 255, 21, 0, 15, 0, 33, 0, 28, 0, 11, 0, 14, 0, 250, 255, 1, 0, 253, 255, 2, 0, 253, 255, 0, 0, 253, 255, 0, 0, 255, 255, 2, 0, 249, 255, 254, 255, 248, 255, 252, 255, 249, 255, 254, 255, 248, 255, 254, 255, 245, 255, 254, 255, 248, 255, 1, 0, 251, 255, 2, 0, 252, 255, 255, 255, 253, 255, 254, 255, 253, 255, 253, 255, 251, 255, 255, 255, 249, 255, 1, 0, 249, 255, 2, 0, 254, 255, 4, 0, 253, 255, 255, 255, 254, 255, 252, 255, 6, 0, 1, 0, 4, 0, 0, 0, 0, 0, 254, 255, 253, 255, 254, 255, 1, 0, 1, 0, 7, 0, 5, 0, 3, 0, 0, 0, 254, 255, 252, 255, 250, 255, 251, 255, 254, 255, 255, 255, 3, 0, 4, 0, 254, 255, 255, 255, 254, 255, 255, 255, 255, 255, 0, 0, 253, 255, 255, 255, 3, 0, 5, 0, 0, 0, 4, 0, 250, 255, 254, 255, 250, 255, 253, 255, 0, 0, 0, 0, 5, 0, 3, 0, 0, 0, 252, 255, 255, 255, 251, 255, 3, 0, 255, 255, 3, 0, 255, 255, 6, 0, 2, 0, 4, 0, 255, 255, 4, 0, 255, 255, 5, 0, 0, 0, 255, 255, 253, 255, 1, 0, 2, 0, 0, 0, 3, 0, 249, 255, 253, 255, 248, 255, 251, 255, 254, 255, 255, 255, 8, 0, 8, 0, 4, 0, 6, 0, 248, 255, 251, 255, 250, 255, 251, 255, 1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 0, 0, 7, 0, 9, 0, 254, 255, 0, 0, 240, 255, 242, 255, 2, 0, 254, 255, 21, 0, 11, 0, 19, 0, 10, 0, 8, 0, 2, 0, 250, 255, 248, 255, 1, 0, 255, 255, 16, 0, 12, 0, 25, 0, 19, 0, 33, 0, 27, 0, 17, 0, 11, 0, 253, 255, 249, 255, 0, 0, 252, 255, 1, 0, 255, 255, 251, 255, 0, 0, 247, 255, 255, 255, 249, 255, 0, 0, 255, 255, 2, 0, 251, 255, 254, 255, 251, 255, 255, 255, 253, 255, 2, 0, 246, 255, 253, 255, 246, 255, 252, 255, 252, 255, 0, 0, 252, 255, 0, 0, 247, 255, 252, 255, 244, 255, 252, 255, 252, 255, 3, 0, 1, 0, 8, 0, 251, 255, 4, 0, 245, 255, 0, 0, 245, 255, 254, 255, 253, 255, 3, 0, 0, 0, 2, 0, 251, 255, 251, 255, 254, 255, 254, 255, 253, 255, 254, 255, 252, 255, 254, 255, 8, 0, 9, 0, 4, 0, 3, 0, 249, 255, 249, 255, 254, 255, 252, 255, 1, 0, 254, 255, 1, 0, 253, 255, 2, 0, 255, 255, 2, 0, 255, 255, 255, 255, 254, 255, 254, 255, 254, 255, 0, 0, 1, 0, 255, 255, 0, 0, 253, 255, 254, 255, 2, 0, 2, 0, 4, 0, 3, 0, 4, 0, 2, 0, 0, 0, 255, 255, 253, 255, 255, 255, 2, 0, 5, 0, 1, 0, 5, 0, 254, 255, 1, 0, 2, 0, 2, 0, 2, 0, 0, 0, 253, 255, 252, 255, 1, 0, 0, 0, 5, 0, 4, 0, 254, 255, 253, 255, 255, 255, 251, 255, 6, 0, 255, 255, 5, 0, 255, 255, 4, 0, 2, 0, 252, 255, 0, 0, 250, 255, 0, 0, 1, 0, 5, 0, 1, 0, 3, 0, 7, 0, 5, 0, 13, 0, 8, 0, 6, 0, 2, 0, 245, 255, 246, 255, 226, 255, 233, 255, 244, 255, 249, 255, 15, 0, 15, 0, 5, 0, 5, 0, 250, 255, 250, 255, 246, 255, 245, 255, 254, 255, 251, 255, 9, 0, 6, 0, 0, 0, 0, 0, 254, 255, 0, 0, 2, 0, 3, 0, 254, 255, 255, 255, 3, 0, 2, 0, 3, 0, 1, 0, 254, 255, 253, 255, 255, 255, 254, 255, 2, 0, 1, 0, 0, 0, 2, 0, 250, 255, 254, 255, 255, 255, 2, 0, 3, 0, 3, 0, 3, 0, 0, 0, 16, 0, 8, 0, 24, 0, 14, 0, 17, 0, 8, 0, 251, 255, 247, 255, 238, 255, 236, 255, 2, 0, 253, 255, 19, 0, 12, 0, 15, 0, 10, 0, 6, 0, 4, 0, 246, 255, 248, 255, 240, 255, 245, 255, 249, 255, 253, 255, 255, 255, 3, 0, 0, 0, 2, 0, 254, 255, 253, 255, 255, 255, 253, 255, 254, 255, 253, 255, 250, 255, 253, 255, 255, 255, 4, 0, 253, 255, 1, 0, 252, 255, 253, 255, 5, 0, 2, 0, 5, 0, 3, 0, 2, 0, 2, 0, 254, 255, 1, 0, 253, 255, 255, 255, 3, 0, 1, 0, 0, 0, 255, 255, 253, 255, 253, 255, 255, 255, 1, 0, 253, 255, 255, 255, 255, 255, 253, 255, 2, 0, 252, 255, 255, 255, 249, 255, 4, 0, 1, 0, 7, 0, 7, 0, 255, 255, 2, 0, 0, 0, 3, 0, 7, 0, 7, 0, 3, 0, 4, 0, 253, 255, 0, 0, 250, 255, 255, 255, 248, 255, 253, 255, 251, 255, 254, 255, 6, 0, 6, 0, 6, 0, 5, 0, 250, 255, 252, 255, 248, 255, 251, 255, 255, 255, 255, 255, 0, 0, 254, 255, 2, 0, 254, 255, 8, 0, 2, 0, 8, 0, 2, 0, 0, 0, 253, 255, 255, 255, 253, 255, 2, 0, 0, 0, 4, 0, 2, 0, 1, 0, 0, 0, 255, 255, 254, 255, 2, 0, 1, 0, 255, 255, 0, 0, 254, 255, 0, 0, 5, 0, 5, 0, 2, 0, 2, 0, 0, 0, 0, 0, 255, 255, 255, 255, 253, 255, 253, 255, 0, 0, 0, 0, 253, 255, 253, 255, 2, 0, 0, 0, 7, 0, 4, 0, 2, 0, 255, 255, 3, 0, 2, 0, 239, 255, 242, 255, 227, 255, 232, 255, 251, 255, 253, 255, 0, 0, 2, 0, 255, 255, 0, 0, 5, 0, 4, 0, 0, 0, 254, 255, 3, 0, 1, 0, 254, 255, 255, 255, 244, 255, 249, 255, 252, 255, 1, 0, 3, 0, 5, 0, 4, 0, 5, 0, 2, 0, 4, 0, 253, 255, 2, 0, 253, 255, 4, 0, 252, 255, 1, 0, 255, 255, 255, 255, 254, 255, 251, 255, 255, 255, 252, 255, 3, 0, 3, 0, 254, 255, 1, 0, 254, 255, 0, 0, 3, 0, 1, 0, 7, 0, 255, 255, 9, 0, 0, 0, 4, 0, 255, 255, 2, 0, 0, 0, 2, 0, 3, 0, 0, 0, 1, 0, 1, 0, 1, 0, 255, 255, 255, 255, 253, 255, 254, 255, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 254, 255, 4, 0, 0, 0, 3, 0, 254, 255, 0, 0, 252, 255, 1, 0, 255, 255, 250, 255, 252, 255, 250, 255, 254, 255, 3, 0, 7, 0, 0, 0, 4, 0, 253, 255, 254, 255, 254, 255, 254, 255, 255, 255, 254, 255, 0, 0, 1, 0, 1, 0, 0, 0, 2, 0, 255, 255, 2, 0, 254, 255, 0, 0, 252, 255, 2, 0, 0, 0, 0, 0, 1, 0, 252, 255, 253, 255, 0, 0, 0, 0, 6, 0, 4, 0, 4, 0, 2, 0, 0, 0, 0, 0, 254, 255, 255, 255, 250, 255, 251, 255, 0, 0, 255, 255, 8, 0, 5, 0, 4, 0, 2, 0, 254, 255, 255, 255, 252, 255, 253, 255, 254, 255, 252, 255, 3, 0, 255, 255, 3, 0, 0, 0, 2, 0, 1, 0, 2, 0, 3, 0, 0, 0, 3, 0, 1, 0, 4, 0, 1, 0, 2, 0, 2, 0, 255, 255, 4, 0, 255, 255, 4, 0, 255, 255, 5, 0, 1, 0, 4, 0, 2, 0, 4, 0, 2, 0, 9, 0, 3, 0, 7, 0, 1, 0, 1, 0, 253, 255, 252, 255, 252, 255, 253, 255, 0, 0, 1, 0, 4, 0, 255, 255, 1, 0, 255, 255, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 3, 0, 4, 0, 0, 0, 1, 0, 251, 255, 251, 255, 3, 0, 0, 0, 3, 0, 255, 255, 0, 0, 253, 255, 3, 0, 0, 0, 254, 255, 252, 255, 250, 255, 251, 255, 250, 255, 252, 255, 248, 255, 252, 255, 0, 0, 3, 0, 6, 0, 7, 0, 248, 255, 251, 255, 242, 255, 248, 255, 250, 255, 2, 0, 246, 255, 254, 255, 253, 255, 1, 0, 13, 0, 11, 0, 8, 0, 4, 0, 1, 0, 255, 255, 0, 0, 0, 0, 251, 255, 252, 255, 3, 0, 2, 0, 6, 0, 3, 0, 1, 0, 254, 255, 2, 0, 2, 0, 1, 0, 3, 0, 255, 255, 1, 0, 253, 255, 252, 255, 2, 0, 252, 255, 10, 0, 2, 0, 2, 0, 254, 255, 250, 255, 251, 255, 253, 255, 255, 255, 4, 0, 3, 0, 10, 0, 5, 0, 2, 0, 254, 255, 254, 255, 252, 255, 2, 0, 2, 0, 1, 0, 2, 0, 1, 0, 1, 0, 0, 0, 255, 255, 255, 255, 254, 255, 6, 0, 5, 0, 4, 0, 4, 0, 252, 255, 255, 255, 251, 255, 254, 255, 253, 255, 254, 255, 0, 0, 1, 0, 1, 0, 2, 0, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 3, 0, 255, 255, 4, 0, 0, 0, 0, 0, 254, 255, 255, 255, 255, 255, 252, 255, 254, 255, 249, 255, 252, 255, 2, 0, 0, 0, 9, 0, 3, 0, 5, 0, 254, 255, 3, 0, 255, 255, 0, 0, 0, 0, 252, 255, 255, 255, 0, 0, 3, 0, 5, 0, 4, 0, 5, 0, 2, 0, 0, 0, 254, 255, 254, 255, 253, 255, 0, 0, 255, 255, 2, 0, 1, 0, 1, 0, 2, 0, 250, 255, 253, 255, 251, 255, 255, 255, 0, 0, 2, 0, 0, 0, 255, 255, 4, 0, 2, 0, 3, 0, 1, 0, 6, 0, 3, 0, 26, 0, 20, 0, 32, 0, 24, 0, 20, 0, 14, 0, 5, 0, 2, 0, 7, 0, 5, 0, 35, 0, 28, 0, 39, 0, 32, 0, 18, 0, 15, 0, 7, 0, 4, 0, 254, 255, 251, 255, 252, 255, 248, 255, 252, 255, 249, 255, 251, 255, 250, 255, 253, 255, 254, 255, 253, 255, 255, 255, 250, 255, 253, 255, 247, 255, 252, 255, 251, 255, 0, 0, 255, 255, 2, 0, 252, 255, 254, 255, 251, 255, 252, 255, 248, 255, 250, 255, 254, 255, 1, 0, 2, 0, 5, 0, 250, 255, 254, 255, 254, 255, 0, 0, 248, 255, 250, 255, 232, 255, 236, 255, 248, 255, 249, 255, 8, 0, 8, 0, 1, 0, 4, 0, 247, 255, 254, 255, 243, 255, 250, 255, 246, 255, 251, 255, 250, 255, 253, 255, 253, 255, 254, 255, 1, 0, 2, 0, 0, 0, 2, 0, 252, 255, 254, 255, 249, 255, 251, 255, 251, 255, 253, 255, 254, 255, 2, 0, 255, 255, 3, 0, 252, 255, 1, 0, 247, 255, 252, 255, 251, 255, 253, 255, 255, 255, 0, 0, 253, 255, 0, 0, 252, 255, 1, 0, 249, 255, 1, 0, 252, 255, 1, 0, 2, 0, 2, 0, 2, 0, 254, 255, 2, 0, 253, 255, 4, 0, 0, 0, 3, 0, 1, 0, 255, 255, 255, 255, 254, 255, 255, 255, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 1, 0, 254, 255, 4, 0, 255, 255, 4, 0, 0, 0, 0, 0, 253, 255, 0, 0, 255, 255, 2, 0, 1, 0, 3, 0, 1, 0, 1, 0, 255, 255, 254, 255, 253, 255, 255, 255, 0, 0, 254, 255, 1, 0, 1, 0, 5, 0, 1, 0, 5, 0, 248, 255, 251, 255, 255, 255, 255, 255, 5, 0, 3, 0, 255, 255, 253, 255, 255, 255, 253, 255, 1, 0, 255, 255, 4, 0, 1, 0, 1, 0, 255, 255, 1, 0, 255, 255, 7, 0, 4, 0, 255, 255, 253, 255, 255, 255, 254, 255, 1, 0, 1, 0, 253, 255, 254, 255, 3, 0, 3, 0, 4, 0, 3, 0, 3, 0, 1, 0, 254, 255, 254, 255, 250, 255, 251, 255, 2, 0, 1, 0, 2, 0, 0, 0, 5, 0, 1, 0, 2, 0, 254, 255, 251, 255, 249, 255, 9, 0, 6, 0, 3, 0, 2, 0, 254, 255, 0, 0, 4, 0, 7, 0, 235, 255, 242, 255, 237, 255, 245, 255, 248, 255, 254, 255, 238, 255, 244, 255, 3, 0, 4, 0, 18, 0, 15, 0, 7, 0, 5, 0, 4, 0, 1, 0, 0, 0, 253, 255, 255, 255, 253, 255, 3, 0, 0, 0, 5, 0, 3, 0, 2, 0, 2, 0, 253, 255, 252, 255, 0, 0, 253, 255, 3, 0, 1, 0, 4, 0, 2, 0, 254, 255, 0, 0, 250, 255, 252, 255, 2, 0, 1, 0, 2, 0, 0, 0, 0, 0, 254, 255, 2, 0, 1, 0, 253, 255, 253, 255, 255, 255, 254, 255, 5, 0, 2, 0, 3, 0, 0, 0, 255, 255, 254, 255, 255, 255, 0, 0, 3, 0, 4, 0, 253, 255, 255, 255, 249, 255, 251, 255, 2, 0, 2, 0, 6, 0, 5, 0, 3, 0, 2, 0, 2, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 254, 255, 254, 255, 0, 0, 254, 255, 2, 0, 255, 255, 2, 0, 1, 0, 0, 0, 1, 0, 252, 255, 254, 255, 255, 255, 255, 255, 0, 0, 0, 0, 254, 255, 254, 255, 3, 0, 2, 0, 4, 0, 2, 0, 1, 0, 255, 255, 1, 0, 254, 255, 2, 0, 0, 0, 3, 0, 2, 0, 0, 0, 2, 0, 255, 255, 1, 0, 0, 0, 0, 0, 1, 0, 255, 255, 3, 0, 0, 0, 252, 255, 253, 255, 249, 255, 253, 255, 253, 255, 2, 0, 0, 0, 1, 0, 3, 0, 1, 0, 1, 0, 254, 255, 1, 0, 253, 255, 5, 0, 255, 255, 6, 0, 0, 0, 15, 0, 9, 0, 7, 0, 2, 0, 251, 255, 249, 255, 14, 0, 9, 0, 10, 0, 6, 0, 240, 255, 242, 255, 239, 255, 243, 255, 240, 255, 245, 255, 237, 255, 242, 255, 246, 255, 250, 255, 252, 255, 255, 255, 252, 255, 255, 255, 1, 0, 2, 0, 4, 0, 4, 0, 1, 0, 255, 255, 254, 255, 252, 255, 254, 255, 253, 255, 2, 0, 0, 0, 3, 0, 2, 0, 255, 255, 0, 0, 253, 255, 254, 255, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 253, 255, 254, 255, 254, 255, 254, 255, 11, 0, 8, 0, 9, 0, 8, 0, 246, 255, 250, 255, 247, 255, 252, 255, 253, 255, 255, 255, 252, 255, 252, 255, 2, 0, 2, 0, 255, 255, 1, 0, 252, 255, 0, 0, 255, 255, 1, 0, 255, 255, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 254, 255, 255, 255, 1, 0, 2, 0, 255, 255, 0, 0, 253, 255, 254, 255, 255, 255, 0, 0, 1, 0, 2, 0, 1, 0, 1, 0, 0, 0, 255, 255, 255, 255, 254, 255, 255, 255, 254, 255, 0, 0, 1, 0, 255, 255, 2, 0, 253, 255, 255, 255, 255, 255, 255, 255, 1, 0, 255, 255, 2, 0, 0, 0, 5, 0, 3, 0, 3, 0, 2, 0, 1, 0, 255, 255, 1, 0, 254, 255, 2, 0, 254, 255, 1, 0, 255, 255, 255, 255, 0, 0, 255, 255, 2, 0, 253, 255, 0, 0, 252, 255, 252, 255, 1, 0, 254, 255, 3, 0, 0, 0, 1, 0, 0, 0, 254, 255, 255, 255, 253, 255, 255, 255, 0, 0, 0, 0, 4, 0, 2, 0, 5, 0, 3, 0, 0, 0, 0, 0, 253, 255, 255, 255, 1, 0, 2, 0, 2, 0, 1, 0, 0, 0, 254, 255, 1, 0, 254, 255, 1, 0, 255, 255, 1, 0, 1, 0, 255, 255, 1, 0, 251, 255, 253, 255, 253, 255, 253, 255, 3, 0, 0, 0, 3, 0, 0, 0, 0, 0, 254, 255, 0, 0, 255, 255, 2, 0, 1, 0, 5, 0, 3, 0, 3, 0, 2, 0, 255, 255, 254, 255, 2, 0, 0, 0, 1, 0, 0, 0, 255, 255, 254, 255, 1, 0, 0, 0, 254, 255, 255, 255, 249, 255, 254, 255, 247, 255, 253, 255, 247, 255, 252, 255, 6, 0, 4, 0, 19, 0, 13, 0, 15, 0, 11, 0, 3, 0, 4, 0, 246, 255, 251, 255, 247, 255, 249, 255, 3, 0, 255, 255, 5, 0, 255, 255, 2, 0, 254, 255, 1, 0, 255, 255, 254, 255, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 254, 255, 253, 255, 255, 255, 254, 255, 2, 0, 0, 0, 4, 0, 1, 0, 6, 0, 2, 0, 2, 0, 0, 0, 255, 255, 255, 255, 254, 255, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 255, 255, 254, 255, 1, 0, 255, 255, 1, 0, 255, 255, 253, 255, 253, 255, 255, 255, 254, 255, 1, 0, 0, 0, 0, 0, 255, 255, 2, 0, 1, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 253, 255, 255, 255, 253, 255, 255, 255, 0, 0, 1, 0, 2, 0, 2, 0, 2, 0, 1, 0, 255, 255, 0, 0, 254, 255, 255, 255, 253, 255, 253, 255, 0, 0, 254, 255, 6, 0, 3, 0, 1, 0, 0, 0, 251, 255, 252, 255, 253, 255, 254, 255, 255, 255, 0, 0, 1, 0, 2, 0, 1, 0, 1, 0, 255, 255, 0, 0, 2, 0, 2, 0, 3, 0, 3, 0, 1, 0, 0, 0, 255, 255, 254, 255, 0, 0, 254, 255, 3, 0, 255, 255, 3, 0, 255, 255, 3, 0, 0, 0, 1, 0, 0, 0, 252, 255, 253, 255, 254, 255, 255, 255, 255, 255, 0, 0, 254, 255, 255, 255, 0, 0, 1, 0, 255, 255, 255, 255, 254, 255, 254, 255, 1, 0, 255, 255, 3, 0, 1, 0, 3, 0, 1, 0, 0, 0, 255, 255, 0, 0, 0, 0, 254, 255, 1, 0, 252, 255, 0, 0, 253, 255, 1, 0, 249, 255, 255, 255, 248, 255, 253, 255, 252, 255, 255, 255, 252, 255, 255, 255, 254, 255, 1, 0, 255, 255, 2, 0, 0, 0, 1, 0, 4, 0, 1, 0, 2, 0, 254, 255, 1, 0, 254, 255, 2, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 254, 255, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 254, 255, 4, 0, 0, 0, 8, 0, 4, 0, 3, 0, 0, 0, 254, 255, 255, 255, 253, 255, 0, 0, 249, 255, 254, 255, 252, 255, 1, 0, 253, 255, 2, 0, 247, 255, 252, 255, 248, 255, 251, 255, 250, 255, 252, 255, 252, 255, 253, 255, 0, 0, 1, 0, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 254, 255, 255, 255, 254, 255, 255, 255, 254, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 4, 0, 2, 0, 3, 0, 0, 0, 255, 255, 253, 255, 1, 0, 0, 0, 1, 0, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 254, 255, 253, 255, 0, 0, 255, 255, 3, 0, 2, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 253, 255, 252, 255, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 2, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 0, 0, 2, 0, 254, 255, 1, 0, 254, 255, 0, 0, 2, 0, 1, 0, 3, 0, 0, 0, 5, 0, 0, 0, 3, 0, 254, 255, 0, 0, 254, 255, 1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 1, 0, 254, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 254, 255, 254, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 3, 0, 2, 0, 0, 0, 254, 255, 255, 255, 252, 255, 6, 0, 2, 0, 252, 255, 253, 255, 241, 255, 247, 255, 241, 255, 248, 255, 241, 255, 247, 255, 250, 255, 253, 255, 253, 255, 254, 255, 242, 255, 245, 255, 247, 255, 249, 255, 252, 255, 253, 255, 251, 255, 252, 255, 3, 0, 1, 0, 4, 0, 1, 0, 4, 0, 254, 255, 9, 0, 1, 0, 6, 0, 254, 255, 4, 0, 253, 255, 6, 0, 0, 0, 5, 0, 0, 0, 5, 0, 0, 0, 4, 0, 0, 0, 5, 0, 1, 0, 6, 0, 1, 0, 3, 0, 255, 255, 3, 0, 255, 255, 5, 0, 0, 0, 5, 0, 0, 0, 3, 0, 0, 0, 253, 255, 252, 255, 249, 255, 251, 255, 253, 255, 254, 255, 3, 0, 1, 0, 7, 0, 3, 0, 7, 0, 2, 0, 6, 0, 1, 0, 4, 0, 255, 255, 4, 0, 0, 0, 6, 0, 2, 0, 4, 0, 0, 0, 4, 0, 255, 255, 5, 0, 255, 255, 3, 0, 254, 255, 3, 0, 254, 255, 3, 0, 254, 255, 6, 0, 0, 0, 6, 0, 0, 0, 5, 0, 254, 255, 5, 0, 255, 255, 5, 0, 0, 0, 4, 0, 255, 255, 5, 0, 0, 0, 5, 0, 0, 0, 6, 0, 0, 0, 2, 0, 254, 255, 254, 255, 253, 255, 1, 0, 0, 0, 2, 0, 2, 0, 4, 0, 2, 0, 4, 0, 0, 0, 1, 0, 255, 255, 2, 0, 255, 255, 2, 0, 0, 0, 0, 0, 254, 255, 1, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 1, 0, 254, 255, 1, 0, 254, 255, 255, 255, 1, 0, 254, 255, 4, 0, 0, 0, 2, 0, 0, 0, 255, 255, 255, 255, 254, 255, 1, 0, 254, 255, 0, 0, 1, 0, 1, 0, 1, 0, 255, 255, 255, 255, 254, 255, 1, 0, 0, 0, 0, 0, 1, 0, 254, 255, 255, 255, 254, 255, 255, 255, 255, 255, 254, 255, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 255, 255, 255, 255, 255, 254, 255, 254, 255, 253, 255, 253, 255, 254, 255, 255, 255, 254, 255, 255, 255, 1, 0, 0, 0, 3, 0, 255, 255, 3, 0, 254, 255, 4, 0, 1, 0, 3, 0, 1, 0, 0, 0, 255, 255, 1, 0, 0, 0, 2, 0, 1, 0, 251, 255, 253, 255, 240, 255, 245, 255, 241, 255, 248, 255, 246, 255, 253, 255, 239, 255, 246, 255, 235, 255, 240, 255, 239, 255, 240, 255, 249, 255, 246, 255, 8, 0, 0, 0, 10, 0, 2, 0, 4, 0, 254, 255, 4, 0, 255, 255, 3, 0, 255, 255, 2, 0, 255, 255, 3, 0, 0, 0, 3, 0, 0, 0, 5, 0, 1, 0, 6, 0, 1, 0, 5, 0, 255, 255, 3, 0, 254, 255, 4, 0, 255, 255, 5, 0, 0, 0, 4, 0, 0, 0, 4, 0, 0, 0, 3, 0, 0, 0, 2, 0, 255, 255, 4, 0, 0, 0, 7, 0, 1, 0, 5, 0, 255, 255, 4, 0, 255, 255, 4, 0, 255, 255, 4, 0, 0, 0, 5, 0, 1, 0, 4, 0, 0, 0, 4, 0, 254, 255, 4, 0, 255, 255, 4, 0, 0, 0, 2, 0, 255, 255, 2, 0, 0, 0, 2, 0, 1, 0, 0, 0, 255, 255, 255, 255, 254, 255, 0, 0, 0, 0, 255, 255, 255, 255, 254, 255, 255, 255, 0, 0, 1, 0, 254, 255, 255, 255, 253, 255, 253, 255, 255, 255, 255, 255, 2, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 254, 255, 0, 0, 255, 255, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 1, 0, 254, 255, 4, 0, 255, 255, 4, 0, 0, 0, 2, 0, 255, 255, 1, 0, 0, 0, 2, 0, 1, 0, 1, 0, 0, 0, 1, 0, 254, 255, 0, 0, 254, 255, 0, 0, 255, 255, 1, 0, 1, 0, 255, 255, 1, 0, 252, 255, 0, 0, 253, 255, 0, 0, 255, 255, 0, 0, 2, 0, 1, 0, 7, 0, 3, 0, 5, 0, 1, 0, 1, 0, 0, 0, 255, 255, 1, 0, 249, 255, 253, 255, 244, 255, 248, 255, 250, 255, 253, 255, 249, 255, 253, 255, 238, 255, 241, 255, 242, 255, 244, 255, 1, 0, 254, 255, 4, 0, 255, 255, 5, 0, 255, 255, 5, 0, 1, 0, 3, 0, 0, 0, 4, 0, 1, 0, 1, 0, 0, 0, 254, 255, 254, 255, 1, 0, 1, 0, 1, 0, 1, 0, 255, 255, 255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 1, 0, 1, 0, 4, 0, 2, 0, 7, 0, 4, 0, 6, 0, 4, 0, 251, 255, 253, 255, 249, 255, 253, 255, 254, 255, 2, 0, 252, 255, 254, 255, 255, 255, 0, 0, 0, 0, 1, 0, 248, 255, 250, 255, 250, 255, 253, 255, 254, 255, 1, 0, 253, 255, 255, 255, 2, 0, 1, 0, 4, 0, 1, 0, 2, 0, 255, 255, 2, 0, 255, 255, 0, 0, 254, 255, 1, 0, 1, 0, 1, 0, 2, 0, 255, 255, 1, 0, 254, 255, 255, 255, 253, 255, 254, 255, 255, 255, 255, 255, 2, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 253, 255, 254, 255, 254, 255, 255, 255, 2, 0, 2, 0, 1, 0, 1, 0, 2, 0, 1, 0, 1, 0, 0, 0, 255, 255, 255, 255, 1, 0, 0, 0, 255, 255, 255, 255, 253, 255, 254, 255, 255, 255, 255, 255, 1, 0, 255, 255, 3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 254, 255, 4, 0, 0, 0, 3, 0, 0, 0, 254, 255, 254, 255, 0, 0, 1, 0, 0, 0, 1, 0, 255, 255, 255, 255, 2, 0, 0, 0, 0, 0, 254, 255, 0, 0, 254, 255, 0, 0, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 0, 0, 255, 255, 1, 0, 253, 255, 0, 0, 255, 255, 1, 0, 1, 0, 1, 0, 0, 0, 255, 255, 1, 0, 255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 0, 0, 0, 0, 253, 255, 254, 255, 255, 255, 0, 0, 1, 0, 1, 0, 254, 255, 255, 255, 254, 255, 0, 0, 252, 255, 254, 255, 243, 255, 247, 255, 246, 255, 249, 255, 254, 255, 255, 255, 252, 255, 253, 255, 252, 255, 254, 255, 253, 255, 0, 0, 250, 255, 254, 255, 253, 255, 0, 0, 253, 255, 0, 0, 251, 255, 254, 255, 254, 255, 0, 0, 255, 255, 0, 0, 1, 0, 1, 0, 3, 0, 3, 0, 255, 255, 0, 0, 254, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 255, 255, 0, 0, 253, 255, 255, 255, 254, 255, 255, 255, 255, 255, 254, 255, 2, 0, 255, 255, 3, 0, 255, 255, 3, 0, 0, 0, 4, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 254, 255, 0, 0, 252, 255, 255, 255, 255, 255, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 255, 255, 254, 255, 0, 0, 254, 255, 1, 0, 0, 0, 254, 255, 255, 255, 255, 255, 0, 0, 254, 255, 255, 255, 255, 255, 0, 0, 1, 0, 1, 0, 254, 255, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 254, 255, 254, 255, 0, 0, 0, 0, 4, 0, 2, 0, 0, 0, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 254, 255, 1, 0, 254, 255, 0, 0, 0, 0, 0, 0, 1, 0, 255, 255, 2, 0, 255, 255, 1, 0, 254, 255, 0, 0, 0, 0, 1, 0, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 255, 255, 254, 255, 1, 0, 254, 255, 3, 0, 255, 255, 4, 0, 0, 0, 3, 0, 1, 0, 0, 0, 255, 255, 5, 0, 5, 0, 14, 0, 12, 0, 18, 0, 14, 0, 16, 0, 12, 0, 6, 0, 3, 0, 255, 255, 254, 255, 1, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 254, 255, 3, 0, 255, 255, 2, 0, 254, 255, 0, 0, 255, 255, 0, 0, 2, 0, 254, 255, 1, 0, 253, 255, 0, 0, 254, 255, 0, 0, 254, 255, 1, 0, 255, 255, 1, 0, 2, 0, 2, 0, 8, 0, 5, 0, 10, 0, 6, 0, 7, 0, 3, 0, 2, 0, 1, 0, 1, 0, 2, 0, 4, 0, 5, 0, 2, 0, 2, 0, 1, 0, 255, 255, 5, 0, 4, 0, 254, 255, 1, 0, 246, 255, 252, 255, 250, 255, 0, 0, 251, 255, 0, 0, 251, 255, 253, 255, 254, 255, 255, 255, 253, 255, 255, 255, 252, 255, 255, 255, 254, 255, 0, 0, 253, 255, 0, 0, 252, 255, 255, 255, 252, 255, 0, 0, 252, 255, 0, 0, 253, 255, 1, 0, 253, 255, 1, 0, 254, 255, 2, 0, 254, 255, 1, 0, 254, 255, 2, 0, 252, 255, 1, 0, 250, 255, 255, 255, 252, 255, 0, 0, 254, 255, 1, 0, 253, 255, 255, 255, 253, 255, 0, 0, 251, 255, 0, 0, 251, 255, 0, 0, 0, 0, 3, 0, 0, 0, 1, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 2, 0, 2, 0, 0, 0, 0, 0, 255, 255, 255, 255, 1, 0, 0, 0, 2, 0, 1, 0, 0, 0, 1, 0, 254, 255, 255, 255, 254, 255, 0, 0, 255, 255, 0, 0, 254, 255, 255, 255, 255, 255, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 255, 255, 1, 0, 0, 0, 1, 0, 255, 255, 1, 0, 254, 255, 0, 0, 255, 255, 1, 0, 255, 255, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 255, 255, 1, 0, 255, 255, 1, 0, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 3, 0, 2, 0, 4, 0, 1, 0, 6, 0, 2, 0, 6, 0, 3, 0, 7, 0, 4, 0, 13, 0, 8, 0, 17, 0, 10, 0, 13, 0, 9, 0, 8, 0, 7, 0, 2, 0, 4, 0, 254, 255, 0, 0, 2, 0, 0, 0, 6, 0, 2, 0, 2, 0, 0, 0, 255, 255, 0, 0, 251, 255, 1, 0, 247, 255, 0, 0, 249, 255, 0, 0, 253, 255, 0, 0, 255, 255, 1, 0, 0, 0, 2, 0, 252, 255, 255, 255, 250, 255, 254, 255, 253, 255, 1, 0, 252, 255, 0, 0, 253, 255, 0, 0, 255, 255, 2, 0, 255, 255, 1, 0, 253, 255, 254, 255, 253, 255, 253, 255, 255, 255, 0, 0, 255, 255, 2, 0, 251, 255, 255, 255, 250, 255, 255, 255, 252, 255, 0, 0, 253, 255, 0, 0, 254, 255, 1, 0, 253, 255, 2, 0, 252, 255, 2, 0, 254, 255, 2, 0, 253, 255, 255, 255, 254, 255, 255, 255, 0, 0, 1, 0, 251, 255, 255, 255, 248, 255, 255, 255, 251, 255, 1, 0, 251, 255, 0, 0, 254, 255, 0, 0, 2, 0, 2, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 255, 255, 255, 255, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0, 2, 0, 255, 255, 0, 0, 0, 0, 254, 255, 0, 0, 252, 255, 0, 0, 254, 255, 0, 0, 1, 0, 2, 0, 1, 0, 1, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 3, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 255, 255, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 0, 0, 1, 0, 254, 255, 0, 0, 0, 0, 0, 0, 6, 0, 2, 0, 6, 0, 0, 0, 5, 0, 0, 0, 3, 0, 0, 0, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0, 2, 0, 1, 0, 2, 0, 0, 0, 1, 0, 254, 255, 1, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 255, 255, 1, 0, 0, 0, 3, 0, 1, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 7, 0, 5, 0, 13, 0, 8, 0, 13, 0, 6, 0, 7, 0, 1, 0, 3, 0, 255, 255, 4, 0, 1, 0, 7, 0, 4, 0, 8, 0, 5, 0, 5, 0, 4, 0, 255, 255, 0, 0, 255, 255, 1, 0, 255, 255, 2, 0, 253, 255, 1, 0, 252, 255, 2, 0, 252, 255, 1, 0, 254, 255, 1, 0, 0, 0, 1, 0, 253, 255, 255, 255, 253, 255, 255, 255, 252, 255, 1, 0, 251, 255, 2, 0, 252, 255, 1, 0, 253, 255, 1, 0, 254, 255, 1, 0, 253, 255, 0, 0, 251, 255, 254, 255, 253, 255, 255, 255, 254, 255, 0, 0, 0, 0, 1, 0, 255, 255, 1, 0, 253, 255, 255, 255, 0, 0, 2, 0, 2, 0, 2, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 254, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 254, 255, 254, 255, 0, 0, 2, 0, 0, 0, 3, 0, 254, 255, 1, 0, 0, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 255, 255, 1, 0, 0, 0, 1, 0, 1, 0, 2, 0, 1, 0, 1, 0, 1, 0, 0, 0, 2, 0, 2, 0, 1, 0, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 255, 255, 2, 0, 0, 0, 2, 0, 0, 0, 2, 0, 1, 0, 0, 0, 2, 0, 253, 255, 0, 0, 0, 0, 1, 0, 4, 0, 3, 0, 1, 0, 255, 255, 250, 255, 251, 255, 240, 255, 244, 255, 239, 255, 243, 255, 251, 255, 253, 255, 3, 0, 3, 0, 254, 255, 0, 0, 248, 255, 253, 255, 251, 255, 255, 255, 1, 0, 2, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 1, 0, 1, 0, 255, 255, 255, 255, 0, 0, 1, 0, 255, 255, 1, 0, 254, 255, 0, 0, 1, 0, 1, 0, 6, 0, 3, 0, 9, 0, 4, 0, 5, 0, 1, 0, 2, 0, 0, 0, 7, 0, 6, 0, 9, 0, 9, 0, 5, 0, 7, 0, 4, 0, 5, 0, 2, 0, 1, 0, 2, 0, 255, 255, 3, 0, 0, 0, 1, 0, 0, 0, 255, 255, 0, 0, 255, 255, 1, 0, 2, 0, 2, 0, 3, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 1, 0, 0, 0, 2, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 253, 255, 253, 255, 0, 0, 254, 255, 2, 0, 1, 0, 255, 255, 0, 0, 254, 255, 0, 0, 0, 0, 2, 0, 2, 0, 2, 0, 3, 0, 2, 0, 3, 0, 1, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 255, 255, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 253, 255, 253, 255, 255, 255, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 2, 0, 2, 0, 2, 0, 2, 0, 1, 0, 1, 0, 0, 0, 1, 0, 254, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 255, 255, 254, 255, 255, 255, 254, 255, 0, 0, 254, 255, 1, 0, 0, 0, 2, 0, 2, 0, 255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 255, 255, 252, 255, 253, 255, 251, 255, 253, 255, 255, 255, 255, 255, 4, 0, 2, 0, 7, 0, 3, 0, 4, 0, 0, 0, 3, 0, 255, 255, 5, 0, 1, 0, 8, 0, 4, 0, 13, 0, 9, 0, 12, 0, 11, 0, 3, 0, 5, 0, 253, 255, 1, 0, 254, 255, 1, 0, 255, 255, 1, 0, 254, 255, 0, 0, 252, 255, 0, 0, 252, 255, 0, 0, 253, 255, 1, 0, 253, 255, 0, 0, 253, 255, 254, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 255, 255, 0, 0, 254, 255, 0, 0, 0, 0, 1, 0, 1, 0, 2, 0, 255, 255, 0, 0, 255, 255, 1, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 255, 255, 0, 0, 255, 255, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 2, 0, 0, 0, 0, 0, 255, 255, 255, 255, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 254, 255, 255, 255, 254, 255, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 254, 255, 255, 255, 254, 255, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 254, 255, 0, 0, 255, 255, 0, 0, 1, 0, 2, 0, 1, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 255, 255, 3, 0, 0, 0, 3, 0, 1, 0, 254, 255, 254, 255, 252, 255, 254, 255, 253, 255, 1, 0, 254, 255, 2, 0, 252, 255, 0, 0, 253, 255, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 2, 0, 1, 0, 255, 255, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 1, 0, 252, 255, 0, 0, 250, 255, 0, 0, 252, 255, 2, 0, 249, 255, 255, 255, 246, 255, 251, 255, 252, 255, 253, 255, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 1, 0, 255, 255, 1, 0, 254, 255, 0, 0, 1, 0, 1, 0, 3, 0, 2, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 254, 255, 0, 0, 255, 255, 1, 0, 254, 255, 0, 0, 253, 255, 255, 255, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 255, 255, 255, 255, 254, 255, 255, 255, 1, 0, 0, 0, 1, 0, 1, 0, 255, 255, 0, 0, 0, 0, 1, 0, 255, 255, 0, 0, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 255, 255, 0, 0, 255, 255, 1, 0, 254, 255, 0, 0, 254, 255, 255, 255, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 2, 0, 0, 0, 0, 0, 6, 0, 4, 0, 12, 0, 7, 0, 5, 0, 2, 0, 6, 0, 3, 0, 16, 0, 10, 0, 9, 0, 6, 0, 254, 255, 0, 0, 253, 255, 255, 255, 0, 0, 0, 0, 4, 0, 1, 0, 5, 0, 2, 0, 0, 0, 255, 255, 254, 255, 0, 0, 254, 255, 1, 0, 253, 255, 0, 0, 253, 255, 0, 0, 253, 255, 0, 0, 254, 255, 0, 0, 253, 255, 0, 0, 253, 255, 0, 0, 254, 255, 1, 0, 254, 255, 0, 0, 255, 255, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 254, 255, 255, 255, 1, 0, 0, 0, 4, 0, 2, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 254, 255, 0, 0, 254, 255, 0, 0, 254, 255, 255, 255, 255, 255, 255, 255, 2, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 255, 255, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 2, 0, 1, 0, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 3, 0, 2, 0, 254, 255, 0, 0, 246, 255, 251, 255, 251, 255, 254, 255, 3, 0, 1, 0, 255, 255, 255, 255, 252, 255, 254, 255, 253, 255, 255, 255, 0, 0, 1, 0, 5, 0, 3, 0, 7, 0, 3, 0, 3, 0, 1, 0, 2, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 2, 0, 1, 0, 1, 0, 1, 0, 0, 0, 255, 255, 1, 0, 255, 255, 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 254, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 2, 0, 1, 0, 1, 0, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 1, 0, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 1, 0, 254, 255, 255, 255, 1, 0, 0, 0, 4, 0, 0, 0, 2, 0, 255, 255, 3, 0, 0, 0, 255, 255, 255, 255, 250, 255, 252, 255, 0, 0, 255, 255, 1, 0, 0, 0, 251, 255, 252, 255, 248, 255, 252, 255, 246, 255, 251, 255, 250, 255, 253, 255, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 254, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2, 0, 1, 0, 1, 0, 0, 0, 1, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 2, 0, 1, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 253, 255, 255, 255, 250, 255, 254, 255, 249, 255, 253, 255, 251, 255, 255, 255, 0, 0, 2, 0, 253, 255, 0, 0, 248, 255, 253, 255, 253, 255, 0, 0, 4, 0, 4, 0, 0, 0, 2, 0, 253, 255, 255, 255, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 2, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 255, 255, 0, 0, 255, 255, 1, 0, 254, 255, 0, 0, 255, 255, 0, 0, 1, 0, 1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 253, 255, 255, 255, 250, 255, 254, 255, 252, 255, 255, 255, 246, 255, 250, 255, 244, 255, 248, 255, 251, 255, 252, 255, 251, 255, 253, 255, 252, 255, 254, 255, 3, 0, 2, 0, 3, 0, 1, 0, 2, 0, 0, 0, 4, 0, 1, 0, 2, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 2, 0, 1, 0, 0, 0, 255, 255, 0, 0, 255, 255, 3, 0, 1, 0, 255, 255, 0, 0, 250, 255, 254, 255, 252, 255, 254, 255, 249, 255, 251, 255, 247, 255, 248, 255, 253, 255, 253, 255, 254, 255, 254, 255, 252, 255, 254, 255, 254, 255, 255, 255, 251, 255, 252, 255, 252, 255, 252, 255, 3, 0, 0, 0, 4, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 3, 0, 1, 0, 2, 0, 0, 0, 2, 0, 255, 255, 2, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 1, 0, 2, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 3, 0, 0, 0, 3, 0, 1, 0, 3, 0, 1, 0, 2, 0, 1, 0, 1, 0, 255, 255, 2, 0, 0, 0, 3, 0, 0, 0, 2, 0, 255, 255, 2, 0, 0, 0, 2, 0, 1, 0, 2, 0, 1, 0, 2, 0, 1, 0, 2, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 1, 0, 255, 255, 2, 0, 0, 0, 3, 0, 1, 0, 3, 0, 0, 0, 3, 0, 1, 0, 2, 0, 0, 0, 3, 0, 1, 0, 4, 0, 2, 0, 2, 0, 1, 0, 1, 0, 0, 0, 3, 0, 0, 0, 3, 0, 0, 0, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 254, 255, 1, 0, 253, 255, 0, 0, 255, 255, 0, 0, 1, 0, 1, 0, 253, 255, 255, 255, 251, 255, 254, 255, 252, 255, 255, 255, 254, 255, 0, 0, 3, 0, 2, 0, 2, 0, 2, 0, 254, 255, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 255, 255, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 254, 255, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 254, 255, 255, 255, 0, 0, 0, 0, 2, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 254, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 255, 255, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 255, 254, 255, 255, 255, 0, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 1, 0, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 254, 255, 255, 255, 1, 0, 1, 0, 12, 0, 7, 0, 9, 0, 6, 0, 3, 0, 2, 0, 4, 0, 3, 0, 1, 0, 0, 0, 2, 0, 255, 255, 5, 0, 1, 0, 2, 0, 255, 255, 255, 255, 255, 255, 0, 0, 1, 0, 255, 255, 1, 0, 254, 255, 1, 0, 254, 255, 0, 0, 254, 255, 0, 0, 255, 255, 0, 0, 253, 255, 255, 255, 254, 255, 0, 0, 255, 255, 1, 0, 254, 255, 0, 0, 253, 255, 0, 0, 253, 255, 0, 0, 253, 255, 255, 255, 254, 255, 0, 0, 254, 255, 255, 255, 254, 255, 255, 255, 253, 255, 0, 0, 254, 255, 0, 0, 255, 255, 1, 0, 254, 255, 0, 0, 254, 255, 0, 0, 254, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 254, 255, 255, 255, 254, 255, 254, 255, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 253, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 255, 255, 253, 255, 253, 255, 252, 255, 253, 255, 255, 255, 255, 255, 253, 255, 254, 255, 255, 255, 255, 255, 3, 0, 2, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 255, 255, 255, 255, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 2, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 1, 0, 254, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 2, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 1, 0, 255, 255, 1, 0, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 254, 255, 255, 255, 251, 255, 254, 255, 249, 255, 252, 255, 252, 255, 253, 255, 255, 255, 255, 255, 254, 255, 255, 255, 0, 0, 0, 0, 4, 0, 3, 0, 3, 0, 2, 0, 255, 255, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 2, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 255, 255, 255, 255, 1, 0, 0, 0, 2, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 2, 0, 1, 0, 3, 0, 2, 0, 3, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 255, 255, 0, 0, 2, 0, 2, 0, 2, 0, 1, 0, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 1, 0, 0, 0, 2, 0, 0, 0, 1, 0, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 2, 0, 1, 0, 2, 0, 0, 0, 3, 0, 1, 0, 5, 0, 2, 0, 3, 0, 1, 0, 3, 0, 1, 0, 6, 0, 3, 0, 3, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 254, 255, 255, 255, 255, 255, 0, 0, 255, 255, 1, 0, 254, 255, 0, 0, 254, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 0, 0, 254, 255, 1, 0, 254, 255, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 254, 255, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 254, 255, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 254, 255, 0, 0, 254, 255, 0, 0, 253, 255, 0, 0, 254, 255, 0, 0, 255, 255, 0, 0, 254, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 254, 255, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 255, 255, 255, 255, 0, 0, 255, 255, 3, 0, 1, 0, 5, 0, 2, 0, 4, 0, 3, 0, 4, 0, 3, 0, 2, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 254, 255, 255, 255, 254, 255, 0, 0, 255, 255, 1, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 1, 0, 2, 0, 1, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 255, 255, 254, 255, 254, 255, 254, 255, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 255, 255, 0, 0, 254, 255, 0, 0, 254, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 3, 0, 1, 0, 4, 0, 2, 0, 3, 0, 2, 0, 2, 0, 1, 0, 2, 0, 1, 0, 1, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 255, 253, 255, 254, 255, 254, 255, 255, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 254, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 255, 0, 0, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 254, 255, 255, 255, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 255, 255, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
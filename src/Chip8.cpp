@@ -1,14 +1,37 @@
 #include "Chip8.hpp"
+#include "Fusion.hpp"
+#include "VipTiming.hpp"
 #include <thread>
 #include <iostream>
 #include <fstream>
 #include <chrono>
 #include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
 
 #ifdef __EMSCRIPTEN__
 #include <emscripten.h>
 #endif
 
+//Memory profiling hooks in step(), nothing at all unless built with CPP8_MEMPROFILE
+#ifdef CPP8_MEMPROFILE
+#define PROFILE_MEMORY(call) memoryProfile.call
+#else
+#define PROFILE_MEMORY(call)
+#endif
+
+//Guest edge coverage for cpp8-fuzz, nothing at all unless built with CPP8_FUZZ.
+//A counter per hashed pair of PCs, which libFuzzer finds by its section
+//and reads along with its own coverage.
+#ifdef CPP8_FUZZ
+__attribute__((used, section("__libfuzzer_extra_counters")))
+std::uint8_t guestEdges[1 << 14];
+#define COVER_EDGE(from, to) guestEdges[((from) * 0x9E5u ^ (to)) & ((1 << 14) - 1)]++
+#else
+#define COVER_EDGE(from, to)
+#endif
+
 //This method attempts copying the contents of
 //a file to chip8's RAM, starting at addr 0x200
 //The file might be too big to fit in the RAM,
@@ -18,48 +41,299 @@ Chip8::Chip8(std::string romFilename, int outputScale)
 //Seed the random engine
 : randEng{static_cast<unsigned long>(std::chrono::high_resolution_clock::now().time_since_epoch().count())}
 {
-    std::ifstream rom{romFilename, std::ios::in | std::ios::binary};
+    std::ifstream file{romFilename, std::ios::in | std::ios::binary};
     
     //If file could not be opened
-    if(!rom){
+    if(!file){
         std::cerr << "File \"" << romFilename << "\"not found!" << std::endl;
         throw FileNotFound{};
     }
     else{
         //Might throw rom too big exception
-        loadRom(rom);
+        loadRom(file);
+        powerOn();
+        setScale(outputScale);
+    }
+}
 
-        //Clear the screen
-        screen.fill(false);
+//Same as above, but the ROM is taken from memory.
+Chip8::Chip8(const std::vector<std::uint8_t>& romData, int outputScale)
+//Seed the random engine
+: randEng{static_cast<unsigned long>(std::chrono::high_resolution_clock::now().time_since_epoch().count())}
+{
+    if(romData.size() > Chip8Core::XO_RAM_SIZE - 0x200){
+        throw FileTooBig{};
+    }
+    else{
+        rom = romData;
+        powerOn();
+        setScale(outputScale);
+    }
+}
 
-        //Set all keys to up
-        keys.fill(false);
+//One version of step() for each combination of quirks
+template<std::size_t... Q>
+constexpr std::array<Chip8::StepFn, sizeof...(Q)> Chip8::makeStepTable(std::index_sequence<Q...>){
+    return {&Chip8::step<Q>...};
+}
 
-        //Place the font in memory
-        std::copy(hexSprites.begin(), hexSprites.end(), mem.begin());
+const std::array<Chip8::StepFn, Chip8::QUIRK_COMBINATIONS> Chip8::stepTable =
+    Chip8::makeStepTable(std::make_index_sequence<Chip8::QUIRK_COMBINATIONS>{});
 
-        //set scale if valid
-        if(outputScale > 0){
-            scale = outputScale;
-        }
-        else{
-            std::cerr << "Bad scale parameter\n";
+//And of fusedStep()
+template<std::size_t... Q>
+constexpr std::array<Chip8::FusedStepFn, sizeof...(Q)> Chip8::makeFusedStepTable(std::index_sequence<Q...>){
+    return {&Chip8::fusedStep<Q>...};
+}
+
+const std::array<Chip8::FusedStepFn, Chip8::QUIRK_COMBINATIONS> Chip8::fusedStepTable =
+    Chip8::makeFusedStepTable(std::make_index_sequence<Chip8::QUIRK_COMBINATIONS>{});
+
+
+//Either a profile or a comma separated list of quirks
+std::optional<Chip8::Quirks> Chip8::Quirks::parse(const std::string& s){
+    Quirks q;
+
+    if(s == "default"){
+        return q;
+    }
+    else if(s == "vip"){
+        q.vfReset = true;
+        q.incrementI = true;
+        q.clipSprites = true;
+        return q;
+    }
+    else if(s == "chip48"){
+        q.shiftVx = true;
+        return q;
+    }
+    else if(s == "schip"){
+        q.shiftVx = true;
+        q.clipSprites = true;
+        q.jumpVx = true;
+        return q;
+    }
+    else if(s == "xochip"){
+        q.incrementI = true;
+        q.xoChip = true;
+        return q;
+    }
+
+    std::size_t start = 0;
+    while(start <= s.size()){
+        std::size_t end = std::min(s.find(',', start), s.size());
+        const std::string name = s.substr(start, end - start);
+
+        if(name == "shift")         q.shiftVx = true;
+        else if(name == "vfreset")  q.vfReset = true;
+        else if(name == "memi")     q.incrementI = true;
+        else if(name == "clip")     q.clipSprites = true;
+        else if(name == "jump")     q.jumpVx = true;
+        else if(name == "xo")       q.xoChip = true;
+        else                        return std::nullopt;
+
+        start = end + 1;
+    }
+
+    return q;
+}
+
+unsigned Chip8::Quirks::toBits() const{
+    return (shiftVx ? SHIFT_VX : 0u)
+         | (vfReset ? VF_RESET : 0u)
+         | (incrementI ? INCREMENT_I : 0u)
+         | (clipSprites ? CLIP_SPRITES : 0u)
+         | (jumpVx ? JUMP_VX : 0u)
+         | (xoChip ? XO_CHIP : 0u);
+}
+
+Chip8::Quirks Chip8::Quirks::fromBits(unsigned bits){
+    Quirks q;
+    q.shiftVx = bits & SHIFT_VX;
+    q.vfReset = bits & VF_RESET;
+    q.incrementI = bits & INCREMENT_I;
+    q.clipSprites = bits & CLIP_SPRITES;
+    q.jumpVx = bits & JUMP_VX;
+    q.xoChip = bits & XO_CHIP;
+    return q;
+}
+
+//The quirks are chosen here, once, and not checked while running
+void Chip8::setQuirks(Quirks q){
+    //Until now nothing could be written above 4KB: entering XO-CHIP, it's
+    //what it would have been all along, the part of the ROM that didn't fit
+    if(q.xoChip && !quirks.xoChip){
+        xoMemory.assign(Chip8Core::XO_RAM_SIZE, 0);
+        std::copy(core.mem.begin(), core.mem.end(), xoMemory.begin());
+        if(rom.size() > Chip8Core::RAM_SIZE - 0x200){
+            std::copy(rom.begin() + (Chip8Core::RAM_SIZE - 0x200), rom.end(), xoMemory.begin() + Chip8Core::RAM_SIZE);
         }
     }
+    else if(!q.xoChip && quirks.xoChip){
+        std::copy_n(xoMemory.begin(), Chip8Core::RAM_SIZE, core.mem.begin());
+    }
+
+    quirks = q;
+    coreStep = stepTable[q.toBits()];
+    selectStepFn();
+
+    //Sequences near the end of the 4KB may have been looked for in the 64KB of XO-CHIP, or the other way around
+    fusionHints.assign(getMemorySize(), UNKNOWN_FUSION);
+    core.PC &= getMemorySize() - 1;
+}
+
+Chip8::Quirks Chip8::getQuirks() const{
+    return quirks;
 }
 
 //Set chip48 mode
 void Chip8::setChip48(bool b){
-    chip48 = b;
+    Quirks q = quirks;
+    q.shiftVx = b;
+    setQuirks(q);
+}
+
+void Chip8::setFusion(bool on){
+    fusion = on;
+    selectStepFn();
+}
+
+bool Chip8::getFusion() const{
+    return fusion;
+}
+
+void Chip8::setHz(int newHz){
+    hz = std::clamp(newHz, 1, 1000000);
+    timeBetweenCycles = std::chrono::microseconds{1000000 / hz};
+}
+
+int Chip8::getHz() const{
+    return hz;
+}
+
+void Chip8::setVipTiming(bool on){
+    vipTiming = on;
+    cycleBudget = 0;
+
+    //The clock wasn't looked at for the timers while it was on
+    delayModified = soundModified = Clock::now();
+}
+
+bool Chip8::getVipTiming() const{
+    return vipTiming;
+}
+
+void Chip8::setKeyLayout(const std::array<std::uint8_t, 16>& layout){
+    for(std::size_t i = 0; i < layout.size(); i++){
+        keyLayout[i] = layout[i] & 0xF;
+    }
+}
+
+void Chip8::setColors(std::uint32_t fg, std::uint32_t bg){
+    foreground = fg;
+    background = bg;
+}
+
+void Chip8::setPlaneColors(std::uint32_t second, std::uint32_t blend){
+    secondColor = second;
+    blendColor = blend;
+}
+
+
+void Chip8::enableTrace(const std::string& path, std::size_t records){
+    trace = std::make_unique<TraceWriter>(path, records);
+
+    if(!trace->ok()){
+        trace.reset();
+    }
+
+    selectStepFn();
+}
+
+void Chip8::attachDebugger(std::unique_ptr<Chip8Debugger> d){
+    debugger = std::move(d);
+    selectStepFn();
+}
+
+//Point stepFn to the cheapest method doing everything that's enabled
+void Chip8::selectStepFn(){
+    if(debugger)
+        stepFn = &Chip8::debuggedStep;
+    else if(trace)
+        stepFn = &Chip8::tracedStep;
+    else
+        stepFn = coreStep;
+
+    //Fused sequences would hide instructions from all of these
+    #ifdef CPP8_MEMPROFILE
+    constexpr bool profiling = true;
+    #else
+    constexpr bool profiling = false;
+    #endif
+
+    if(fusion && !debugger && !trace && !profiling)
+        fusedStepFn = fusedStepTable[quirks.toBits()];
+    else
+        fusedStepFn = nullptr;
+}
+
+
+void Chip8::enableLatencyProbe(){
+    latency = std::make_unique<LatencyProbe>();
+}
+
+#ifdef CPP8_MEMPROFILE
+const MemoryProfile& Chip8::getMemoryProfile() const{
+    return memoryProfile;
+}
+#endif
+
+const LatencyProbe* Chip8::getLatencyProbe() const{
+    return latency.get();
+}
+
+void Chip8::enableMetrics(const std::string& statsFile, bool overlay){
+    metrics = std::make_unique<Metrics>(statsFile);
+    showOverlay = overlay;
+}
+
+void Chip8::enableRecording(const std::string& path){
+    recorder = std::make_unique<FrameRecorder>(path, Chip8Screen::HIRES_WIDTH, Chip8Screen::HIRES_HEIGHT);
+
+    if(!recorder->ok()){
+        recorder.reset();
+    }
 }
 
+//Streams have one size, so low resolution frames are recorded with their pixels doubled
+void Chip8::recordFrame(const Chip8Screen& screen){
+    const int shift = screen.hires ? 0 : 1;
+
+    for(int y = 0; y < Chip8Screen::HIRES_HEIGHT; y++){
+        for(int x = 0; x < Chip8Screen::HIRES_WIDTH; x++){
+            recordPixels[y * Chip8Screen::HIRES_WIDTH + x] = screen.pixel(x >> shift, y >> shift);
+        }
+    }
+
+    recorder->record(recordPixels.data());
+}
+
+const Metrics* Chip8::getOverlay() const{
+    return showOverlay ? metrics.get() : nullptr;
+}
 
 int Chip8::getScale(){
     return scale;
 }
 
+void Chip8::reset(unsigned seed){
+    powerOn();
+    randEng.seed(seed);
+    intDist.reset();
+}
+
 void Chip8::run(){
-    msBuf=timeBetweenCycles;
+    cycleBuf=timeBetweenCycles;
     lastCycle=Clock::now();
     running = true;
 
@@ -67,43 +341,447 @@ void Chip8::run(){
     emscripten_set_main_loop_arg(mainLoopFunc_emscripten, this, hz, 1);
     #else
 
+    //A slow draw can't hold the game back, and a long run of instructions can't hold input back
+    std::thread emulation{[this]{
+        Clock::time_point start = Clock::now();
+
+        while(running){
+            emulate();
+            Clock::time_point executed = metrics ? Clock::now() : start;
+
+            if(needsInput()){
+                waitForInput();
+            }
+            else{
+                std::this_thread::sleep_for(timeBetweenCycles);
+            }
+
+            if(metrics){
+                Clock::time_point end = Clock::now();
+                metrics->addEmulationTime(executed - start, end - executed);
+                start = end;
+            }
+        }
+    }};
+
+    //Once per frame, check input and draw the newest frame,
+    //skipping the ones that came and went in between
+    Clock::time_point nextFrame = Clock::now();
     while(running){
-        mainLoopFunc();
-        std::this_thread::sleep_for(timeBetweenCycles);
+        if(metrics){
+            metrics->frameStart(std::chrono::steady_clock::now(), hz);
+        }
+
+        handleInput();
+
+        if(frames.update()){
+            presentFrame();
+        }
+
+        //What was on screen this frame, new or not
+        if(recorder){
+            recordFrame(frames.readBuffer().screen);
+        }
+
+        //If handleInput blocked past the frame, don't try to catch up
+        nextFrame += frameTime;
+        if(Clock::time_point now = Clock::now(); nextFrame < now){
+            nextFrame = now;
+        }
+        else{
+            std::this_thread::sleep_until(nextFrame);
+        }
     }
 
+    emulation.join();
+
     #endif
 }
 
 void Chip8::mainLoopFunc(){
+    if(metrics){
+        metrics->frameStart(std::chrono::steady_clock::now(), hz);
+    }
+
+    handleInput();
+
+    Clock::time_point start = metrics ? Clock::now() : Clock::time_point{};
+    emulate();
+
+    if(metrics){
+        metrics->addEmulationTime(Clock::now() - start, std::chrono::nanoseconds{0});
+    }
+
+    if(frames.update()){
+        presentFrame();
+    }
+
+    if(recorder){
+        recordFrame(frames.readBuffer().screen);
+    }
+}
+
+void Chip8::presentFrame(){
+    const Frame& frame = frames.readBuffer();
+    Clock::time_point start = metrics ? Clock::now() : Clock::time_point{};
+    draw(frame.screen);
+
+    if(metrics){
+        metrics->frameDrawn(Clock::now() - start);
+    }
+
+    //Frames keep the stamp until the next answered press, record it once
+    if(latency && frame.inputTime != lastRecorded){
+        lastRecorded = frame.inputTime;
+        latency->record(Clock::now() - frame.inputTime);
+    }
+}
+
+void Chip8::emulate(){
+    std::uint64_t cyclesBefore = core.cycles;
+    applyInput();
+    applyControl();
+    time now{Clock::now()};
+
+    if(idleFlag && !needsInput()){
+        idleFlag = false;
+        wakeUp();
+    }
+
     //If intepreter is not paused, do a full cycle
     if(pause == false){
-        time now{Clock::now()};
-        ms sinceLastCycle = std::chrono::duration_cast<ms>(now - lastCycle);
+        auto sinceLastCycle = std::chrono::duration_cast<std::chrono::microseconds>(now - lastCycle);
+
+        //VIP timing: a frame's worth of machine cycles for each frameTime in cycleBuf,
+        //the clock isn't looked at between the instructions of a frame.
+        //The timers tick at the end of each frame, like in runFrame()
+        if(vipTiming){
+            for(cycleBuf += sinceLastCycle; cycleBuf >= frameTime; cycleBuf -= frameTime){
+                core.cycles += runCycleBudget();
+                updateTone();
+                tickTimer(core.delayTimer);
+                tickTimer(core.soundTimer);
+            }
+        }
+        //Step for each timeBetweenCycles in cycleBuf
+        else{
+            //The timers go by the clock, once per pass is enough however many instructions are due
+            decrementTimer(core.delayTimer, delayModified);
+            decrementTimer(core.soundTimer, soundModified);
+
+            for(cycleBuf += sinceLastCycle; cycleBuf >= timeBetweenCycles;){
+                int executed = execute(static_cast<int>(std::min<std::int64_t>(cycleBuf / timeBetweenCycles, 3)));
+                core.cycles += executed;
+                cycleBuf -= timeBetweenCycles * executed;
+                updateTone();
+            }
+        }
+
+        //Once per pass: at XO-CHIP speeds a pass can draw hundreds of sprites,
+        //and only the last frame would be seen anyway
+        if(screenUpdated){
+            publishFrame();
+        }
+    }
+
+    if(metrics){
+        metrics->addInstructions(core.cycles - cyclesBefore);
+    }
+
+    //Don't catch up on the time spent paused
+    lastCycle = now;
+
+    //Nor on the time stopped in the debugger, which the instructions
+    //and timers of this pass didn't see go by
+    if(debuggerStopped){
+        debuggerStopped = false;
+        lastCycle = delayModified = soundModified = Clock::now();
+        cycleBuf = std::chrono::microseconds{0};
+    }
+}
+
+void Chip8::waitForInput(){
+    idleFlag = true;
+
+    //Timers keep ticking while waiting for a key
+    ms timeout = core.delayTimer || core.soundTimer ? decWait : ms{100};
+
+    std::unique_lock<std::mutex> lock{inputMutex};
+    inputArrived.wait_for(lock, timeout, [this]{ return !inputQueue.empty() || !controlQueue.empty() || !running; });
+    lock.unlock();
+
+    //Don't catch up on the time spent waiting
+    lastCycle = Clock::now();
+}
+
+void Chip8::queueInput(InputEvent e){
+    inputQueue.push(e);
+
+    notifyEmulation();
+}
+
+bool Chip8::queueControl(ControlCommand c){
+    if(!controlQueue.push(c)){
+        return false;
+    }
+
+    notifyEmulation();
+    return true;
+}
+
+void Chip8::notifyEmulation(){
+    //Taking the lock makes sure a thread about to wait sees the input, or gets the notification
+    std::lock_guard<std::mutex> lock{inputMutex};
+    inputArrived.notify_one();
+}
+
+void Chip8::publishFrame(){
+    Frame& frame = frames.writeBuffer();
+    frame.screen = core.screen;
+
+    if(pendingPress && core.screen != pressScreen){
+        frameInputTime = *pendingPress;
+        pendingPress.reset();
+    }
+
+    frame.inputTime = frameInputTime;
+    frames.publish();
+    screenUpdated = false;
+
+    if(metrics){
+        metrics->addFramePublished();
+    }
+}
+
+//Paused, or in FX0A with no key pressed yet
+bool Chip8::needsInput() const{
+    return pause || (core.waitingForKey && !k);
+}
+
+bool Chip8::idle() const{
+    return idleFlag;
+}
 
-        //Step for each timeBetweenCycles in msBuf
-        for(msBuf += sinceLastCycle; msBuf >= timeBetweenCycles; msBuf -= timeBetweenCycles){
-            handleInput();
-            decrementTimer(delayTimer);
+void Chip8::applyInput(){
+    InputEvent e;
 
-            //Play sound if soundTimer was decremented to 0
-            if(decrementTimer(soundTimer) && soundTimer.ticks == 0){
-                playSound();
+    while(inputQueue.pop(e)){
+        switch(e.type){
+            case InputEvent::PRESS:
+                core.keys[e.key] = true;
+
+                //Measure from the first press the screen hasn't answered yet
+                if(latency && !pendingPress){
+                    pendingPress = e.stamp;
+                    pressScreen = core.screen;
+                }
+
+                if(core.waitingForKey){
+                    k = e.key;
+                }
+            break;
+
+            case InputEvent::RELEASE:
+                core.keys[e.key] = false;
+            break;
+
+            case InputEvent::PAUSE:
+                setPause(!pause);
+            break;
+        }
+    }
+}
+
+void Chip8::applyControl(){
+    ControlCommand c;
+
+    while(controlQueue.pop(c)){
+        switch(c.type){
+            case ControlCommand::PAUSE:
+                setPause(true);
+            break;
+
+            case ControlCommand::RESUME:
+                setPause(false);
+            break;
+
+            //Stepping while running would only make the game jump ahead
+            case ControlCommand::STEP:
+                if(pause){
+                    for(std::uint32_t i = 0; i < c.value;){
+                        int executed = execute(static_cast<int>(std::min<std::uint32_t>(c.value - i, 3)));
+                        core.cycles += executed;
+                        i += executed;
+                    }
+
+                    if(screenUpdated){
+                        publishFrame();
+                    }
+                }
+            break;
+
+            case ControlCommand::POKE:{
+                const std::uint16_t address = c.address & (getMemorySize() - 1);
+                getMemory()[address] = static_cast<std::uint8_t>(c.value);
+                forgetFusions(address, 1);
             }
-        
-            step();
+            break;
+
+            case ControlCommand::SET_REGISTER:
+                setRegister(static_cast<Register>(c.target), static_cast<std::uint16_t>(c.value));
+            break;
 
-            if(screenUpdated){
-                draw(screen);
-                screenUpdated = false;
+            case ControlCommand::PRESS:
+                core.keys[c.target] = true;
+
+                if(core.waitingForKey){
+                    k = c.target;
+                }
+            break;
+
+            case ControlCommand::RELEASE:
+                core.keys[c.target] = false;
+            break;
+
+            //Dropped if the controlling thread hasn't taken the last ones
+            case ControlCommand::SNAPSHOT:{
+                Snapshot snapshot;
+                snapshot.cycles = core.cycles;
+                snapshot.PC = core.PC;
+                snapshot.I = core.I;
+                std::copy(std::begin(core.V), std::end(core.V), snapshot.V);
+                snapshot.delayTimer = core.delayTimer;
+                snapshot.soundTimer = core.soundTimer;
+                snapshot.stackDepth = core.SP;
+                snapshot.paused = pause;
+                snapshot.memory.assign(getMemory(), getMemory() + getMemorySize());
+                snapshot.screen = core.screen;
+                snapshots.push(snapshot);
             }
-            lastCycle = now;
+            break;
         }
     }
-    //If interpreter is paused, just check for input
+}
+
+void Chip8::setRegister(Register r, std::uint16_t value){
+    switch(r){
+        case Register::I:
+            core.I = value;
+        break;
+
+        //Instructions are 2 bytes, the last one starts 2 bytes before the end of RAM
+        case Register::PC:{
+            const int size = getMemorySize();
+            core.PC = static_cast<std::uint16_t>(std::min(value & (size - 1), size - 2));
+        }
+        break;
+
+        case Register::DELAY:
+            core.delayTimer = static_cast<std::uint8_t>(value);
+            delayModified = Clock::now();
+        break;
+
+        case Register::SOUND:
+            core.soundTimer = static_cast<std::uint8_t>(value);
+            soundModified = Clock::now();
+        break;
+
+        default:
+            core.V[static_cast<int>(r)] = static_cast<std::uint8_t>(value);
+        break;
+    }
+}
+
+void Chip8::setPause(bool paused){
+    pause = paused;
+
+    //Don't beep through the pause, updateTone() restarts it
+    if(pause && toneOn){
+        toneOn = false;
+        setTone(false);
+    }
+}
+
+
+//Emulate one 60hz frame without looking at the clock
+void Chip8::runFrame(){
+    applyInput();
+    applyControl();
+
+    if(vipTiming){
+        core.cycles += runCycleBudget();
+    }
     else{
-        handleInput();
-    } 
+        //hz is not always a multiple of 60, carry the remainder over to the next frame
+        frameCycleCarry += hz;
+        int frameCycles = frameCycleCarry / 60;
+        frameCycleCarry %= 60;
+
+        for(int i = 0; i < frameCycles;){
+            int executed = execute(frameCycles - i);
+            core.cycles += executed;
+            i += executed;
+        }
+    }
+
+    //Before the timers tick, so that a sound timer of N beeps for N frames
+    updateTone();
+
+    tickTimer(core.delayTimer);
+    tickTimer(core.soundTimer);
+
+    if(screenUpdated){
+        draw(core.screen);
+        screenUpdated = false;
+    }
+
+    if(recorder){
+        recordFrame(core.screen);
+    }
+}
+
+const Chip8Screen& Chip8::getScreen() const{
+    return core.screen;
+}
+
+std::uint8_t* Chip8::getMemory(){
+    return quirks.xoChip ? xoMemory.data() : core.mem.data();
+}
+
+const std::uint8_t* Chip8::getMemory() const{
+    return quirks.xoChip ? xoMemory.data() : core.mem.data();
+}
+
+int Chip8::getMemorySize() const{
+    return quirks.xoChip ? Chip8Core::XO_RAM_SIZE : Chip8Core::RAM_SIZE;
+}
+
+std::uint16_t Chip8::getPC() const{
+    return core.PC;
+}
+
+const std::uint8_t* Chip8::getRegisters() const{
+    return core.V;
+}
+
+std::uint16_t Chip8::getI() const{
+    return core.I;
+}
+
+std::uint32_t Chip8::getForeground() const{
+    return foreground;
+}
+
+std::uint32_t Chip8::getBackground() const{
+    return background;
+}
+
+std::uint32_t Chip8::getSecondColor() const{
+    return secondColor;
+}
+
+std::uint32_t Chip8::getBlendColor() const{
+    return blendColor;
 }
 
 
@@ -124,11 +802,31 @@ void Chip8::mainLoopFunc_emscripten(void* chip8ptr){
 
 
 
+//The address after the instruction at addr, for the skips
+template<unsigned Q>
+std::uint16_t Chip8::skipFrom(std::uint16_t addr) const{
+    if constexpr(Q & XO_CHIP){
+        constexpr std::uint16_t mask = addressMask<Q>();
+
+        //F000 NNNN
+        if(xoMemory[addr & mask] == 0xF0 && xoMemory[(addr + 1) & mask] == 0x00){
+            return addr + 4;
+        }
+    }
+
+    return addr + 2;
+}
+
+template<unsigned Q>
 void Chip8::step()
 {
-    //Opcodes are made of 2 bytes each.
-    std::uint8_t high = mem[PC];
-    std::uint8_t low = mem[PC+1];
+    constexpr std::uint16_t mask = addressMask<Q>();
+    std::uint8_t* const mem = memory<Q>();
+    PROFILE_MEMORY(fetch(core.PC, mask));
+
+    //Opcodes are made of 2 bytes each, but for the XO-CHIP F000 NNNN.
+    std::uint8_t high = mem[core.PC & mask];
+    std::uint8_t low = mem[(core.PC + 1) & mask];
 
     //Get the various parts of the opcode
     //For NXYN instructions
@@ -140,7 +838,7 @@ void Chip8::step()
 
     //By default the PC will be pointed to the next opcode.
     //But this variable might be modified by jump instructions and others.
-    std::uint16_t nextAddr = PC + 2;
+    std::uint16_t nextAddr = core.PC + 2;
 
 
     //Find out which opcode we're dealing with
@@ -149,21 +847,63 @@ void Chip8::step()
         case 0x00:
             switch(low){
                 //00E0 - CLS
-                //Clear the display.
+                //Clear the display. In XO-CHIP, only the selected planes.
                 case 0xE0:
-                    screen.fill(false);
-                    screenUpdated = true;
+                    clearPlanes();
                 break;
 
                 //00EE - RET
                 //Set PC to the instruction after the one pointed by the top of the stack, then dec SP
                 case 0xEE:
-                    nextAddr = stack.top() + 2;
-                    stack.pop();
+                    if(core.SP > 0){
+                        nextAddr = core.stack[--core.SP] + 2;
+                    }
+                    else{
+                        std::cerr << "Return with an empty stack at " << std::hex << core.PC << std::dec << std::endl;
+                    }
                 break;
 
+                //00FB - SCR (SUPER-CHIP)
+                //Scroll the display right by 4 pixels
+                case 0xFB:
+                    scrollRight();
+                break;
+
+                //00FC - SCL (SUPER-CHIP)
+                //Scroll the display left by 4 pixels
+                case 0xFC:
+                    scrollLeft();
+                break;
+
+                //00FD - EXIT (SUPER-CHIP)
+                //Stop the program. It stays on this instruction, like a game halting with 1NNN
+                case 0xFD:
+                    nextAddr = core.PC;
+                break;
+
+                //00FE - LOW (SUPER-CHIP)
+                //64x32 display
+                case 0xFE:
+                    setHires(false);
+                break;
+
+                //00FF - HIGH (SUPER-CHIP)
+                //128x64 display
+                case 0xFF:
+                    setHires(true);
+                break;
+
+                //00CN - SCD N (SUPER-CHIP)
+                //Scroll the display down by N pixels
+                //00DN - SCU N (XO-CHIP)
+                //Scroll the display up by N pixels
                 default:
-                    reportCode(high, low);
+                    if((low & 0xF0) == 0xC0)
+                        scrollDown(low & 0x0F);
+                    else if((Q & XO_CHIP) && (low & 0xF0) == 0xD0)
+                        scrollUp(low & 0x0F);
+                    else
+                        reportCode(high, low);
                 break;
             }
         break;
@@ -177,23 +917,29 @@ void Chip8::step()
         //2NNN - CALL ADDR
         //Inc SP, then put current PC on top of stack. Then PC = NNN
         case 0x20:
-            stack.push(PC);
-            nextAddr = nnn;
+            if(core.SP < Chip8Core::STACK_SIZE){
+                core.stack[core.SP++] = core.PC;
+                nextAddr = nnn;
+            }
+            else{
+                std::cerr << "Stack overflow at " << std::hex << core.PC << std::dec << std::endl;
+            }
         break;
 
         //3XKK - SE VX, BYTE
         //Skip next instruction if Vx == kk
+        //In XO-CHIP the next instruction may be the 4 bytes of F000 NNNN, and so in all the skips
         case 0x30:
-            if(V[x] == low){
-                nextAddr = PC + 4;
+            if(core.V[x] == low){
+                nextAddr = skipFrom<Q>(core.PC + 2);
             }
         break;
 
         //4XKK - SNE VX, BYTE
         //Skip next instruction if Vx != kk
         case 0x40:
-            if(V[x] != low){
-                nextAddr = PC + 4;
+            if(core.V[x] != low){
+                nextAddr = skipFrom<Q>(core.PC + 2);
             }
         break;
 
@@ -203,8 +949,41 @@ void Chip8::step()
                 //5XY0 - SE Vx, Vy
                 //Skip next instruction if Vx == Vy
                 case 0x00:
-                    if(V[x] == V[y]){
-                        nextAddr = PC + 4;
+                    if(core.V[x] == core.V[y]){
+                        nextAddr = skipFrom<Q>(core.PC + 2);
+                    }
+                break;
+
+                //5XY2 - SAVE Vx - Vy (XO-CHIP)
+                //Store registers Vx through Vy starting at location I,
+                //in reverse order if x > y. I is left as is.
+                case 0x02:
+                    if constexpr(Q & XO_CHIP){
+                        const int count = std::abs(x - y) + 1;
+                        const int direction = x <= y ? 1 : -1;
+                        PROFILE_MEMORY(write(core.I, count, mask, core.PC, core.cycles));
+                        for(int i = 0; i < count; i++)
+                            mem[(core.I + i) & mask] = core.V[x + i * direction];
+                        forgetFusions(core.I, count);
+                    }
+                    else{
+                        reportCode(high, low);
+                    }
+                break;
+
+                //5XY3 - LOAD Vx - Vy (XO-CHIP)
+                //Read registers Vx through Vy from memory starting at location I,
+                //in reverse order if x > y. I is left as is.
+                case 0x03:
+                    if constexpr(Q & XO_CHIP){
+                        const int count = std::abs(x - y) + 1;
+                        const int direction = x <= y ? 1 : -1;
+                        PROFILE_MEMORY(read(core.I, count, mask));
+                        for(int i = 0; i < count; i++)
+                            core.V[x + i * direction] = mem[(core.I + i) & mask];
+                    }
+                    else{
+                        reportCode(high, low);
                     }
                 break;
 
@@ -217,12 +996,12 @@ void Chip8::step()
         //6XKK - LD Vx, byte
         //Set Vx = kk
         case 0x60:
-            V[x] = low;
+            core.V[x] = low;
         break;
 
         //7XKK - ADD Vx, byte
         case 0x70:
-            V[x] += low;
+            core.V[x] += low;
         break;
 
         //opcodes starting with 8
@@ -231,25 +1010,28 @@ void Chip8::step()
                 //8XY0 - LD Vx, Vy
                 //Set Vx = Vy
                 case 0x00:
-                    V[x] = V[y];
+                    core.V[x] = core.V[y];
                 break;
 
                 //8XY1 - OR Vx, Vy
                 //Set Vx = Vx OR Vy
                 case 0x01:
-                    V[x] |= V[y];
+                    core.V[x] |= core.V[y];
+                    if constexpr(Q & VF_RESET) core.V[0xF] = 0;
                 break;
 
                 //8XY2 - AND Vx, Vy
                 //Set Vx = Vx AND Vy
                 case 0x02:
-                    V[x] &= V[y];
+                    core.V[x] &= core.V[y];
+                    if constexpr(Q & VF_RESET) core.V[0xF] = 0;
                 break;
 
                 //8XY3 - XOR Vx, Vy
                 //Set Vx = Vx XOR Vy
                 case 0x03:
-                    V[x] ^= V[y];
+                    core.V[x] ^= core.V[y];
+                    if constexpr(Q & VF_RESET) core.V[0xF] = 0;
                 break;
 
                 //8XY4 - ADD Vx, Vy
@@ -257,10 +1039,12 @@ void Chip8::step()
                 //Set VF to 1 if result is greater than 255
                 //Otherwise, set VF to 0
                 //Only the 8 lowest bits of the result are stored in Vx
+                //In this and the following instructions VF is written last,
+                //so the flag wins when X is F.
                 case 0x04:{
-                    std::uint16_t result = V[x] + V[y];
-                    V[0xF] = (result > 255) ? 1 : 0;
-                    V[x] = result & 0x00FF;
+                    std::uint16_t result = core.V[x] + core.V[y];
+                    core.V[x] = result & 0x00FF;
+                    core.V[0xF] = (result > 255) ? 1 : 0;
                 }
                 break;
 
@@ -268,9 +1052,11 @@ void Chip8::step()
                 //VF is set to NOT borrow.
                 //If Vx > Vy, VF is set to 1, otherwise 0.
                 //Then Vx = Vx - Vy
-                case 0x05:
-                    V[0xF] = (V[x] > V[y]) ? 1 : 0;
-                    V[x] -= V[y];
+                case 0x05:{
+                    std::uint8_t notBorrow = (core.V[x] > core.V[y]) ? 1 : 0;
+                    core.V[x] -= core.V[y];
+                    core.V[0xF] = notBorrow;
+                }
                 break;
 
                 //This instruction has 2 versions
@@ -281,26 +1067,30 @@ void Chip8::step()
                     //Otherwise, it is set to 0.
                     //Then Vx is divided by 2.
                     //Y seems to be ignored.
-                    if(chip48){
-                        V[0xF] = V[x] & 1;
-                        V[x] >>= 1;
+                    if constexpr(Q & SHIFT_VX){
+                        std::uint8_t lsb = core.V[x] & 1;
+                        core.V[x] >>= 1;
+                        core.V[0xF] = lsb;
                     }
 
                     //CHIP-8
                     //Store the value of register VY shifted right one bit in register VX
                     //Set register VF to the least significant bit prior to the shift
                     else{
-                        V[0xF] = V[y] & 1;
-                        V[x] = V[y] >> 1;
+                        std::uint8_t lsb = core.V[y] & 1;
+                        core.V[x] = core.V[y] >> 1;
+                        core.V[0xF] = lsb;
                     }
                 break;
 
                 //8XY7 - SUBN Vx, Vy
                 //Vx = Vy - Vx
                 //Set VF = NOT borrow
-                case 0x07:
-                    V[0xF] = (V[y] > V[x]) ? 1 : 0;
-                    V[x] = V[y] - V[x];
+                case 0x07:{
+                    std::uint8_t notBorrow = (core.V[y] > core.V[x]) ? 1 : 0;
+                    core.V[x] = core.V[y] - core.V[x];
+                    core.V[0xF] = notBorrow;
+                }
                 break;
 
                 //This instruction has 2 versions
@@ -311,16 +1101,18 @@ void Chip8::step()
                     //Otherwise, it is set to 0.
                     //Then Vx is multiplied by 2.
                     //Y seems to be ignored.
-                    if(chip48){
-                        V[0xF] = (V[x] & 128) >> 7;
-                        V[x] <<= 1;
+                    if constexpr(Q & SHIFT_VX){
+                        std::uint8_t msb = (core.V[x] & 128) >> 7;
+                        core.V[x] <<= 1;
+                        core.V[0xF] = msb;
                     }
                     //CHIP-8
                     //Store the value of register VY shifted left one bit in register VX
                     //Set register VF to the most significant bit prior to the shift
                     else{
-                        V[0xF] = (V[y] & 128) >> 7;
-                        V[x] = V[y] << 1;
+                        std::uint8_t msb = (core.V[y] & 128) >> 7;
+                        core.V[x] = core.V[y] << 1;
+                        core.V[0xF] = msb;
                     }
                 break;
 
@@ -336,8 +1128,8 @@ void Chip8::step()
                 //SNE Vx, Vy
                 //Skip next instruction if Vx != Vy
                 case 0x00:
-                    if(V[x] != V[y]){
-                        nextAddr = PC + 4;
+                    if(core.V[x] != core.V[y]){
+                        nextAddr = skipFrom<Q>(core.PC + 2);
                     }
                 break;
 
@@ -350,27 +1142,33 @@ void Chip8::step()
         //ANNN - LD I, ADDR
         //Set I = NNN
         case 0xA0:
-            I = nnn;
+            core.I = nnn;
         break;
 
         //BNNN - JP V0, ADDR
         //JMP to NNN + V0
+        //With the jumpVx quirk it's BXNN, JMP to XNN + Vx
         case 0xB0:
-            nextAddr = nnn + V[0];
+            if constexpr(Q & JUMP_VX)
+                nextAddr = nnn + core.V[x];
+            else
+                nextAddr = nnn + core.V[0];
         break;
 
         //CXKK - RND Vx, byte
         //Set Vx = randBye AND kk
         case 0xC0:
-            V[x] = intDist(randEng) & low;
+            core.V[x] = intDist(randEng) & low;
         break;
 
         //DXYN - DRW Vx, Vy, nibble
         //Display N-Bythe sprite starting at memory location I,
         //placing it at (Vx, Vy).
+        //DXY0 displays a 16x16 sprite of 32 bytes (SUPER-CHIP).
+        //In XO-CHIP it's drawn to each selected plane, the sprites for each following each other.
         //Set VF = collision.
         case 0xD0:
-            V[0xF] = drawSprite(V[x], V[y], I, low & 0x0F);
+            core.V[0xF] = drawSprite<Q>(core.V[x], core.V[y], core.I, low & 0x0F);
             screenUpdated = true;
         break;
 
@@ -382,16 +1180,16 @@ void Chip8::step()
                 //EX9E - SKP Vx
                 //Skip next instruction if key Vx is pressed
                 case 0x9E:
-                    if(keys[V[x]]){
-                        nextAddr = PC + 4;
+                    if(core.keys[core.V[x] & 0xF]){
+                        nextAddr = skipFrom<Q>(core.PC + 2);
                     }
                 break;
 
                 //EXA1 - SKNP Vx
                 //Skip next instruction if key Vx is not pressed
                 case 0xA1:
-                    if(keys[V[x]] == false){
-                        nextAddr = PC + 4;
+                    if(core.keys[core.V[x] & 0xF] == false){
+                        nextAddr = skipFrom<Q>(core.PC + 2);
                     }
                 break;
 
@@ -405,48 +1203,84 @@ void Chip8::step()
         case 0xF0:
             switch(low){
 
+                //F000 NNNN - LD I, LONG NNNN (XO-CHIP)
+                //Set I = NNNN, the 2 bytes after the instruction
+                case 0x00:
+                    if constexpr(Q & XO_CHIP){
+                        if(x == 0){
+                            PROFILE_MEMORY(fetch(core.PC + 2, mask));
+                            core.I = mem[(core.PC + 2) & mask] << 8 | mem[(core.PC + 3) & mask];
+                            nextAddr = core.PC + 4;
+                        }
+                    }
+                break;
+
+                //FN01 - PLANE N (XO-CHIP)
+                //Select the planes drawn, cleared and scrolled: bit n for plane n
+                case 0x01:
+                    if constexpr(Q & XO_CHIP){
+                        if(x < 4){
+                            core.planeMask = x;
+                        }
+                    }
+                break;
+
+                //F002 - AUDIO (XO-CHIP)
+                //Load the 16 bytes at I into the audio pattern
+                case 0x02:
+                    if constexpr(Q & XO_CHIP){
+                        if(x == 0){
+                            PROFILE_MEMORY(read(core.I, 16, mask));
+                            for(int i = 0; i < 16; i++)
+                                core.audioPattern[i] = mem[(core.I + i) & mask];
+                            core.patternLoaded = true;
+                            patternChanged = true;
+                        }
+                    }
+                break;
+
                 //FX07 - LD Vx, DT
                 //Set Vx = delay timer
                 case 0x07:
-                    V[x] = delayTimer.ticks;
+                    core.V[x] = core.delayTimer;
                 break;
 
                 //FX0A - LD Vx, K
                 //Wait for keypress, store keypress in Vx
                 case 0x0A:
-                    if(waitingForKey == false){
-                        waitingForKey = true;
-                        nextAddr = PC;
+                    if(core.waitingForKey == false){
+                        core.waitingForKey = true;
+                        nextAddr = core.PC;
                     }
                     else if(k.has_value()){
-                        V[x] = k.value();
-                        waitingForKey = false;
+                        core.V[x] = k.value();
+                        core.waitingForKey = false;
                         k.reset();
-                        nextAddr = PC + 2;
+                        nextAddr = core.PC + 2;
                     }
                     else{
-                        nextAddr = PC;
+                        nextAddr = core.PC;
                     }
                 break;
 
                 //FX15 - LD DT, Vx
                 //Set delay timer to Vx
                 case 0x15:
-                    delayTimer.ticks = V[x];
-                    delayTimer.lastModified = Clock::now();
+                    core.delayTimer = core.V[x];
+                    delayModified = Clock::now();
                 break;
 
                 //FX18 - LD ST, Vx
                 //Set sound timer to Vx
                 case 0x18:
-                    soundTimer.ticks = V[x];
-                    soundTimer.lastModified = Clock::now();
+                    core.soundTimer = core.V[x];
+                    soundModified = Clock::now();
                 break;
 
                 //FX1E - ADD I, Vx
                 //Set I = I + Vx
                 case 0x1E:
-                    I += V[x];
+                    core.I += core.V[x];
                 break;
 
                 //FX29 - LD F, Vx
@@ -455,32 +1289,68 @@ void Chip8::step()
                     //Each sprite is 5 bytes long.
                     //They are stored in crescent order,
                     //starting at addr 0.
-                    I = V[x] * 5;
+                    core.I = core.V[x] * 5;
+                break;
+
+                //FX30 - LD HF, Vx (SUPER-CHIP)
+                //Set I = location of the 8x10 sprite for digit Vx
+                case 0x30:
+                    core.I = BIG_FONT_ADDRESS + (core.V[x] & 0x0F) * 10;
                 break;
 
                 //FX33 - LD B, Vx
                 //Store BCD representation in memory locations I, I+1 and I+2
                 //Hundreds digit at I, tens at I+1, ones at I+2
                 case 0x33:
-                    mem[I] = V[x] / 100;
-                    mem[I+1] = (V[x] / 10) % 10;
-                    mem[I+2] = V[x] % 10;
+                    PROFILE_MEMORY(write(core.I, 3, mask, core.PC, core.cycles));
+                    mem[core.I & mask] = core.V[x] / 100;
+                    mem[(core.I + 1) & mask] = (core.V[x] / 10) % 10;
+                    mem[(core.I + 2) & mask] = core.V[x] % 10;
+                    forgetFusions(core.I, 3);
                 break;
 
                 //FX55 - LD [I], Vx
                 //Store registers V0 through Vx,
                 //starting at location I.
+                //With the incrementI quirk, I is left at I + x + 1
                 case 0x55:
+                    PROFILE_MEMORY(write(core.I, x + 1, mask, core.PC, core.cycles));
                     for(int i = 0; i <= x; i++)
-                        mem[I+i] = V[i];
+                        mem[(core.I + i) & mask] = core.V[i];
+                    forgetFusions(core.I, x + 1);
+                    if constexpr(Q & INCREMENT_I) core.I += x + 1;
                 break;
 
                 //FX65 - LD Vx, [I]
                 //Read registers V0 through Vx from memory,
                 //starting at location I
+                //With the incrementI quirk, I is left at I + x + 1
                 case 0x65:
+                    PROFILE_MEMORY(read(core.I, x + 1, mask));
                     for(int i = 0; i <= x; i++)
-                        V[i] = mem[I+i];
+                        core.V[i] = mem[(core.I + i) & mask];
+                    if constexpr(Q & INCREMENT_I) core.I += x + 1;
+                break;
+
+                //FX3A - PITCH Vx (XO-CHIP)
+                //Set the playback rate of the audio pattern to 4000*2^((Vx-64)/48) samples per second
+                case 0x3A:
+                    if constexpr(Q & XO_CHIP){
+                        core.pitch = core.V[x];
+                        patternChanged = true;
+                    }
+                break;
+
+                //FX75 - LD R, Vx (SUPER-CHIP)
+                //Store registers V0 through Vx in the RPL user flags
+                case 0x75:
+                    std::copy(core.V, core.V + x + 1, core.flags);
+                break;
+
+                //FX85 - LD Vx, R (SUPER-CHIP)
+                //Read registers V0 through Vx from the RPL user flags
+                case 0x85:
+                    std::copy(core.flags, core.flags + x + 1, core.V);
                 break;
             }
         break;
@@ -489,7 +1359,181 @@ void Chip8::step()
     } //End first nibble switch
 
     //Go to next address
-    PC = nextAddr;
+    COVER_EDGE(core.PC, nextAddr & mask);
+    core.PC = nextAddr & mask;
+}
+
+
+int Chip8::execute(int budget){
+    if(fusedStepFn && budget > 1){
+        return (this->*fusedStepFn)(budget);
+    }
+
+    (this->*stepFn)();
+    return 1;
+}
+
+//The budget is topped up once per frame, an instruction running over is paid from the next one
+int Chip8::runCycleBudget(){
+    const std::uint16_t mask = getMemorySize() - 1;
+    int executed = 0;
+
+    for(cycleBudget += VIP_FRAME_BUDGET; cycleBudget > 0;){
+        const VipCost cost = vipCost(core, getMemory(), mask);
+        (this->*stepFn)();
+        executed++;
+        cycleBudget -= cost.cycles;
+
+        //The VIP interpreter draws in step with the display interrupt,
+        //whatever is left of the frame is spent waiting for it
+        if(cost.displayWait){
+            cycleBudget = std::min(cycleBudget, 0);
+        }
+    }
+
+    return executed;
+}
+
+template<unsigned Q>
+int Chip8::fusedStep(int budget){
+    const std::uint8_t* code = memory<Q>() + core.PC;
+    std::uint8_t id = fusionHints[core.PC];
+
+    //Looked for the first time the address is executed, sequences don't wrap around the memory.
+    //A hint is checked against the code before it's used: writes through getMemory()
+    //and Chip8Env::ram() don't go through forgetFusions.
+    if(id != UNKNOWN_FUSION && id != NO_FUSION && !matchFusion(static_cast<FusionId>(id), code)){
+        id = UNKNOWN_FUSION;
+    }
+    if(id == UNKNOWN_FUSION){
+        id = core.PC + std::size_t{6} <= std::size_t{addressMask<Q>()} + 1 ? findFusion(code) : NO_FUSION;
+        fusionHints[core.PC] = id;
+    }
+
+    if(id != NO_FUSION && fusionPatterns[id - 1].length <= budget){
+        [[maybe_unused]] std::uint16_t from = core.PC;
+        int executed = fused<Q>(id);
+        COVER_EDGE(from, core.PC);
+        return executed;
+    }
+
+    step<Q>();
+    return 1;
+}
+
+//Each case does exactly what step() does for the instructions of the sequence
+template<unsigned Q>
+int Chip8::fused(std::uint8_t id){
+    constexpr std::uint16_t mask = addressMask<Q>();
+    std::uint8_t* const mem = memory<Q>();
+    const std::uint8_t* code = mem + core.PC;
+    std::uint8_t x0 = code[0] & 0x0F;
+    std::uint8_t x1 = code[2] & 0x0F;
+
+    switch(id){
+        //FX07 3X00 1NNN
+        case FUSE_WAIT_DELAY:
+            core.V[x0] = core.delayTimer;
+            core.PC = core.V[x0] == 0 ? (core.PC + 6) & mask : getNNN(code[4], code[5]);
+        return 3;
+
+        //6XKK 6YKK
+        case FUSE_LOAD_LOAD:
+            core.V[x0] = code[1];
+            core.V[x1] = code[3];
+            core.PC = (core.PC + 4) & mask;
+        return 2;
+
+        //ANNN DXYN
+        case FUSE_INDEX_DRAW:
+            core.I = getNNN(code[0], code[1]);
+            core.V[0xF] = drawSprite<Q>(core.V[x1], core.V[code[3] >> 4], core.I, code[3] & 0x0F);
+            screenUpdated = true;
+            core.PC = (core.PC + 4) & mask;
+        return 2;
+
+        //7XKK 3XKK
+        case FUSE_ADD_SKIP:
+            core.V[x0] += code[1];
+            core.PC = (core.V[x1] == code[3] ? skipFrom<Q>(core.PC + 4) : core.PC + 4) & mask;
+        return 2;
+
+        //FX1E FY65
+        case FUSE_ADD_LOAD:
+            core.I += core.V[x0];
+            for(int i = 0; i <= x1; i++)
+                core.V[i] = mem[(core.I + i) & mask];
+            if constexpr(Q & INCREMENT_I) core.I += x1 + 1;
+            core.PC = (core.PC + 4) & mask;
+        return 2;
+    }
+
+    step<Q>();
+    return 1;
+}
+
+void Chip8::forgetFusions(int addr, int count){
+    //The longest sequence is 6 bytes, so the ones starting
+    //up to 5 bytes before addr may have changed too
+    for(int a = addr - 5; a < addr + count; a++){
+        fusionHints[a & (fusionHints.size() - 1)] = UNKNOWN_FUSION;
+    }
+}
+
+//step(), then write what it did to the trace
+void Chip8::tracedStep(){
+    TraceRecord record;
+    record.cycle = core.cycles;
+    record.pc = core.PC;
+    record.opcode = (getMemory()[core.PC] << 8) | getMemory()[(core.PC + 1) & (getMemorySize() - 1)];
+
+    std::uint64_t before[2];
+    std::memcpy(before, core.V, sizeof(core.V));
+
+    (this->*coreStep)();
+
+    std::uint64_t after[2];
+    std::memcpy(after, core.V, sizeof(core.V));
+
+    record.I = core.I;
+    record.reg = TraceRecord::NO_REG;
+    record.value = 0;
+
+    //Find the changed register, preferring anything to VF.
+    //Compare 8 registers at a time, then look for the byte.
+    if(before[0] != after[0] || before[1] != after[1]){
+        int first = before[0] != after[0] ? 0 : 8;
+
+        for(int i = first; i < 16; i++){
+            if(reinterpret_cast<const std::uint8_t*>(before)[i] != core.V[i]){
+                record.reg = i;
+                record.value = core.V[i];
+                break;
+            }
+        }
+    }
+
+    trace->write(record);
+}
+
+
+//Let the debugger decide whether to stop, then step
+void Chip8::debuggedStep(){
+    //Once the user quits from the debugger, don't ask it again
+    if(!running){
+        return;
+    }
+
+    if(debugger->beforeStep(*this)){
+        debuggerStopped = true;
+    }
+
+    if(running){
+        if(trace)
+            tracedStep();
+        else
+            (this->*coreStep)();
+    }
 }
 
 
@@ -514,11 +1558,7 @@ void Chip8::pressKey(std::uint8_t key){
         std::cerr << "Key does not exist! " << key << std::endl;
     }
     else{
-        keys[key] = true;
-
-        if(waitingForKey){
-            k = key;
-        }
+        queueInput({InputEvent::PRESS, keyLayout[key], latency ? Clock::now() : Clock::time_point{}});
     }
 }
 
@@ -528,85 +1568,391 @@ void Chip8::releaseKey(std::uint8_t key){
         std::cerr << "Key does not exist! " << key << std::endl;
     }
     else{
-        keys[key] = false;
+        queueInput({InputEvent::RELEASE, keyLayout[key]});
     }
 }
 
 void Chip8::togglePause(){
-    pause = !pause;
+    queueInput({InputEvent::PAUSE, 0});
 }
 
 void Chip8::stop(){
     running = false;
+    notifyEmulation();
+}
+
+bool Chip8::controlPause(){
+    return queueControl({ControlCommand::PAUSE, 0, 0, 0});
+}
+
+bool Chip8::controlResume(){
+    return queueControl({ControlCommand::RESUME, 0, 0, 0});
+}
+
+bool Chip8::controlStep(int instructions){
+    return instructions <= 0 || queueControl({ControlCommand::STEP, 0, 0, static_cast<std::uint32_t>(instructions)});
+}
+
+bool Chip8::controlPoke(std::uint16_t address, std::uint8_t value){
+    return queueControl({ControlCommand::POKE, 0, address, value});
+}
+
+bool Chip8::controlSetRegister(Register r, std::uint16_t value){
+    return queueControl({ControlCommand::SET_REGISTER, static_cast<std::uint8_t>(r), 0, value});
+}
+
+bool Chip8::controlPressKey(std::uint8_t key){
+    return queueControl({ControlCommand::PRESS, static_cast<std::uint8_t>(key & 0xF), 0, 0});
+}
+
+bool Chip8::controlReleaseKey(std::uint8_t key){
+    return queueControl({ControlCommand::RELEASE, static_cast<std::uint8_t>(key & 0xF), 0, 0});
+}
+
+bool Chip8::controlSnapshot(){
+    return queueControl({ControlCommand::SNAPSHOT, 0, 0, 0});
+}
+
+std::optional<Chip8::Snapshot> Chip8::takeSnapshot(){
+    Snapshot snapshot;
+
+    if(!snapshots.pop(snapshot)){
+        return std::nullopt;
+    }
+
+    return snapshot;
+}
+
+void Chip8::breakIntoDebugger(){
+    if(debugger){
+        debugger->requestStop();
+    }
 }
 
 
 //Helper method for draw instruction
 //Returns true if collifion happened
+//The sprite always starts on screen, its position wraps around.
+//Then the pixels going over the edges wrap around too, or are clipped.
+//Each sprite row is placed in the one or two words of the screen row it covers,
+//then XORed onto them a word at a time.
+template<unsigned Q>
 bool Chip8::drawSprite(int x, int y, std::uint16_t addr, std::size_t len){
-    bool collision = false;
+    constexpr bool clip = (Q & CLIP_SPRITES) != 0;
+    constexpr std::uint16_t mask = addressMask<Q>();
+    constexpr int planes = Q & XO_CHIP ? Chip8Screen::PLANES : 1;
+    const std::uint8_t* const mem = memory<Q>();
+
+    Chip8Screen& screen = core.screen;
+    const int width = screen.width();
+    const int height = screen.height();
+    const int words = screen.wordsPerRow();
+
+    //Both resolutions are powers of 2
+    x &= width - 1;
+    y &= height - 1;
+
+    const bool wide = len == 0;
+    const int rows = wide ? 16 : static_cast<int>(len);
+    const int rowBytes = wide ? 2 : 1;
+    const int shift = x & 63;
+    std::uint64_t collision = 0;
+
+    for(int plane = 0; plane < planes; plane++){
+        if(!(core.planeMask >> plane & 1)){
+            continue;
+        }
 
-    //Each byte is a sprite row containing 8 pixels
-    for(int spriteY = 0; spriteY < len; spriteY++){
+        for(int spriteY = 0; spriteY < rows; spriteY++){
+            int screenY = y + spriteY;
 
-        for(int spriteX = 0; spriteX < 8; spriteX++){
-            //Take the sprite's row. AND it with power of 2
-            //Shift the result so we get the pixel boolean
-            bool spritePixel = (mem[addr + spriteY] & (128 >> spriteX)) >> (7 - spriteX);
-            
-            //Get a reference to the screen's pixel
-            //If coordinate is outside of the screen, wrap around
-            bool& screenPixel = screen[(((y + spriteY) * DISPLAY_WIDTH) + (x + spriteX)) % screen.max_size()]; 
+            if constexpr(clip){
+                if(screenY >= height) break;
+            }
+            else{
+                screenY &= height - 1;
+            }
+
+            const std::uint16_t rowAddr = addr + spriteY * rowBytes;
+            PROFILE_MEMORY(read(rowAddr, rowBytes, mask));
+
+            //The sprite row in the highest bits of a word
+            std::uint64_t bits = std::uint64_t{mem[rowAddr & mask]} << 56;
+            if(wide){
+                bits |= std::uint64_t{mem[(rowAddr + 1) & mask]} << 48;
+            }
 
-            //Collision is true if both pixels are 1.
-            //The pixel will be erased as result of the XOR
-            if(screenPixel && spritePixel)
-                collision = true;
+            //Shifted to x, what goes past the right edge is wrapped to the left edge or dropped
+            std::uint64_t spread[2] = {0, 0};
+            const std::uint64_t carry = shift ? bits << (64 - shift) : 0;
+
+            if(words == 1){
+                spread[0] = bits >> shift;
+                if constexpr(!clip) spread[0] |= carry;
+            }
+            else if(x < 64){
+                spread[0] = bits >> shift;
+                spread[1] = carry;
+            }
+            else{
+                spread[1] = bits >> shift;
+                if constexpr(!clip) spread[0] = carry;
+            }
 
-            //XOR the pixel onto the screen
-            screenPixel ^= spritePixel;
-        } 
+            std::uint64_t* row = &screen.planes[plane][screenY * words];
+            for(int w = 0; w < words; w++){
+                collision |= row[w] & spread[w];
+                row[w] ^= spread[w];
+            }
+        }
+
+        //The next selected plane's sprite follows this one
+        addr += rows * rowBytes;
     }
-    return collision;
+
+    return collision != 0;
+}
+
+void Chip8::clearPlanes(){
+    for(int p = 0; p < Chip8Screen::PLANES; p++){
+        if(core.planeMask >> p & 1){
+            std::fill(std::begin(core.screen.planes[p]), std::end(core.screen.planes[p]), 0);
+        }
+    }
+
+    screenUpdated = true;
+}
+
+void Chip8::scrollDown(int rows){
+    const int words = core.screen.wordsPerRow();
+    const int used = words * core.screen.height();
+    const int moved = std::min(rows * words, used);
+
+    for(int p = 0; p < Chip8Screen::PLANES; p++){
+        if(core.planeMask >> p & 1){
+            std::uint64_t* plane = core.screen.planes[p];
+            std::copy_backward(plane, plane + used - moved, plane + used);
+            std::fill(plane, plane + moved, 0);
+        }
+    }
+
+    screenUpdated = true;
+}
+
+void Chip8::scrollUp(int rows){
+    const int words = core.screen.wordsPerRow();
+    const int used = words * core.screen.height();
+    const int moved = std::min(rows * words, used);
+
+    for(int p = 0; p < Chip8Screen::PLANES; p++){
+        if(core.planeMask >> p & 1){
+            std::uint64_t* plane = core.screen.planes[p];
+            std::copy(plane + moved, plane + used, plane);
+            std::fill(plane + used - moved, plane + used, 0);
+        }
+    }
+
+    screenUpdated = true;
+}
+
+void Chip8::scrollRight(){
+    for(int p = 0; p < Chip8Screen::PLANES; p++){
+        if(!(core.planeMask >> p & 1)){
+            continue;
+        }
+
+        std::uint64_t* row = core.screen.planes[p];
+
+        if(core.screen.hires){
+            for(int y = 0; y < Chip8Screen::HIRES_HEIGHT; y++, row += 2){
+                row[1] = row[1] >> 4 | row[0] << 60;
+                row[0] >>= 4;
+            }
+        }
+        else{
+            for(int y = 0; y < Chip8Screen::LORES_HEIGHT; y++){
+                row[y] >>= 4;
+            }
+        }
+    }
+
+    screenUpdated = true;
+}
+
+void Chip8::scrollLeft(){
+    for(int p = 0; p < Chip8Screen::PLANES; p++){
+        if(!(core.planeMask >> p & 1)){
+            continue;
+        }
+
+        std::uint64_t* row = core.screen.planes[p];
+
+        if(core.screen.hires){
+            for(int y = 0; y < Chip8Screen::HIRES_HEIGHT; y++, row += 2){
+                row[0] = row[0] << 4 | row[1] >> 60;
+                row[1] <<= 4;
+            }
+        }
+        else{
+            for(int y = 0; y < Chip8Screen::LORES_HEIGHT; y++){
+                row[y] <<= 4;
+            }
+        }
+    }
+
+    screenUpdated = true;
+}
+
+//Switching resolution clears every plane, selected or not
+void Chip8::setHires(bool hires){
+    core.screen.hires = hires;
+    for(auto& plane : core.screen.planes){
+        std::fill(std::begin(plane), std::end(plane), 0);
+    }
+    screenUpdated = true;
 }
 
 //Helper method for constructor
-void Chip8::loadRom(std::ifstream& rom){
-    std::uint16_t i = 0x200;
+void Chip8::loadRom(std::ifstream& file){
     std::uint8_t buf;
 
-    for(buf = rom.get(); rom.good(); i++){
+    for(buf = file.get(); file.good(); buf = file.get()){
         //If we're going over memory, throw
-        if(i >= mem.max_size()){
+        if(rom.size() >= Chip8Core::XO_RAM_SIZE - 0x200){
             throw FileTooBig{};
         }
-        //Else write byte to memory and read new byte
+        //Else keep the byte and read a new one
         else{
-            mem[i] = buf;
-            buf = rom.get();
+            rom.push_back(buf);
         }
     }
 }
 
+Chip8Core Chip8::getCore() const{
+    Chip8Core state = core;
+
+    //In XO-CHIP core.mem is only brought up to date here
+    if(quirks.xoChip){
+        std::copy_n(xoMemory.begin(), Chip8Core::RAM_SIZE, state.mem.begin());
+    }
+    return state;
+}
+
+void Chip8::setCore(const Chip8Core& state){
+    const int size = getMemorySize();
+
+    core = state;
+    if(quirks.xoChip){
+        std::copy(state.mem.begin(), state.mem.end(), xoMemory.begin());
+    }
+
+    //step() relies on these, whatever the state came from
+    core.PC &= size - 1;
+    core.SP = std::min<int>(core.SP, Chip8Core::STACK_SIZE);
+    std::fill_n(fusionHints.begin(), size, UNKNOWN_FUSION);
+    frameCycleCarry = 0;
+    cycleBudget = 0;
+    screenUpdated = true;
+    patternChanged = true;
+    k.reset();
+}
+
+void Chip8::reset(const Chip8Core& state, unsigned seed){
+    setCore(state);
+    randEng.seed(seed);
+    intDist.reset();
+
+    for(InputEvent e; inputQueue.pop(e);){}
+}
+
+//Helper method for constructors and reset
+//Copies the font and the ROM to RAM and clears the rest of the state
+void Chip8::powerOn(){
+    //Clear registers, stack, timers, screen and keys
+    core = {};
+    core.PC = 0x200;
+    core.planeMask = 1;
+    core.pitch = 64;
+    frameCycleCarry = 0;
+    cycleBudget = 0;
+    screenUpdated = false;
+    patternChanged = true;
+
+    //Place the font and the ROM in memory, as much of the ROM as the mode addresses
+    const std::size_t romSize = std::min<std::size_t>(rom.size(), getMemorySize() - 0x200);
+    if(quirks.xoChip){
+        std::fill(xoMemory.begin(), xoMemory.end(), 0);
+    }
+    std::uint8_t* mem = getMemory();
+    std::copy(hexSprites.begin(), hexSprites.end(), mem);
+    std::copy(bigHexSprites.begin(), bigHexSprites.end(), mem + BIG_FONT_ADDRESS);
+    std::copy_n(rom.begin(), romSize, mem + 0x200);
+    fusionHints.assign(getMemorySize(), UNKNOWN_FUSION);
+
+    #ifdef CPP8_MEMPROFILE
+    memoryProfile.clear();
+    #endif
+
+    //Forget any input sent before the reset
+    for(InputEvent e; inputQueue.pop(e);){}
+    k.reset();
+}
+
+//Helper method for constructors
+void Chip8::setScale(int outputScale){
+    //set scale if valid
+    if(outputScale > 0){
+        scale = outputScale;
+    }
+    else{
+        std::cerr << "Bad scale parameter\n";
+    }
+}
+
 
 //Decrement a timer if enough time has passed
 //Returns the amount of times it was decremented
-int Chip8::decrementTimer(timer& timer){
+int Chip8::decrementTimer(std::uint8_t& ticks, Clock::time_point& lastModified){
     int times = 0; //Times we decrement the timer
 
     //If timer is non-zero
-    if(timer.ticks > 0){
+    if(ticks > 0){
         std::chrono::time_point now = Clock::now();
         
         //Dec timer for every decWait that has passed since last modification
-        while(timer.ticks && now - timer.lastModified >= decWait * (times + 1)){
-            timer.ticks--;
+        while(ticks && now - lastModified >= decWait * (times + 1)){
+            ticks--;
             times++;
         }
 
         //If we have decremented, change lastModified
-        if(times) timer.lastModified = now;
+        if(times) lastModified = now;
     }
 
     return times;
 }
+
+
+//The tone plays while the sound timer is non-zero
+void Chip8::updateTone(){
+    if(patternChanged){
+        patternChanged = false;
+        setTonePattern(core.patternLoaded ? core.audioPattern : nullptr, 4000.0f * std::exp2((core.pitch - 64) / 48.0f));
+    }
+
+    if(bool on = core.soundTimer > 0; on != toneOn){
+        toneOn = on;
+        setTone(on);
+    }
+}
+
+//Decrement a timer by one, if it's non-zero
+//Returns true if it was decremented
+bool Chip8::tickTimer(std::uint8_t& ticks){
+    if(ticks > 0){
+        ticks--;
+        return true;
+    }
+
+    return false;
+}
\ No newline at end of file
@@ -1,12 +1,25 @@
 #pragma once
+#include <atomic>
 #include <chrono>
+#include <condition_variable>
+#include <mutex>
 #include <optional>
 #include <array>
-#include <stack>
 #include <memory>
 #include <random>
 #include <cstdint>
 #include <string>
+#include <vector>
+#include <utility>
+#include "Chip8Core.hpp"
+#include "Chip8Trace.hpp"
+#include "Chip8Debugger.hpp"
+#include "FrameStream.hpp"
+#include "LatencyProbe.hpp"
+#include "MemoryProfile.hpp"
+#include "Metrics.hpp"
+#include "SpscQueue.hpp"
+#include "TripleBuffer.hpp"
 
 class Chip8{
     public:
@@ -22,127 +35,516 @@ class Chip8{
         //It cannot be less than 1 and the default is 10.
         Chip8(std::string romFilename, int outputScale);
 
-        //This method runs until user input stops the execution
+        //Same as above, but the ROM is taken from memory.
+        //Used by frontends that don't load games from disk.
+        Chip8(const std::vector<std::uint8_t>& romData, int outputScale);
+
+        //This method runs until user input stops the execution.
+        //The game runs on a thread of its own, while the calling thread
+        //handles input and draws the frames it finishes.
         void run();
 
-        //Set chip48 mode
+        //Compatibility options.
+        //Interpreters disagree on what some instructions do,
+        //and games depend on the behaviour of the interpreter they were written for.
+        struct Quirks{
+            bool shiftVx = false;       //8XY6/8XYE shift Vx, ignoring Vy (chip48)
+            bool vfReset = false;       //8XY1/8XY2/8XY3 set VF to 0
+            bool incrementI = false;    //FX55/FX65 leave I after the last register
+            bool clipSprites = false;   //Sprites are cut at the screen edges instead of wrapping around
+            bool jumpVx = false;        //BXNN jumps to XNN + Vx instead of NNN + V0
+            bool xoChip = false;        //XO-CHIP: 64KB of RAM, two bitplanes, audio patterns
+                                        //and the instructions for them
+
+            //Either a profile: "default", "vip", "chip48", "schip", "xochip",
+            //or a comma separated list of quirks: "shift,vfreset,memi,clip,jump,xo".
+            static std::optional<Quirks> parse(const std::string& s);
+
+            //The quirks as a bit mask, the form stored in the ROM database
+            unsigned toBits() const;
+            static Quirks fromBits(unsigned bits);
+        };
+
+        //The quirks are chosen here, once, and not checked while running:
+        //each combination has its own compiled version of the interpreter.
+        void setQuirks(Quirks q);
+        Quirks getQuirks() const;
+
+        //Set chip48 mode (the shiftVx quirk)
         void setChip48(bool b);
 
+        //Execute common instruction sequences with one handler each, see Fusion.hpp.
+        //On by default. Turning it off runs every instruction through the plain
+        //interpreter, to check the fused handlers against it.
+        //Tracing, debugging and memory profiling always run unfused.
+        void setFusion(bool on);
+        bool getFusion() const;
+
+        //Instructions executed per second. The default is 500.
+        void setHz(int hz);
+        int getHz() const;
+
+        //Run at the speed of the COSMAC VIP instead of hz: each 60hz frame executes
+        //instructions until their machine cycles use up what the VIP had in a frame,
+        //and a DXYN ends the frame, see VipTiming.hpp. Off by default.
+        //Always runs unfused, the cost of each instruction depends on its state.
+        void setVipTiming(bool on);
+        bool getVipTiming() const;
+
+        //Remap the keypad: pressing key k presses layout[k] instead.
+        //For games expecting their controls somewhere else on the keypad.
+        void setKeyLayout(const std::array<std::uint8_t, 16>& layout);
+
+        //Colors of the lit and unlit pixels, as 0xRRGGBB
+        void setColors(std::uint32_t foreground, std::uint32_t background);
+
+        //XO-CHIP colors of the pixels lit only in the second plane, and in both.
+        //foreground is then the color of the pixels lit only in the first plane.
+        void setPlaneColors(std::uint32_t second, std::uint32_t blend);
+
+        //Write every executed instruction to a trace file (see Chip8Trace.hpp)
+        //holding the last `records` instructions. Decode it with cpp8-trace.
+        //If the file can't be created, an error is printed and nothing is traced.
+        void enableTrace(const std::string& path, std::size_t records);
+
+        //Stop before the next instruction and hand control to the debugger.
+        //Pass nullptr to detach.
+        void attachDebugger(std::unique_ptr<Chip8Debugger> debugger);
+
+        //Measure the latency from each key press to the first frame showing a change
+        //being handed to the display, see LatencyProbe.hpp. Only before run().
+        void enableLatencyProbe();
+        const LatencyProbe* getLatencyProbe() const;
+
+        //Collect runtime metrics and write them to statsFile every second, see Metrics.hpp.
+        //statsFile can be "-" for stdout or empty. overlay asks the frontend to show them.
+        //Only before run().
+        void enableMetrics(const std::string& statsFile, bool overlay);
+
+        //Record the frame on screen at every 60hz tick to a frame stream (see FrameStream.hpp).
+        //Convert it with cpp8-frames. If the file can't be created, an error is printed
+        //and nothing is recorded. Only before run().
+        void enableRecording(const std::string& path);
+
+        //Control from another thread, for test drivers and IPC frontends.
+        //Commands go through a wait-free queue and the emulation thread applies them,
+        //in order, before its next instructions. One controlling thread at a time.
+        //Each returns false if the queue is full.
+        enum class Register : std::uint8_t{
+            V0, V1, V2, V3, V4, V5, V6, V7, V8, V9, VA, VB, VC, VD, VE, VF,
+            I, PC, DELAY, SOUND
+        };
+
+        struct Snapshot{
+            std::uint64_t cycles;
+            std::uint16_t PC;
+            std::uint16_t I;
+            std::uint8_t V[16];
+            std::uint8_t delayTimer;
+            std::uint8_t soundTimer;
+            std::uint8_t stackDepth;
+            bool paused;
+            std::vector<std::uint8_t> memory;   //getMemorySize() bytes
+            Chip8Screen screen;
+        };
+
+        bool controlPause();
+        bool controlResume();
+        bool controlStep(int instructions);     //Only while paused
+        bool controlPoke(std::uint16_t address, std::uint8_t value);
+        bool controlSetRegister(Register r, std::uint16_t value);
+        bool controlPressKey(std::uint8_t key); //Chip8 keys, the key layout doesn't apply
+        bool controlReleaseKey(std::uint8_t key);
+        bool controlSnapshot();                 //Up to 4 wait to be taken
+
+        //The oldest snapshot asked for with controlSnapshot, if it has been taken yet
+        std::optional<Snapshot> takeSnapshot();
+
+        //Stops execution, from any thread
+        void stop();
+
+        #ifdef CPP8_MEMPROFILE
+        //Memory accesses since power on or reset(), see MemoryProfile.hpp
+        const MemoryProfile& getMemoryProfile() const;
+        #endif
+
         //Get resolution scaling
         int getScale();
 
+        //Bring the machine back to its power-on state.
+        //RAM is reloaded with the font and the ROM,
+        //registers, stack, timers, screen and keys are cleared
+        //and the random engine is reseeded with seed.
+        void reset(unsigned seed);
+
+        //The machine state, to save it and restore it later with a plain copy.
+        //Neither while run() is running. The random engine and the instructions
+        //runFrame() carries over to the next frame are not part of it,
+        //setCore starts again from none carried over.
+        //In XO-CHIP the memory above the first 4KB isn't part of it either and setCore
+        //leaves it as it is: save and restore it through getMemory(), or Chip8Env::ram().
+        //Restore states in the mode they were saved in.
+        Chip8Core getCore() const;
+        void setCore(const Chip8Core& state);
+
+        //setCore(state), then reseed the random engine like reset(seed)
+        //and forget the input not applied yet. After it the run only depends on state,
+        //seed and the input that follows, which is what searches over inputs need.
+        void reset(const Chip8Core& state, unsigned seed);
+
         //Virtual destructor
         virtual ~Chip8() = default;
 
     protected:
     //CONSTANTS
-        static constexpr int DISPLAY_WIDTH = 64;
-        static constexpr int DISPLAY_HEIGHT = 32;
+        static constexpr int DISPLAY_WIDTH = Chip8Core::DISPLAY_WIDTH;
+        static constexpr int DISPLAY_HEIGHT = Chip8Core::DISPLAY_HEIGHT;
     
     //METHODS
         //Input and output is up to subclasses to implement
-        virtual void playSound() = 0;
+        //setTone is called when the beep starts or stops: it plays while the sound timer is non-zero.
+        virtual void setTone(bool on) = 0;
+        //XO-CHIP: from now on the tone is a pattern of 16 bytes, 128 1-bit samples looped at the
+        //given samples per second, or the usual beep again if the pattern is nullptr.
+        //Called before setTone when either changes. Frontends without sound can ignore it.
+        virtual void setTonePattern(const std::uint8_t*, float) {}
         virtual void handleInput() = 0;
-        virtual void draw(const std::array<bool, DISPLAY_WIDTH * DISPLAY_HEIGHT>& screen) = 0;
+        //The screen is packed, see Chip8Core.hpp, and switches between 64x32 and 128x64.
+        virtual void draw(const Chip8Screen& screen) = 0;
 
-        //These methods will be called by handleInput
+        //These methods will be called by handleInput.
+        //Keys and pauses are queued and picked up by the emulation thread before its next instruction.
         void pressKey(std::uint8_t key);
         void releaseKey(std::uint8_t key);
         void togglePause(); //Pauses / unpauses execution
-        void stop();    //Stops execution
+        void breakIntoDebugger(); //Stops before the next instruction, if a debugger is attached
+
+        //True while the game can't go on without input: paused, or waiting for a key (FX0A).
+        //handleInput should then block until an event comes, instead of polling.
+        bool idle() const;
+
+        //Called from the emulation thread when it stops being idle,
+        //so that a handleInput blocked waiting for events can return early.
+        virtual void wakeUp() {}
+
+        //Emulate one 60hz frame without looking at the clock:
+        //hz/60 instructions are executed, or a frame's machine cycles with VIP timing,
+        //then the timers are decremented once.
+        //Used by frontends that drive the interpreter themselves instead of calling run().
+        void runFrame();
+
+        //Direct access to the machine state, for frontends that need it
+        const Chip8Screen& getScreen() const;
+        //getMemorySize() bytes, the program can address: 4KB, or 64KB in XO-CHIP.
+        //Valid until the quirks change.
+        std::uint8_t* getMemory();
+        const std::uint8_t* getMemory() const;
+        int getMemorySize() const;
+        std::uint16_t getPC() const;
+        const std::uint8_t* getRegisters() const; //V0 to VF
+        std::uint16_t getI() const;
+        std::uint32_t getForeground() const;
+        std::uint32_t getBackground() const;
+        std::uint32_t getSecondColor() const;
+        std::uint32_t getBlendColor() const;
+
+        //The metrics to draw over the game from draw(), nullptr if the overlay is off
+        const Metrics* getOverlay() const;
 
     private:
     //VARIABLES
+        //The machine being emulated. Everything else here is about running it.
+        Chip8Core core{};
+
         //This is so we don't waste time redrawing the same thing
         bool screenUpdated = false;
 
         //Pause status
         bool pause = false;
 
-        //Running status
-        bool running = true;
+        //Whether the frontend was last told to play the tone
+        bool toneOn = false;
+
+        //The XO-CHIP audio pattern or pitch changed since the frontend was last told
+        bool patternChanged = false;
+
+        //Running status, cleared by stop() from any thread
+        std::atomic<bool> running{true};
 
         //Output resolution will be DISPLAY_WIDTH*scale by DISPLAY_HEIGHT*scale
         int scale = 10;
 
-        //Hertz and ms between each cycle
+        //Hertz and time between each cycle
         int hz = 500;
-        std::chrono::milliseconds timeBetweenCycles{1000 / hz};
+        std::chrono::microseconds timeBetweenCycles{1000000 / hz};
 
-        //This flag is used to know if we should do
-        //chip-8 or chip-48 shift instructions
-        bool chip48 = false;
+        //Remainder of hz/60 carried between calls to runFrame
+        int frameCycleCarry = 0;
 
-        //16 general purpose 8-bit registers
-        //Referred to as Vx, where x is a hex digit.
-        //VF is a Flag register used by some instructions
-        std::uint8_t V[16];
+        //VIP timing: machine cycles left in the frame, below 0 when
+        //the last instruction ran over into the next one
+        bool vipTiming = false;
+        int cycleBudget = 0;
 
-        //Stack
-        std::stack<std::uint16_t> stack;
+        //The method executing one instruction.
+        //It's step() itself unless something has to watch each instruction,
+        //so that step() never pays for features that are turned off.
+        using StepFn = void (Chip8::*)();
+        StepFn stepFn = &Chip8::step<0>;
 
-        //4KB of RAM.
-        //Chip-8 programs should start at 0x200 (512)
-        std::array<std::uint8_t, 4096> mem;
+        //step() compiled for the current quirks
+        StepFn coreStep = &Chip8::step<0>;
+        Quirks quirks;
 
-        //Program Counter
-        //Used to store the currently executing address
-        std::uint16_t PC = 0x200;
+        //Runs fused sequences, or a single step() when there's none at PC.
+        //nullptr while something has to see each instruction, or with fusion off.
+        using FusedStepFn = int (Chip8::*)(int budget);
+        FusedStepFn fusedStepFn = nullptr;
+        bool fusion = true;
 
-        //This register is usually used to store addresses
-        std::uint16_t I = 0;
+        //The FusionId of the sequence starting at each address, UNKNOWN_FUSION
+        //until it's first executed, and again after the memory there is written.
+        //getMemorySize() of them.
+        std::vector<std::uint8_t> fusionHints;
+
+        //XO-CHIP's 64KB, allocated the first time the mode is turned on.
+        //While it's on the interpreter runs on these instead of core.mem: the first 4KB
+        //are copied over when the mode changes, and by getCore() and setCore().
+        std::vector<std::uint8_t> xoMemory;
+
+        //Where tracedStep writes, if tracing
+        std::unique_ptr<TraceWriter> trace;
+
+        //Asked before each instruction by debuggedStep, if attached
+        std::unique_ptr<Chip8Debugger> debugger;
+        bool debuggerStopped = false;   //Since the last emulate(): its clock must restart
+        friend class Chip8Debugger;
+
+        //The ROM as loaded by the constructor, kept for reset()
+        std::vector<std::uint8_t> rom;
 
         //Shorthands for chrono utilities
         using Clock = std::chrono::high_resolution_clock;
         using ms = std::chrono::milliseconds;
         using time = std::chrono::time_point<Clock, Clock::duration>;
 
-        //Delay and Sound timers
-        //When they are non-zero, they are decremented at a rate of 60hz
+        //When the delay and sound timers were last set or decremented.
+        //run() decrements them every decWait since then.
         static constexpr ms decWait{17}; //Roughly 60hz
-        struct timer{
-            Clock::time_point lastModified;
-            std::uint8_t ticks = 0;
-        };
-        timer delayTimer;
-        timer soundTimer;
-        //std::uint8_t delayTimer = 0;
-        //std::uint8_t soundtimer = 0;
+        Clock::time_point delayModified;
+        Clock::time_point soundModified;
 
         //Utilities for random number generation
         std::default_random_engine randEng;
         std::uniform_int_distribution<std::uint8_t> intDist{0, 255};
 
-        //Helper variables for "wait for keypress" opcode
-        //When waiting, k will be filled with the next keypress
+        //Helper variable for "wait for keypress" opcode
+        //While core.waitingForKey, k will be filled with the next keypress
         //Then waiting status will be reset when the instruction is executed again
         std::optional<std::uint8_t> k;
-        bool waitingForKey = false;
 
-        //Input and Output
-        std::array<bool, DISPLAY_WIDTH*DISPLAY_HEIGHT> screen;
-        std::array<bool, 16> keys;
+        //Input from handleInput, waiting for the emulation thread
+        struct InputEvent{
+            enum Type : std::uint8_t{ PRESS, RELEASE, PAUSE };
+            Type type;
+            std::uint8_t key;
+            Clock::time_point stamp{};  //When a key was pressed, if measuring latency
+        };
+        SpscQueue<InputEvent, 256> inputQueue;
+
+        //Commands from the controlling thread, and the snapshots going back to it
+        struct ControlCommand{
+            enum Type : std::uint8_t{ PAUSE, RESUME, STEP, POKE, SET_REGISTER, PRESS, RELEASE, SNAPSHOT };
+            Type type;
+            std::uint8_t target;    //Register or key
+            std::uint16_t address;
+            std::uint32_t value;
+        };
+        SpscQueue<ControlCommand, 256> controlQueue;
+        SpscQueue<Snapshot, 4> snapshots;
+
+        //The emulation thread sleeps on this while idle, woken by input, commands or stop()
+        std::mutex inputMutex;
+        std::condition_variable inputArrived;
+        std::atomic<bool> idleFlag{false};
+
+        //Finished frames, from the emulation thread to the one drawing them
+        struct Frame{
+            Chip8Screen screen;
+            Clock::time_point inputTime{};  //Key press this frame is the answer to, if measuring latency
+        };
+        TripleBuffer<Frame> frames;
+
+        //Latency measurement, if enabled
+        std::unique_ptr<LatencyProbe> latency;
+        std::optional<Clock::time_point> pendingPress;  //Emulation thread: press waiting for the screen to change
+        Chip8Screen pressScreen;                        //Emulation thread: the screen at that press
+        Clock::time_point frameInputTime{};             //Emulation thread: press answered by the last frames
+        Clock::time_point lastRecorded{};               //Drawing thread: press already recorded
+
+        //Runtime metrics, if enabled
+        std::unique_ptr<Metrics> metrics;
+        bool showOverlay = false;
+
+        //Frame recording, if enabled
+        std::unique_ptr<FrameRecorder> recorder;
+        std::array<bool, Chip8Screen::HIRES_WIDTH * Chip8Screen::HIRES_HEIGHT> recordPixels;
+
+        #ifdef CPP8_MEMPROFILE
+        //Filled by step(), read by tools after the run
+        MemoryProfile memoryProfile;
+        #endif
+
+        //Key pressed for each key the frontend reports, see setKeyLayout
+        std::array<std::uint8_t, 16> keyLayout{0x0, 0x1, 0x2, 0x3, 0x4, 0x5, 0x6, 0x7,
+                                               0x8, 0x9, 0xA, 0xB, 0xC, 0xD, 0xE, 0xF};
+
+        //Pixel colors for the frontends, 0xRRGGBB
+        std::uint32_t foreground = 0xFFFFFF;
+        std::uint32_t background = 0x000000;
+        std::uint32_t secondColor = 0xFF6600;
+        std::uint32_t blendColor = 0x662200;
 
     
     //STRUCTS
-    ms msBuf;
+    std::chrono::microseconds cycleBuf;
     time lastCycle;
 
     //METHODS
-        //Function called in main loop
+        //Function called in main loop, when everything runs on one thread
         void mainLoopFunc();
 
+        //Run the instructions due by now and publish the frames they draw
+        void emulate();
+
+        //Apply the queued input
+        void applyInput();
+
+        //Apply the queued commands
+        void applyControl();
+        void setRegister(Register r, std::uint16_t value);
+
+        //Pause or unpause, silencing the tone
+        void setPause(bool paused);
+
+        //Hand the screen to the thread drawing the frames
+        void publishFrame();
+
+        //Draw the newest frame, and record its latency if it answers a key press
+        void presentFrame();
+
+        //Hand the frame to the recorder, always at 128x64
+        void recordFrame(const Chip8Screen& screen);
+
+        //Queue input or a command for the emulation thread and wake it up
+        void queueInput(InputEvent e);
+        bool queueControl(ControlCommand c);
+        void notifyEmulation();
+
+        //True if nothing can happen until there's input
+        bool needsInput() const;
+
+        //Block the emulation thread until input comes, or a timer needs to tick
+        void waitForInput();
+
+        //The calling thread of run() handles input and draws once every frameTime
+        static constexpr std::chrono::microseconds frameTime{1000000 / 60};
+
         #ifdef __EMSCRIPTEN__ //static wrapper for emscripten
         static void mainLoopFunc_emscripten(void* params);
         #endif
 
         //Execute the instruction pointed by the program counter
+        //Q is a combination of the quirk bits below
+        template<unsigned Q>
         void step();
 
+        //Quirks as template parameter of step()
+        static constexpr unsigned SHIFT_VX = 1;
+        static constexpr unsigned VF_RESET = 2;
+        static constexpr unsigned INCREMENT_I = 4;
+        static constexpr unsigned CLIP_SPRITES = 8;
+        static constexpr unsigned JUMP_VX = 16;
+        static constexpr unsigned XO_CHIP = 32;
+        static constexpr unsigned QUIRK_COMBINATIONS = 64;
+
+        //The memory step() runs on: core.mem, or xoMemory in XO-CHIP
+        template<unsigned Q>
+        std::uint8_t* memory(){
+            if constexpr(Q & XO_CHIP) return xoMemory.data();
+            else return core.mem.data();
+        }
+
+        //Addresses wrap around the 4KB of RAM, or the 64KB of XO-CHIP
+        template<unsigned Q>
+        static constexpr std::uint16_t addressMask(){
+            return Q & XO_CHIP ? Chip8Core::XO_RAM_SIZE - 1 : Chip8Core::RAM_SIZE - 1;
+        }
+
+        //The address after the instruction at addr, for the skips.
+        //That's 4 bytes later for the XO-CHIP F000 NNNN, 2 for anything else.
+        template<unsigned Q>
+        std::uint16_t skipFrom(std::uint16_t addr) const;
+
+        //One version of step() for each combination of quirks
+        static const std::array<StepFn, QUIRK_COMBINATIONS> stepTable;
+
+        template<std::size_t... Q>
+        static constexpr std::array<StepFn, sizeof...(Q)> makeStepTable(std::index_sequence<Q...>);
+
+        //Execute up to budget instructions, more than one when they're fused.
+        //Returns how many were executed.
+        int execute(int budget);
+
+        //Execute the instructions of one 60hz frame of VIP timing.
+        //Returns how many were executed.
+        int runCycleBudget();
+
+        //Execute the fused sequence at PC if there's one and budget allows it, else step()
+        template<unsigned Q>
+        int fusedStep(int budget);
+
+        //Execute the sequence id at PC. Returns its length in instructions.
+        template<unsigned Q>
+        int fused(std::uint8_t id);
+
+        //Mark the hints of the sequences overlapping count bytes written at addr as unknown
+        void forgetFusions(int addr, int count);
+
+        //One version of fusedStep() for each combination of quirks
+        static const std::array<FusedStepFn, QUIRK_COMBINATIONS> fusedStepTable;
+
+        template<std::size_t... Q>
+        static constexpr std::array<FusedStepFn, sizeof...(Q)> makeFusedStepTable(std::index_sequence<Q...>);
+
+        //step(), then write what it did to the trace
+        void tracedStep();
+
+        //Let the debugger decide whether to stop, then step
+        void debuggedStep();
+
+        //Point stepFn to the cheapest method doing everything that's enabled
+        void selectStepFn();
+
         //Helper method for draw instruction
         //Returns true if collifion happened
+        //len 0 is a SUPER-CHIP 16x16 sprite, 2 bytes per row.
+        //With both XO-CHIP planes selected, the sprite for the second one follows the first.
+        template<unsigned Q>
         bool drawSprite(int x, int y, std::uint16_t addr, std::size_t len);
 
+        //SUPER-CHIP scrolling, by pixels of the current resolution, of the selected planes
+        void scrollDown(int rows);
+        void scrollUp(int rows);    //XO-CHIP
+        void scrollRight();         //4 pixels
+        void scrollLeft();          //4 pixels
+
+        //00E0, of the selected planes
+        void clearPlanes();
+
+        //SUPER-CHIP 00FE and 00FF. Switching resolution clears the screen.
+        void setHires(bool hires);
+
         //Helper method for XNNN instructions
         std::uint16_t getNNN(std::uint8_t high, std::uint8_t low);
 
@@ -150,13 +552,30 @@ class Chip8{
         void reportCode(std::uint8_t high, std::uint8_t low);
 
         //Helper method for constructor
-        void loadRom(std::ifstream& rom);
+        void loadRom(std::ifstream& file);
+
+        //Helper method for constructors and reset
+        //Copies the font and the ROM to RAM and clears the rest of the state
+        void powerOn();
+
+        //Helper method for constructors
+        void setScale(int outputScale);
 
         //Decrement a timer if enough time has passed
         //Returns the amount of times it was decremented
-        int decrementTimer(timer& timer);
+        int decrementTimer(std::uint8_t& ticks, Clock::time_point& lastModified);
+
+        //Tell the frontend if the tone should start or stop
+        void updateTone();
+
+        //Decrement a timer by one, if it's non-zero
+        //Returns true if it was decremented
+        bool tickTimer(std::uint8_t& ticks);
 
     //CONSTANTS
+        //Where the SUPER-CHIP font starts in RAM, right after the CHIP-8 one
+        static constexpr std::uint16_t BIG_FONT_ADDRESS = 0x50;
+
         //This is a group of sprites representing the hex digits
         //They will be stored starting from RAM 0x000 
         //Each sprite is 5 bytes long
@@ -276,4 +695,26 @@ class Chip8{
                 0b1000'0000,
                 0b1000'0000,
              };
+
+        //The SUPER-CHIP hex digits, for FX30: 8x10 pixels, one row per byte.
+        //SUPER-CHIP only had 0 to 9, the letters are drawn in the same style.
+        static constexpr std::array<std::uint8_t, 16*10> bigHexSprites =
+            {
+                0x3C, 0x7E, 0xE7, 0xC3, 0xC3, 0xC3, 0xC3, 0xE7, 0x7E, 0x3C,     //0
+                0x18, 0x38, 0x58, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3C,     //1
+                0x3E, 0x7F, 0xC3, 0x06, 0x0C, 0x18, 0x30, 0x60, 0xFF, 0xFF,     //2
+                0x3C, 0x7E, 0xC3, 0x03, 0x0E, 0x0E, 0x03, 0xC3, 0x7E, 0x3C,     //3
+                0x06, 0x0E, 0x1E, 0x36, 0x66, 0xC6, 0xFF, 0xFF, 0x06, 0x06,     //4
+                0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFE, 0x03, 0xC3, 0x7E, 0x3C,     //5
+                0x3E, 0x7C, 0xE0, 0xC0, 0xFC, 0xFE, 0xC3, 0xC3, 0x7E, 0x3C,     //6
+                0xFF, 0xFF, 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x60, 0x60,     //7
+                0x3C, 0x7E, 0xC3, 0xC3, 0x7E, 0x7E, 0xC3, 0xC3, 0x7E, 0x3C,     //8
+                0x3C, 0x7E, 0xC3, 0xC3, 0x7F, 0x3F, 0x03, 0x03, 0x3E, 0x7C,     //9
+                0x3C, 0x7E, 0xC3, 0xC3, 0xFF, 0xFF, 0xC3, 0xC3, 0xC3, 0xC3,     //A
+                0xFC, 0xFE, 0xC3, 0xC3, 0xFE, 0xFE, 0xC3, 0xC3, 0xFE, 0xFC,     //B
+                0x3C, 0x7E, 0xC3, 0xC0, 0xC0, 0xC0, 0xC0, 0xC3, 0x7E, 0x3C,     //C
+                0xFC, 0xFE, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xC3, 0xFE, 0xFC,     //D
+                0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xFF, 0xFF,     //E
+                0xFF, 0xFF, 0xC0, 0xC0, 0xFC, 0xFC, 0xC0, 0xC0, 0xC0, 0xC0,     //F
+            };
 };
@@ -0,0 +1,136 @@
+#pragma once
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+//The framebuffer, packed 1 bit per pixel so that the SUPER-CHIP high resolution
+//costs no more to draw, scroll or hand to the frontends than the CHIP-8 one.
+//Each row is wordsPerRow() 64-bit words, the leftmost pixel in the highest bit,
+//and the rows follow each other: in low resolution only the first 32 words of a plane are used.
+//Sprites are drawn and the screen is scrolled a word at a time, never a pixel at a time.
+//
+//There are two bitplanes. CHIP-8 and SUPER-CHIP only ever use the first one,
+//XO-CHIP draws to either or both, and the color of a pixel is the planes it's lit in.
+struct Chip8Screen{
+    //CONSTANTS
+    static constexpr int LORES_WIDTH = 64;
+    static constexpr int LORES_HEIGHT = 32;
+    static constexpr int HIRES_WIDTH = 128;
+    static constexpr int HIRES_HEIGHT = 64;
+    static constexpr int PLANES = 2;
+    static constexpr int PLANE_WORDS = HIRES_WIDTH / 64 * HIRES_HEIGHT;
+
+    //DATA
+    std::uint64_t planes[PLANES][PLANE_WORDS];
+    bool hires;     //128x64 instead of 64x32, SUPER-CHIP 00FF and 00FE
+
+    //METHODS
+    int width() const { return hires ? HIRES_WIDTH : LORES_WIDTH; }
+    int height() const { return hires ? HIRES_HEIGHT : LORES_HEIGHT; }
+    int wordsPerRow() const { return hires ? 2 : 1; }
+
+    //Lit in any plane
+    bool pixel(int x, int y) const{
+        return color(x, y) != 0;
+    }
+
+    //Bit n set if lit in plane n: 0 to 3
+    int color(int x, int y) const{
+        const int word = y * wordsPerRow() + x / 64;
+        const int shift = 63 - x % 64;
+        return (planes[0][word] >> shift & 1) | (planes[1][word] >> shift & 1) << 1;
+    }
+
+    //Whether anything is lit in the second plane, which only XO-CHIP programs draw to
+    bool usesSecondPlane() const{
+        const std::uint64_t* plane = planes[1];
+        return std::any_of(plane, plane + wordsPerRow() * height(), [](std::uint64_t w){ return w != 0; });
+    }
+
+    bool operator==(const Chip8Screen& other) const{
+        const int used = wordsPerRow() * height();
+        return hires == other.hires
+            && std::equal(planes[0], planes[0] + used, other.planes[0])
+            && std::equal(planes[1], planes[1] + used, other.planes[1]);
+    }
+
+    bool operator!=(const Chip8Screen& other) const{
+        return !(*this == other);
+    }
+};
+
+//The state of the machine itself: registers, stack, timers, RAM, screen and keypad.
+//Nothing about threads, clocks, windows or how the machine is being run,
+//that is all in Chip8, which keeps one of these.
+//
+//It's a POD on purpose: saving or restoring a machine is a plain copy of a few KB,
+//and many of them can be laid out back to back in one array for batch runs.
+//The registers touched by nearly every instruction share the first cache line.
+struct alignas(64) Chip8Core{
+    //CONSTANTS
+    static constexpr int DISPLAY_WIDTH = Chip8Screen::LORES_WIDTH;
+    static constexpr int DISPLAY_HEIGHT = Chip8Screen::LORES_HEIGHT;
+    static constexpr int STACK_SIZE = 16;
+    static constexpr int RAM_SIZE = 4096;          //CHIP-8 and SUPER-CHIP
+    static constexpr int XO_RAM_SIZE = 65536;      //XO-CHIP
+
+    //DATA
+    //16 general purpose 8-bit registers
+    //Referred to as Vx, where x is a hex digit.
+    //VF is a Flag register used by some instructions
+    std::uint8_t V[16];
+
+    //Program Counter
+    //Used to store the currently executing address.
+    //Always below the memory size of the mode, Chip8 wraps it after every instruction.
+    std::uint16_t PC;
+
+    //This register is usually used to store addresses
+    std::uint16_t I;
+
+    //Delay and Sound timers
+    //When they are non-zero, they are decremented at a rate of 60hz
+    std::uint8_t delayTimer;
+    std::uint8_t soundTimer;
+
+    //Stack pointer, the amount of addresses in stack, STACK_SIZE at most
+    std::uint8_t SP;
+
+    //Executing FX0A, until a key is pressed
+    bool waitingForKey;
+
+    //Instructions executed since power on
+    std::uint64_t cycles;
+
+    //Return addresses of the subroutines being executed
+    std::uint16_t stack[STACK_SIZE];
+
+    //4KB of RAM, all CHIP-8 and SUPER-CHIP address.
+    //XO-CHIP addresses 64KB, which Chip8 keeps outside the core so that it stays cheap to copy:
+    //only their first 4KB are saved here.
+    //Chip-8 programs should start at 0x200 (512)
+    alignas(64) std::array<std::uint8_t, RAM_SIZE> mem;
+
+    Chip8Screen screen;
+    std::array<bool, 16> keys;
+
+    //SUPER-CHIP RPL user flags, FX75 and FX85
+    std::uint8_t flags[16];
+
+    //XO-CHIP: the planes DXYN, 00E0 and the scrolls work on (FN01), bit n for plane n.
+    //Always 1 outside XO-CHIP.
+    std::uint8_t planeMask;
+
+    //XO-CHIP audio: 128 1-bit samples (F002), looped while the sound timer runs,
+    //at 4000*2^((pitch-64)/48) samples per second (FX3A).
+    //Until F002 is executed the usual beep plays instead.
+    std::uint8_t audioPattern[16];
+    std::uint8_t pitch;
+    bool patternLoaded;
+};
+
+static_assert(std::is_trivial_v<Chip8Core> && std::is_standard_layout_v<Chip8Core>,
+              "Chip8Core must stay a POD");
+static_assert(offsetof(Chip8Core, mem) == 64, "The registers and stack must fit in one cache line");
@@ -0,0 +1,488 @@
+#include "Chip8Debugger.hpp"
+#include "Chip8.hpp"
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CPP8_HAVE_UNIX_SOCKETS
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <unistd.h>
+#endif
+
+Chip8Debugger::Chip8Debugger(std::FILE* in, std::FILE* out)
+: in{in}, out{out}
+{
+}
+
+//Listen on a Unix socket at path and wait for a client to connect.
+std::unique_ptr<Chip8Debugger> Chip8Debugger::listen(const std::string& path){
+    #ifdef CPP8_HAVE_UNIX_SOCKETS
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+
+    if(path.size() >= sizeof(addr.sun_path)){
+        std::cerr << "Debugger socket path too long\n";
+        return nullptr;
+    }
+    std::strcpy(addr.sun_path, path.c_str());
+
+    int server = socket(AF_UNIX, SOCK_STREAM, 0);
+    unlink(path.c_str());
+
+    if(server < 0
+       || bind(server, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0
+       || ::listen(server, 1) != 0){
+        std::cerr << "Could not listen on \"" << path << "\"\n";
+        if(server >= 0) close(server);
+        return nullptr;
+    }
+
+    std::cerr << "Waiting for debugger on " << path << std::endl;
+    int client = accept(server, nullptr, nullptr);
+    close(server);
+    unlink(path.c_str());
+
+    //One FILE for each direction, so reads and writes don't share a buffer
+    std::FILE* in = client >= 0 ? fdopen(client, "r") : nullptr;
+    std::FILE* out = client >= 0 ? fdopen(dup(client), "w") : nullptr;
+
+    if(!in || !out){
+        std::cerr << "Debugger connection failed\n";
+        if(in) std::fclose(in);
+        if(out) std::fclose(out);
+        return nullptr;
+    }
+
+    std::setvbuf(out, nullptr, _IOLBF, 0);
+    auto debugger = std::make_unique<Chip8Debugger>(in, out);
+    debugger->socketFd = client;
+    return debugger;
+    #else
+    std::cerr << "Debugging over a socket is not supported on this platform\n";
+    return nullptr;
+    #endif
+}
+
+Chip8Debugger::~Chip8Debugger(){
+    //Streams made by listen() are ours to close
+    if(socketFd >= 0){
+        std::fclose(in);
+        std::fclose(out);
+    }
+}
+
+void Chip8Debugger::requestStop(){
+    stopRequested = true;
+}
+
+//Called by Chip8 before each instruction.
+bool Chip8Debugger::beforeStep(Chip8& chip8){
+    std::string reason = stopReason(chip8);
+
+    if(!reason.empty()){
+        stepsLeft = 0;
+        stepOverReturn.reset();
+        std::fprintf(out, "%s\n", reason.c_str());
+        printRegisters(chip8);
+        commandLoop(chip8);
+        return true;
+    }
+    else if(stepsLeft > 0){
+        stepsLeft--;
+    }
+
+    return false;
+}
+
+//Why we should stop before this instruction, empty if we shouldn't
+std::string Chip8Debugger::stopReason(const Chip8& chip8){
+    char buf[96];
+
+    if(stopRequested.exchange(false)){
+        return "Stopped";
+    }
+
+    if(stepsLeft == 1){
+        return "Step";
+    }
+
+    if(stepOverReturn && chip8.core.PC == *stepOverReturn && chip8.core.SP == stepOverDepth){
+        return "Step";
+    }
+
+    for(const Breakpoint& b : breakpoints){
+        if(b.addr == chip8.core.PC && (!b.condition || holds(chip8, *b.condition))){
+            std::snprintf(buf, sizeof(buf), "Breakpoint at %03X", b.addr);
+            return buf;
+        }
+    }
+
+    std::string becameTrue;
+    for(Condition& c : conditions){
+        bool held = c.held;
+        c.held = holds(chip8, c);
+
+        if(c.held && !held && becameTrue.empty()){
+            becameTrue = "Condition " + describe(c);
+        }
+    }
+
+    if(!becameTrue.empty()){
+        return becameTrue;
+    }
+
+    if(!watchpoints.empty()){
+        Access read, write;
+        memoryAccess(chip8, read, write);
+
+        //Accesses wrap around the end of memory like the instructions do
+        const int mask = chip8.getMemorySize() - 1;
+        auto overlaps = [mask](const Access& a, const Watchpoint& w){
+            return a.len && (((w.addr - a.first) & mask) < a.len || ((a.first - w.addr) & mask) < w.len);
+        };
+
+        for(const Watchpoint& w : watchpoints){
+            bool reads = w.read && overlaps(read, w);
+            bool writes = w.write && overlaps(write, w);
+
+            if(reads || writes){
+                std::snprintf(buf, sizeof(buf), "Watchpoint %03X: %s by instruction at %03X",
+                              w.addr, writes ? "write" : "read", chip8.core.PC);
+                return buf;
+            }
+        }
+    }
+
+    return "";
+}
+
+//Read and run commands until one resumes execution
+void Chip8Debugger::commandLoop(Chip8& chip8){
+    char line[256];
+
+    while(true){
+        std::fprintf(out, "(cpp8) ");
+        std::fflush(out);
+
+        //End of input, let the program run
+        if(!std::fgets(line, sizeof(line), in)){
+            std::fprintf(out, "\n");
+            return;
+        }
+
+        if(command(chip8, line)){
+            return;
+        }
+    }
+}
+
+//Run one command line. Returns true if execution should resume.
+bool Chip8Debugger::command(Chip8& chip8, const std::string& line){
+    std::istringstream words{line};
+    std::string cmd;
+    words >> cmd >> std::hex;
+
+    if(cmd.empty()){
+        return false;
+    }
+    else if(cmd == "c"){
+        return true;
+    }
+    else if(cmd == "s"){
+        stepsLeft = 1;
+
+        if(int n; words >> std::dec >> n){
+            stepsLeft = std::max(n, 1);
+        }
+        return true;
+    }
+    else if(cmd == "n"){
+        //Only a call needs stepping over, anything else is a plain step
+        if((chip8.getMemory()[chip8.core.PC] & 0xF0) == 0x20){
+            stepOverReturn = chip8.core.PC + 2;
+            stepOverDepth = chip8.core.SP;
+        }
+        else{
+            stepsLeft = 1;
+        }
+        return true;
+    }
+    else if(cmd == "b"){
+        Breakpoint b;
+        std::string keyword;
+
+        if(!(words >> b.addr)){
+            std::fprintf(out, "Usage: b ADDR [if COND]\n");
+        }
+        else if(words >> keyword){
+            Condition c;
+            if(keyword == "if" && parseCondition(words, c)){
+                b.condition = c;
+                breakpoints.push_back(b);
+            }
+            else{
+                std::fprintf(out, "Bad condition\n");
+            }
+        }
+        else{
+            breakpoints.push_back(b);
+        }
+    }
+    else if(cmd == "d"){
+        std::uint16_t addr;
+        if(words >> addr){
+            breakpoints.erase(std::remove_if(breakpoints.begin(), breakpoints.end(),
+                                             [addr](const Breakpoint& b){ return b.addr == addr; }),
+                              breakpoints.end());
+        }
+    }
+    else if(cmd == "w"){
+        std::string kind;
+        Watchpoint w{0, 1, false, false};
+        words >> kind >> w.addr;
+
+        if(std::uint16_t len; words >> len){
+            w.len = len;
+        }
+
+        w.read = kind == "r" || kind == "rw";
+        w.write = kind == "w" || kind == "rw";
+
+        if((w.read || w.write) && w.len > 0)
+            watchpoints.push_back(w);
+        else
+            std::fprintf(out, "Usage: w r|w|rw ADDR [LEN]\n");
+    }
+    else if(cmd == "dw"){
+        std::uint16_t addr;
+        if(words >> addr){
+            watchpoints.erase(std::remove_if(watchpoints.begin(), watchpoints.end(),
+                                             [addr](const Watchpoint& w){ return w.addr == addr; }),
+                              watchpoints.end());
+        }
+    }
+    else if(cmd == "cond"){
+        Condition c;
+        if(parseCondition(words, c))
+            conditions.push_back(c);
+        else
+            std::fprintf(out, "Usage: cond REG OP VALUE\n");
+    }
+    else if(cmd == "dc"){
+        conditions.clear();
+    }
+    else if(cmd == "l"){
+        for(const Breakpoint& b : breakpoints){
+            std::fprintf(out, "break %03X%s%s\n", b.addr, b.condition ? " if " : "",
+                         b.condition ? describe(*b.condition).c_str() : "");
+        }
+        for(const Watchpoint& w : watchpoints){
+            std::fprintf(out, "watch %s %03X-%03X\n", w.read ? (w.write ? "rw" : "r") : "w",
+                         w.addr, w.addr + w.len - 1);
+        }
+        for(const Condition& c : conditions){
+            std::fprintf(out, "cond %s\n", describe(c).c_str());
+        }
+    }
+    else if(cmd == "r"){
+        printRegisters(chip8);
+    }
+    else if(cmd == "m"){
+        int addr = 0, len = 16;
+        words >> addr;
+
+        if(int n; words >> n){
+            len = n;
+        }
+        printMemory(chip8, addr, len);
+    }
+    else if(cmd == "set"){
+        std::string name;
+        int reg, value;
+
+        if(words >> name >> value && parseReg(name, reg)){
+            if(reg < 16)            chip8.core.V[reg] = value;
+            else if(reg == REG_I)   chip8.core.I = value & (chip8.getMemorySize() - 1);
+            else if(reg == REG_PC)  chip8.core.PC = value & (chip8.getMemorySize() - 1);
+            else if(reg == REG_DT)  chip8.core.delayTimer = value;
+            else                    chip8.core.soundTimer = value;
+        }
+        else{
+            std::fprintf(out, "Usage: set REG VALUE\n");
+        }
+    }
+    else if(cmd == "poke"){
+        int addr, value;
+        if(words >> addr >> value && addr >= 0 && addr < chip8.getMemorySize()){
+            chip8.getMemory()[addr] = value;
+            chip8.forgetFusions(addr, 1);
+        }
+        else
+            std::fprintf(out, "Usage: poke ADDR VALUE\n");
+    }
+    else if(cmd == "q"){
+        chip8.stop();
+        return true;
+    }
+    else{
+        std::fprintf(out, "Commands: c, s [n], n, b ADDR [if COND], d ADDR, w r|w|rw ADDR [LEN], dw ADDR,\n"
+                          "          cond COND, dc, l, r, m ADDR [LEN], set REG VALUE, poke ADDR VALUE, q\n"
+                          "COND is REG OP VALUE, REG is V0-VF, I, PC, DT or ST, OP is == != < > <= >=\n");
+    }
+
+    return false;
+}
+
+void Chip8Debugger::printRegisters(const Chip8& chip8){
+    for(int i = 0; i < 16; i++){
+        std::fprintf(out, "V%X=%02X%s", i, chip8.core.V[i], i == 7 || i == 15 ? "\n" : " ");
+    }
+
+    std::fprintf(out, "PC=%03X [%02X%02X] I=%03X DT=%02X ST=%02X SP=%d cycle=%llu\n",
+                 chip8.core.PC, chip8.getMemory()[chip8.core.PC], chip8.getMemory()[(chip8.core.PC + 1) & (chip8.getMemorySize() - 1)], chip8.core.I,
+                 chip8.core.delayTimer, chip8.core.soundTimer, static_cast<int>(chip8.core.SP),
+                 static_cast<unsigned long long>(chip8.core.cycles));
+}
+
+void Chip8Debugger::printMemory(const Chip8& chip8, int addr, int len){
+    for(int i = 0; i < len; i++){
+        int a = (addr + i) & (chip8.getMemorySize() - 1);
+
+        if(i % 16 == 0)
+            std::fprintf(out, "%s%03X:", i ? "\n" : "", a);
+
+        std::fprintf(out, " %02X", chip8.getMemory()[a]);
+    }
+
+    std::fprintf(out, "\n");
+}
+
+//Memory read and written by the instruction at PC
+//Starting at I, wrapped to the memory size: the range itself can wrap past the end
+void Chip8Debugger::memoryAccess(const Chip8& chip8, Access& read, Access& write){
+    const int mask = chip8.getMemorySize() - 1;
+    const int I = chip8.core.I & mask;
+    std::uint8_t high = chip8.getMemory()[chip8.core.PC];
+    std::uint8_t low = chip8.getMemory()[(chip8.core.PC + 1) & mask];
+    int x = high & 0x0F;
+
+    //DXYN reads the sprite, DXY0 the 32 bytes of a 16x16 one.
+    //In XO-CHIP, one after the other for each selected plane.
+    if((high & 0xF0) == 0xD0){
+        const int n = low & 0x0F;
+        int planes = 1;
+        if(chip8.getQuirks().xoChip){
+            planes = (chip8.core.planeMask & 1) + (chip8.core.planeMask >> 1 & 1);
+        }
+        read = {I, (n ? n : 32) * planes};
+    }
+    //XO-CHIP 5XY2 writes Vx to Vy, 5XY3 reads them
+    else if((high & 0xF0) == 0x50 && chip8.getQuirks().xoChip && ((low & 0x0F) == 0x02 || (low & 0x0F) == 0x03)){
+        const Access access{I, std::abs(x - (low >> 4)) + 1};
+
+        if((low & 0x0F) == 0x02)
+            write = access;
+        else
+            read = access;
+    }
+    else if((high & 0xF0) == 0xF0){
+        switch(low){
+            //XO-CHIP F002 reads the audio pattern
+            case 0x02:
+                if(chip8.getQuirks().xoChip && x == 0){
+                    read = {I, 16};
+                }
+            break;
+
+            //FX33 writes the BCD digits
+            case 0x33:
+                write = {I, 3};
+            break;
+
+            //FX55 writes V0 to Vx
+            case 0x55:
+                write = {I, x + 1};
+            break;
+
+            //FX65 reads V0 to Vx
+            case 0x65:
+                read = {I, x + 1};
+            break;
+        }
+    }
+}
+
+int Chip8Debugger::readReg(const Chip8& chip8, int reg){
+    if(reg < 16)            return chip8.core.V[reg];
+    else if(reg == REG_I)   return chip8.core.I;
+    else if(reg == REG_PC)  return chip8.core.PC;
+    else if(reg == REG_DT)  return chip8.core.delayTimer;
+    else                    return chip8.core.soundTimer;
+}
+
+bool Chip8Debugger::parseReg(const std::string& name, int& reg){
+    std::string upper = name;
+    std::transform(upper.begin(), upper.end(), upper.begin(), ::toupper);
+
+    if(upper.size() == 2 && upper[0] == 'V' && std::isxdigit(static_cast<unsigned char>(upper[1]))){
+        reg = std::stoi(upper.substr(1), nullptr, 16);
+    }
+    else if(upper == "I")   reg = REG_I;
+    else if(upper == "PC")  reg = REG_PC;
+    else if(upper == "DT")  reg = REG_DT;
+    else if(upper == "ST")  reg = REG_ST;
+    else                    return false;
+
+    return true;
+}
+
+bool Chip8Debugger::parseCondition(std::istream& words, Condition& condition){
+    static const char* ops[] = {"==", "!=", "<", ">", "<=", ">="};
+    std::string reg, op;
+
+    if(!(words >> reg >> op >> std::hex >> condition.value) || !parseReg(reg, condition.reg)){
+        return false;
+    }
+
+    for(int i = 0; i < 6; i++){
+        if(op == ops[i]){
+            condition.op = static_cast<Op>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool Chip8Debugger::holds(const Chip8& chip8, const Condition& c){
+    int value = readReg(chip8, c.reg);
+
+    switch(c.op){
+        case Op::EQ: return value == c.value;
+        case Op::NE: return value != c.value;
+        case Op::LT: return value < c.value;
+        case Op::GT: return value > c.value;
+        case Op::LE: return value <= c.value;
+        case Op::GE: return value >= c.value;
+    }
+
+    return false;
+}
+
+std::string Chip8Debugger::describe(const Condition& c){
+    static const char* ops[] = {"==", "!=", "<", ">", "<=", ">="};
+    static const char* names[] = {"I", "PC", "DT", "ST"};
+    char buf[32];
+
+    if(c.reg < 16)
+        std::snprintf(buf, sizeof(buf), "V%X %s %X", c.reg, ops[static_cast<int>(c.op)], c.value);
+    else
+        std::snprintf(buf, sizeof(buf), "%s %s %X", names[c.reg - 16], ops[static_cast<int>(c.op)], c.value);
+
+    return buf;
+}
@@ -0,0 +1,121 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+class Chip8;
+
+//Interactive debugger driven by text commands,
+//read from the console or from a local socket.
+//It only costs something while attached: Chip8 then calls beforeStep()
+//ahead of every instruction, otherwise it's never looked at.
+//
+//Commands (addresses and values in hex):
+//  c                       continue
+//  s [n]                   step n instructions (1 by default)
+//  n                       step, but run a whole 2NNN call as one step
+//  b ADDR [if COND]        breakpoint, optionally conditional
+//  d ADDR                  delete breakpoint
+//  w r|w|rw ADDR [LEN]     watch reads and/or writes to memory
+//  dw ADDR                 delete watchpoints starting at ADDR
+//  cond COND               stop whenever COND becomes true
+//  dc                      delete all conditions
+//  l                       list breakpoints, watchpoints and conditions
+//  r                       registers
+//  m ADDR [LEN]            memory dump
+//  set REG VALUE           change a register
+//  poke ADDR VALUE         change a byte of memory
+//  q                       quit the interpreter
+//COND is REG OP VALUE, with REG one of V0-VF, I, PC, DT, ST and OP one of == != < > <= >=
+class Chip8Debugger{
+    public:
+        //Commands are read from in and replies written to out.
+        //The streams are not closed by the debugger.
+        Chip8Debugger(std::FILE* in, std::FILE* out);
+
+        //Listen on a Unix socket at path and wait for a client to connect.
+        //Returns nullptr if it fails.
+        static std::unique_ptr<Chip8Debugger> listen(const std::string& path);
+
+        ~Chip8Debugger();
+
+        Chip8Debugger(const Chip8Debugger&) = delete;
+        Chip8Debugger& operator=(const Chip8Debugger&) = delete;
+
+        //Stop before the next instruction. Safe to call from any thread.
+        void requestStop();
+
+        //Called by Chip8 before each instruction.
+        //Checks the stop conditions and, if one is met, reads commands
+        //until the user resumes execution. Returns true if it stopped.
+        bool beforeStep(Chip8& chip8);
+
+    private:
+        //Register indices for conditions: 0-15 are V0-VF
+        enum Reg{ REG_I = 16, REG_PC, REG_DT, REG_ST };
+        enum class Op{ EQ, NE, LT, GT, LE, GE };
+
+        struct Condition{
+            int reg;
+            Op op;
+            int value;
+            bool held = false;  //Result of the last check, conditions stop when they become true
+        };
+
+        struct Breakpoint{
+            std::uint16_t addr;
+            std::optional<Condition> condition;
+        };
+
+        struct Watchpoint{
+            std::uint16_t addr;
+            std::uint16_t len;
+            bool read;
+            bool write;
+        };
+
+        //A memory range touched by an instruction
+        struct Access{
+            int first = 0;
+            int len = 0;
+        };
+
+        std::FILE* in;
+        std::FILE* out;
+        int socketFd = -1;  //Only when created by listen()
+
+        std::vector<Breakpoint> breakpoints;
+        std::vector<Watchpoint> watchpoints;
+        std::vector<Condition> conditions;
+
+        //What to do until the next stop
+        std::atomic<bool> stopRequested{true};
+        int stepsLeft = 0;                      //Stop after this many instructions, if not 0
+        std::optional<std::uint16_t> stepOverReturn;   //Stop when PC gets here at stepOverDepth
+        std::size_t stepOverDepth = 0;
+
+        //Why we should stop before this instruction, empty if we shouldn't
+        std::string stopReason(const Chip8& chip8);
+
+        //Read and run commands until one resumes execution
+        void commandLoop(Chip8& chip8);
+
+        //Run one command line. Returns true if execution should resume.
+        bool command(Chip8& chip8, const std::string& line);
+
+        void printRegisters(const Chip8& chip8);
+        void printMemory(const Chip8& chip8, int addr, int len);
+
+        //Memory read and written by the instruction at PC
+        static void memoryAccess(const Chip8& chip8, Access& read, Access& write);
+
+        static int readReg(const Chip8& chip8, int reg);
+        static bool parseReg(const std::string& name, int& reg);
+        static bool parseCondition(std::istream& words, Condition& condition);
+        static bool holds(const Chip8& chip8, const Condition& condition);
+        std::string describe(const Condition& condition);
+};
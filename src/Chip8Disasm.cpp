@@ -0,0 +1,528 @@
+#include "Chip8Disasm.hpp"
+#include "Fusion.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+
+namespace{
+    //Bytes of the instruction at addr, for the skips: like Chip8::skipFrom
+    int lengthAt(const std::uint8_t* mem, int size, std::uint16_t addr, Chip8::Quirks quirks){
+        const int mask = size - 1;
+        return quirks.xoChip && mem[addr & mask] == 0xF0 && mem[(addr + 1) & mask] == 0x00 ? 4 : 2;
+    }
+}
+
+std::vector<std::uint16_t> Chip8Instruction::successors(const std::uint8_t* mem, int size, Chip8::Quirks quirks) const{
+    const std::uint16_t mask = size - 1;
+    const std::uint16_t next = (addr + length) & mask;
+
+    switch(flow){
+        case NEXT:
+        case CALL:
+            return {next};
+        case SKIP:
+            return {next, static_cast<std::uint16_t>((next + lengthAt(mem, size, next, quirks)) & mask)};
+        case JUMP:
+            return {target};
+        default:
+            return {};
+    }
+}
+
+//Decode the instruction at addr, following the switch of Chip8::step
+Chip8Instruction decodeInstruction(const std::uint8_t* mem, int size, std::uint16_t addr, Chip8::Quirks quirks){
+    const int mask = size - 1;
+    const std::uint8_t high = mem[addr & mask];
+    const std::uint8_t low = mem[(addr + 1) & mask];
+    const std::uint8_t x = high & 0x0F;
+    const bool xo = quirks.xoChip;
+
+    Chip8Instruction in{};
+    in.addr = addr & mask;
+    in.opcode = high << 8 | low;
+    in.length = 2;
+    in.flow = Chip8Instruction::NEXT;
+
+    auto unknown = [&in]{ in.flow = Chip8Instruction::UNKNOWN; };
+
+    switch(high & 0xF0){
+        case 0x00:
+            if(low == 0xEE)
+                in.flow = Chip8Instruction::RETURN;
+            else if(low == 0xFD)
+                in.flow = Chip8Instruction::EXIT;
+            else if(low != 0xE0 && low != 0xFB && low != 0xFC && low != 0xFE && low != 0xFF
+                    && (low & 0xF0) != 0xC0 && !(xo && (low & 0xF0) == 0xD0))
+                unknown();
+        break;
+
+        case 0x10:
+            in.flow = Chip8Instruction::JUMP;
+            in.target = in.opcode & 0x0FFF;
+        break;
+
+        case 0x20:
+            in.flow = Chip8Instruction::CALL;
+            in.target = in.opcode & 0x0FFF;
+        break;
+
+        case 0x30:
+        case 0x40:
+            in.flow = Chip8Instruction::SKIP;
+        break;
+
+        case 0x50:
+            if((low & 0x0F) == 0x00)
+                in.flow = Chip8Instruction::SKIP;
+            else if(!xo || ((low & 0x0F) != 0x02 && (low & 0x0F) != 0x03))
+                unknown();
+        break;
+
+        case 0x80:
+            if((low & 0x0F) > 0x07 && (low & 0x0F) != 0x0E)
+                unknown();
+        break;
+
+        case 0x90:
+            if((low & 0x0F) == 0x00)
+                in.flow = Chip8Instruction::SKIP;
+            else
+                unknown();
+        break;
+
+        case 0xB0:
+            in.flow = Chip8Instruction::INDIRECT;
+        break;
+
+        case 0xE0:
+            if(low == 0x9E || low == 0xA1)
+                in.flow = Chip8Instruction::SKIP;
+            else
+                unknown();
+        break;
+
+        //step() does nothing for the F opcodes it doesn't know, without reporting them,
+        //but they're no more instructions than the others
+        case 0xF0:
+            switch(low){
+                case 0x00:
+                    if(xo && x == 0){
+                        in.length = 4;
+                        in.operand = mem[(addr + 2) & mask] << 8 | mem[(addr + 3) & mask];
+                    }
+                    else{
+                        unknown();
+                    }
+                break;
+
+                case 0x01:
+                    if(!xo || x >= 4) unknown();
+                break;
+
+                case 0x02:
+                    if(!xo || x != 0) unknown();
+                break;
+
+                case 0x3A:
+                    if(!xo) unknown();
+                break;
+
+                case 0x07: case 0x0A: case 0x15: case 0x18: case 0x1E: case 0x29:
+                case 0x30: case 0x33: case 0x55: case 0x65: case 0x75: case 0x85:
+                break;
+
+                default:
+                    unknown();
+                break;
+            }
+        break;
+
+        //6XKK, 7XKK, ANNN, CXKK and DXYN
+        default:
+        break;
+    }
+
+    return in;
+}
+
+std::string formatInstruction(const Chip8Instruction& in, Chip8::Quirks quirks){
+    const int x = in.opcode >> 8 & 0x0F;
+    const int y = in.opcode >> 4 & 0x0F;
+    const int n = in.opcode & 0x0F;
+    const int kk = in.opcode & 0xFF;
+    const int nnn = in.opcode & 0x0FFF;
+    char buf[32];
+
+    auto print = [&buf](const char* format, auto... args){
+        std::snprintf(buf, sizeof(buf), format, args...);
+    };
+
+    if(in.flow == Chip8Instruction::UNKNOWN){
+        print("DW %04X", in.opcode);
+        return buf;
+    }
+
+    switch(in.opcode >> 12){
+        case 0x0:
+            switch(kk){
+                case 0xE0: print("CLS"); break;
+                case 0xEE: print("RET"); break;
+                case 0xFB: print("SCR"); break;
+                case 0xFC: print("SCL"); break;
+                case 0xFD: print("EXIT"); break;
+                case 0xFE: print("LOW"); break;
+                case 0xFF: print("HIGH"); break;
+                default: print(y == 0xC ? "SCD %X" : "SCU %X", n); break;
+            }
+        break;
+        case 0x1: print("JP %03X", nnn); break;
+        case 0x2: print("CALL %03X", nnn); break;
+        case 0x3: print("SE V%X, %02X", x, kk); break;
+        case 0x4: print("SNE V%X, %02X", x, kk); break;
+        case 0x5:
+            if(n == 0) print("SE V%X, V%X", x, y);
+            else print(n == 2 ? "SAVE V%X - V%X" : "LOAD V%X - V%X", x, y);
+        break;
+        case 0x6: print("LD V%X, %02X", x, kk); break;
+        case 0x7: print("ADD V%X, %02X", x, kk); break;
+        case 0x8:{
+            static const char* const names[16] = {"LD", "OR", "AND", "XOR", "ADD", "SUB", "SHR", "SUBN",
+                                                  "", "", "", "", "", "", "SHL", ""};
+            if((n == 0x6 || n == 0xE) && quirks.shiftVx) print("%s V%X", names[n], x);
+            else print("%s V%X, V%X", names[n], x, y);
+        }
+        break;
+        case 0x9: print("SNE V%X, V%X", x, y); break;
+        case 0xA: print("LD I, %03X", nnn); break;
+        case 0xB:
+            if(quirks.jumpVx) print("JP V%X, %03X", x, nnn);
+            else print("JP V0, %03X", nnn);
+        break;
+        case 0xC: print("RND V%X, %02X", x, kk); break;
+        case 0xD: print("DRW V%X, V%X, %X", x, y, n); break;
+        case 0xE: print(kk == 0x9E ? "SKP V%X" : "SKNP V%X", x); break;
+        case 0xF:
+            switch(kk){
+                case 0x00: print("LD I, LONG %04X", in.operand); break;
+                case 0x01: print("PLANE %X", x); break;
+                case 0x02: print("AUDIO"); break;
+                case 0x07: print("LD V%X, DT", x); break;
+                case 0x0A: print("LD V%X, K", x); break;
+                case 0x15: print("LD DT, V%X", x); break;
+                case 0x18: print("LD ST, V%X", x); break;
+                case 0x1E: print("ADD I, V%X", x); break;
+                case 0x29: print("LD F, V%X", x); break;
+                case 0x30: print("LD HF, V%X", x); break;
+                case 0x33: print("LD B, V%X", x); break;
+                case 0x3A: print("PITCH V%X", x); break;
+                case 0x55: print("LD [I], V%X", x); break;
+                case 0x65: print("LD V%X, [I]", x); break;
+                case 0x75: print("LD R, V%X", x); break;
+                case 0x85: print("LD V%X, R", x); break;
+            }
+        break;
+    }
+
+    return buf;
+}
+
+
+
+Chip8Disasm::Chip8Disasm(const std::vector<std::uint8_t>& rom, Chip8::Quirks quirks)
+: quirks{quirks}, size{quirks.xoChip ? Chip8Core::XO_RAM_SIZE : Chip8Core::RAM_SIZE}
+{
+    romEnd = 0x200 + std::min<int>(rom.size(), size - 0x200);
+    mem.assign(size, 0);
+    kinds.assign(size, NONE);
+    std::copy(rom.begin(), rom.begin() + (romEnd - 0x200), mem.begin() + 0x200);
+    std::fill(kinds.begin() + 0x200, kinds.begin() + romEnd, DATA);
+
+    std::vector<std::uint16_t> leaders;
+    trace(leaders);
+    buildBlocks(leaders);
+    buildCallGraph();
+    countFeatures();
+}
+
+const std::vector<Chip8Disasm::Block>& Chip8Disasm::blocks() const{
+    return blockList;
+}
+
+const std::vector<Chip8Disasm::Function>& Chip8Disasm::functions() const{
+    return functionList;
+}
+
+const std::vector<Chip8Instruction>& Chip8Disasm::instructions() const{
+    return decoded;
+}
+
+const std::vector<std::uint16_t>& Chip8Disasm::indirectJumps() const{
+    return indirect;
+}
+
+const std::vector<Chip8Instruction>& Chip8Disasm::unknownOpcodes() const{
+    return unknown;
+}
+
+const std::vector<std::pair<std::uint16_t, std::uint16_t>>& Chip8Disasm::escapes() const{
+    return escaped;
+}
+
+Chip8Disasm::ByteKind Chip8Disasm::kind(std::uint16_t addr) const{
+    return addr < size ? kinds[addr] : NONE;
+}
+
+std::uint8_t Chip8Disasm::byte(std::uint16_t addr) const{
+    return addr < size ? mem[addr] : 0;
+}
+
+int Chip8Disasm::romSize() const{
+    return romEnd - 0x200;
+}
+
+int Chip8Disasm::codeBytes() const{
+    return std::count_if(kinds.begin(), kinds.end(), [](ByteKind k){ return k == CODE || k == OPERAND; });
+}
+
+int Chip8Disasm::dataBytes() const{
+    return std::count(kinds.begin(), kinds.end(), DATA);
+}
+
+int Chip8Disasm::fusionSites() const{
+    return fusions;
+}
+
+int Chip8Disasm::codeWrites() const{
+    return writesToCode;
+}
+
+bool Chip8Disasm::inRom(std::uint16_t addr) const{
+    return addr >= 0x200 && addr < romEnd;
+}
+
+//Follow every path from 0x200, marking the instructions reached
+void Chip8Disasm::trace(std::vector<std::uint16_t>& leaders){
+    if(romEnd == 0x200){
+        return;
+    }
+
+    std::vector<std::uint16_t> pending{0x200};
+    leaders.push_back(0x200);
+
+    while(!pending.empty()){
+        const std::uint16_t addr = pending.back();
+        pending.pop_back();
+
+        if(kinds[addr] == CODE){
+            continue;
+        }
+
+        const Chip8Instruction in = decodeInstruction(mem.data(), size, addr, quirks);
+        kinds[addr] = CODE;
+        for(int i = 1; i < in.length; i++){
+            const int at = (addr + i) & (size - 1);
+            if(inRom(at) && kinds[at] != CODE){
+                kinds[at] = OPERAND;
+            }
+        }
+        decoded.push_back(in);
+
+        if(in.flow == Chip8Instruction::UNKNOWN){
+            unknown.push_back(in);
+        }
+        else if(in.flow == Chip8Instruction::INDIRECT){
+            indirect.push_back(addr);
+        }
+
+        const std::vector<std::uint16_t> next = in.successors(mem.data(), size, quirks);
+        for(std::uint16_t to : next){
+            if(!inRom(to)){
+                escaped.push_back({addr, to});
+                continue;
+            }
+
+            //Anything but falling through to the next instruction starts a block
+            if(in.flow != Chip8Instruction::NEXT){
+                leaders.push_back(to);
+            }
+            pending.push_back(to);
+        }
+
+        if(in.flow == Chip8Instruction::CALL){
+            if(inRom(in.target)){
+                leaders.push_back(in.target);
+                pending.push_back(in.target);
+            }
+            else{
+                escaped.push_back({addr, in.target});
+            }
+        }
+    }
+
+    auto byAddress = [](const Chip8Instruction& a, const Chip8Instruction& b){ return a.addr < b.addr; };
+    std::sort(decoded.begin(), decoded.end(), byAddress);
+    std::sort(unknown.begin(), unknown.end(), byAddress);
+    std::sort(indirect.begin(), indirect.end());
+    std::sort(escaped.begin(), escaped.end());
+    std::sort(leaders.begin(), leaders.end());
+    leaders.erase(std::unique(leaders.begin(), leaders.end()), leaders.end());
+}
+
+void Chip8Disasm::buildBlocks(const std::vector<std::uint16_t>& leaders){
+    index.assign(size, -1);
+    for(std::size_t i = 0; i < decoded.size(); i++){
+        index[decoded[i].addr] = i;
+    }
+
+    for(std::uint16_t leader : leaders){
+        Block block{leader, leader, 0, {}};
+        const Chip8Instruction* in = &decoded[index[leader]];
+
+        //Up to the first instruction that doesn't just fall through,
+        //or the one before the next leader
+        for(;;){
+            block.instructions++;
+            const std::uint16_t next = (in->addr + in->length) & (size - 1);
+
+            if(in->flow != Chip8Instruction::NEXT || index[next] < 0
+               || std::binary_search(leaders.begin(), leaders.end(), next)){
+                break;
+            }
+            in = &decoded[index[next]];
+        }
+
+        block.last = in->addr;
+        for(std::uint16_t to : in->successors(mem.data(), size, quirks)){
+            if(index[to] >= 0){
+                block.successors.push_back(to);
+            }
+        }
+
+        blockList.push_back(block);
+    }
+}
+
+void Chip8Disasm::buildCallGraph(){
+    std::vector<std::uint16_t> entries;
+    if(!blockList.empty()){
+        entries.push_back(0x200);
+    }
+
+    for(const Chip8Instruction& in : decoded){
+        if(in.flow == Chip8Instruction::CALL && blockAt(in.target) >= 0){
+            entries.push_back(in.target);
+        }
+    }
+
+    std::sort(entries.begin(), entries.end());
+    entries.erase(std::unique(entries.begin(), entries.end()), entries.end());
+
+    //The blocks of each function, and the calls ending them
+    std::vector<bool> seen(blockList.size());
+    std::vector<int> pending;
+
+    for(std::uint16_t entry : entries){
+        Function function{entry, 0, {}};
+        std::fill(seen.begin(), seen.end(), false);
+        pending.assign(1, blockAt(entry));
+        seen[pending[0]] = true;
+
+        while(!pending.empty()){
+            const Block& block = blockList[pending.back()];
+            pending.pop_back();
+            function.blocks++;
+
+            const Chip8Instruction& in = decoded[index[block.last]];
+
+            if(in.flow == Chip8Instruction::CALL && blockAt(in.target) >= 0){
+                function.callees.push_back(in.target);
+            }
+
+            for(std::uint16_t to : block.successors){
+                const int b = blockAt(to);
+                if(b >= 0 && !seen[b]){
+                    seen[b] = true;
+                    pending.push_back(b);
+                }
+            }
+        }
+
+        std::sort(function.callees.begin(), function.callees.end());
+        function.callees.erase(std::unique(function.callees.begin(), function.callees.end()), function.callees.end());
+        functionList.push_back(function);
+    }
+}
+
+void Chip8Disasm::countFeatures(){
+    const int mask = size - 1;
+
+    for(const Chip8Instruction& in : decoded){
+        if(in.addr + 6 <= size && findFusion(&mem[in.addr]) != NO_FUSION){
+            fusions++;
+        }
+    }
+
+    auto isCode = [this, mask](int addr){
+        const ByteKind k = kinds[addr & mask];
+        return k == CODE || k == OPERAND;
+    };
+
+    //I is only followed within a block: anything can jump into the next one
+    for(const Block& block : blockList){
+        bool known = false;
+        int I = 0;
+
+        for(const Chip8Instruction* in = &decoded[index[block.start]]; in; in = nextInBlock(*in, block)){
+            const int x = in->opcode >> 8 & 0x0F;
+            const int y = in->opcode >> 4 & 0x0F;
+            const int op = in->opcode & 0xF0FF;
+            int written = 0;
+
+            if((in->opcode & 0xF000) == 0xA000){
+                known = true;
+                I = in->opcode & 0x0FFF;
+            }
+            else if(op == 0xF000 && in->length == 4){
+                known = true;
+                I = in->operand;
+            }
+            else if(op == 0xF01E || op == 0xF029 || op == 0xF030){
+                known = false;
+            }
+            else if(op == 0xF033){
+                written = 3;
+            }
+            else if(op == 0xF055){
+                written = x + 1;
+            }
+            else if((in->opcode & 0xF00F) == 0x5002 && quirks.xoChip){
+                written = std::abs(x - y) + 1;
+            }
+
+            if(known && written){
+                for(int i = 0; i < written; i++){
+                    if(isCode(I + i)){
+                        writesToCode++;
+                        break;
+                    }
+                }
+            }
+
+            if(quirks.incrementI && (op == 0xF055 || op == 0xF065)){
+                I += x + 1;
+            }
+        }
+    }
+}
+
+//Index in blockList of the block starting at addr, -1 if none
+int Chip8Disasm::blockAt(std::uint16_t addr) const{
+    auto b = std::lower_bound(blockList.begin(), blockList.end(), addr,
+                              [](const Block& block, std::uint16_t a){ return block.start < a; });
+    return b != blockList.end() && b->start == addr ? b - blockList.begin() : -1;
+}
+
+//The instruction after in, in the same block, nullptr after the last one
+const Chip8Instruction* Chip8Disasm::nextInBlock(const Chip8Instruction& in, const Block& block) const{
+    return in.addr == block.last ? nullptr : &decoded[index[(in.addr + in.length) & (size - 1)]];
+}
@@ -0,0 +1,139 @@
+#pragma once
+#include "Chip8.hpp"
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+//Static analysis of ROMs, without running them.
+//
+//decodeInstruction() reads an instruction the way Chip8::step does, for the same quirks:
+//the same opcodes are known, in the same modes, and the same ones are reported as unknown.
+//cpp8-disasm check runs every opcode through both to keep them in agreement.
+//
+//Chip8Disasm follows the control flow from 0x200: skips, jumps, calls and returns,
+//splits the code reached into basic blocks and builds the call graph.
+//BNNN jumps to an address only known at run time, so what it reaches can't be followed,
+//and neither can anything after an unknown opcode, which is most likely data.
+
+//One decoded instruction
+struct Chip8Instruction{
+    //How the instruction leaves
+    enum Flow : std::uint8_t{
+        NEXT,       //To the following instruction
+        SKIP,       //To the following one, or the one after it
+        JUMP,       //1NNN, to target
+        CALL,       //2NNN, to target, then back to the following instruction
+        RETURN,     //00EE
+        INDIRECT,   //BNNN, to an address computed at run time
+        EXIT,       //00FD, stays where it is
+        UNKNOWN,    //Not an instruction in this mode, most likely data
+    };
+
+    std::uint16_t addr;
+    std::uint16_t opcode;
+    std::uint16_t operand;  //The 2 bytes after F000 in F000 NNNN
+    std::uint8_t length;    //Bytes, 2 or 4 for F000 NNNN
+    Flow flow;
+    std::uint16_t target;   //JUMP and CALL
+
+    //Where the instruction can go next in the same subroutine:
+    //a CALL counts as going to the following instruction.
+    //mem is the one the instruction was decoded from.
+    std::vector<std::uint16_t> successors(const std::uint8_t* mem, int size, Chip8::Quirks quirks) const;
+};
+
+//Decode the instruction at addr. mem is the whole address space, size bytes
+//(4KB, or 64KB in XO-CHIP), and addresses wrap around at its end like in step().
+Chip8Instruction decodeInstruction(const std::uint8_t* mem, int size, std::uint16_t addr, Chip8::Quirks quirks);
+
+//Assembly for an instruction, in the syntax of the comments in Chip8::step:
+//"LD V3, 1F", "DRW V0, V1, 5", "JP 2A4". Unknown opcodes are "DW 0123".
+std::string formatInstruction(const Chip8Instruction& in, Chip8::Quirks quirks);
+
+
+class Chip8Disasm{
+    public:
+        //What each byte of the address space is
+        enum ByteKind : std::uint8_t{
+            NONE,           //Outside the ROM
+            DATA,           //Part of the ROM never reached as code
+            CODE,           //First byte of a reachable instruction
+            OPERAND,        //Rest of one
+        };
+
+        //A straight run of instructions, only entered at its first
+        //and only left after its last
+        struct Block{
+            std::uint16_t start;
+            std::uint16_t last;                     //Address of the last instruction
+            int instructions;
+            std::vector<std::uint16_t> successors;  //Blocks it can go to, calls excluded
+        };
+
+        //A subroutine: 0x200, or the target of a 2NNN
+        struct Function{
+            std::uint16_t entry;
+            int blocks;                         //Reached from the entry without calling
+            std::vector<std::uint16_t> callees; //Entries of the functions it calls, sorted
+        };
+
+        //Disassemble a ROM loaded at 0x200, as it would run with quirks
+        Chip8Disasm(const std::vector<std::uint8_t>& rom, Chip8::Quirks quirks);
+
+        const std::vector<Block>& blocks() const;         //By address
+        const std::vector<Function>& functions() const;   //By entry
+        const std::vector<Chip8Instruction>& instructions() const;   //Reachable ones, by address
+
+        //BNNN jumps, and unknown opcodes reached, by address
+        const std::vector<std::uint16_t>& indirectJumps() const;
+        const std::vector<Chip8Instruction>& unknownOpcodes() const;
+
+        //Jumps, calls and skips to outside the ROM, not followed: (from, to)
+        const std::vector<std::pair<std::uint16_t, std::uint16_t>>& escapes() const;
+
+        ByteKind kind(std::uint16_t addr) const;
+        std::uint8_t byte(std::uint16_t addr) const;
+        int romSize() const;
+        int codeBytes() const;      //CODE and OPERAND bytes
+        int dataBytes() const;
+
+        //Reachable addresses where a sequence of Fusion.hpp starts
+        int fusionSites() const;
+
+        //FX33, FX55 and 5XY2 writing, with I known from an ANNN or F000 NNNN
+        //earlier in the same block, to reachable code: the code modifies itself.
+        //Writes with an I only known at run time aren't counted, see cpp8-memprofile for those.
+        int codeWrites() const;
+
+    private:
+        Chip8::Quirks quirks;
+        int size;                           //Address space
+        int romEnd;
+        std::vector<std::uint8_t> mem;
+        std::vector<ByteKind> kinds;
+
+        std::vector<Chip8Instruction> decoded;
+        std::vector<int> index;             //In decoded of the instruction at each address, -1 if none
+        std::vector<Block> blockList;
+        std::vector<Function> functionList;
+        std::vector<std::uint16_t> indirect;
+        std::vector<Chip8Instruction> unknown;
+        std::vector<std::pair<std::uint16_t, std::uint16_t>> escaped;
+        int fusions = 0;
+        int writesToCode = 0;
+
+        bool inRom(std::uint16_t addr) const;
+
+        //Follow every path from 0x200, marking the instructions reached
+        void trace(std::vector<std::uint16_t>& leaders);
+        void buildBlocks(const std::vector<std::uint16_t>& leaders);
+        void buildCallGraph();
+        void countFeatures();
+
+        //Index in blockList of the block starting at addr, -1 if none
+        int blockAt(std::uint16_t addr) const;
+
+        //The instruction after in, in the same block, nullptr after the last one
+        const Chip8Instruction* nextInBlock(const Chip8Instruction& in, const Block& block) const;
+};
@@ -0,0 +1,244 @@
+#include "Chip8Env.hpp"
+#include "cpp8.h"
+
+Chip8Env::Chip8Env(std::string romFilename)
+: Chip8{romFilename, 1}
+{
+    reset(0);
+}
+
+Chip8Env::Chip8Env(const std::vector<std::uint8_t>& romData)
+: Chip8{romData, 1}
+{
+    reset(0);
+}
+
+void Chip8Env::reset(unsigned seed){
+    Chip8::reset(seed);
+    heldKeys = 0;
+    frames = 0;
+    done = false;
+}
+
+void Chip8Env::reset(const Chip8Core& state, unsigned seed){
+    Chip8::reset(state, seed);
+    frames = 0;
+    done = false;
+
+    //The keys held in the saved machine
+    heldKeys = 0;
+    for(int key = 0; key < 16; key++){
+        heldKeys |= state.keys[key] << key;
+    }
+}
+
+Chip8Env::StepResult Chip8Env::step(std::uint16_t actionMask, int frameCount){
+    StepResult result;
+    setKeys(actionMask);
+
+    for(int i = 0; i < frameCount && !done; i++){
+        runFrame();
+        frames++;
+        result.frames++;
+
+        if(rewardFn){
+            result.reward += rewardFn(*this);
+        }
+
+        done = halted() || (doneFn && doneFn(*this));
+    }
+
+    result.done = done;
+    return result;
+}
+
+void Chip8Env::setRewardFn(RewardFn fn){
+    rewardFn = std::move(fn);
+}
+
+void Chip8Env::setDoneFn(DoneFn fn){
+    doneFn = std::move(fn);
+}
+
+const Chip8Screen& Chip8Env::screen() const{
+    return getScreen();
+}
+
+void Chip8Env::unpackFramebuffer(std::uint8_t* out) const{
+    const Chip8Screen& s = getScreen();
+    const int words = s.wordsPerRow() * s.height();
+
+    //A word at a time, the rows follow each other in both
+    for(int w = 0; w < words; w++){
+        const std::uint64_t lit = s.planes[0][w] | s.planes[1][w];
+        for(int bit = 63; bit >= 0; bit--){
+            *out++ = lit >> bit & 1;
+        }
+    }
+}
+
+int Chip8Env::screenWidth() const{
+    return getScreen().width();
+}
+
+int Chip8Env::screenHeight() const{
+    return getScreen().height();
+}
+
+std::uint8_t* Chip8Env::ram(){
+    return getMemory();
+}
+
+const std::uint8_t* Chip8Env::ram() const{
+    return getMemory();
+}
+
+int Chip8Env::ramSize() const{
+    return getMemorySize();
+}
+
+const std::uint8_t* Chip8Env::registers() const{
+    return getRegisters();
+}
+
+std::uint16_t Chip8Env::indexRegister() const{
+    return getI();
+}
+
+std::uint16_t Chip8Env::programCounter() const{
+    return getPC();
+}
+
+std::uint64_t Chip8Env::frameCount() const{
+    return frames;
+}
+
+bool Chip8Env::halted() const{
+    //1NNN where NNN is the address of the instruction itself, or 00FD
+    const std::uint16_t pc = getPC();
+    const std::uint8_t high = getMemory()[pc];
+    const std::uint8_t low = getMemory()[(pc + 1) & (ramSize() - 1)];
+    return ((high & 0xF0) == 0x10 && (((high & 0x0F) << 8) | low) == pc)
+        || (high == 0x00 && low == 0xFD);
+}
+
+//Press and release keys so that exactly the keys in mask are held
+void Chip8Env::setKeys(std::uint16_t mask){
+    std::uint16_t changed = heldKeys ^ mask;
+
+    for(std::uint8_t key = 0; key < 16; key++){
+        if(changed & (1 << key)){
+            if(mask & (1 << key))
+                pressKey(key);
+            else
+                releaseKey(key);
+        }
+    }
+
+    heldKeys = mask;
+}
+
+
+
+//C interface, see cpp8.h
+struct cpp8_env{
+    Chip8Env env;
+};
+
+extern "C" {
+
+cpp8_env* cpp8_env_create(const uint8_t* rom, size_t size){
+    try{
+        return new cpp8_env{Chip8Env{std::vector<std::uint8_t>(rom, rom + size)}};
+    }
+    catch(...){
+        return nullptr;
+    }
+}
+
+cpp8_env* cpp8_env_create_from_file(const char* path){
+    try{
+        return new cpp8_env{Chip8Env{std::string{path}}};
+    }
+    catch(...){
+        return nullptr;
+    }
+}
+
+void cpp8_env_destroy(cpp8_env* env){
+    delete env;
+}
+
+void cpp8_env_reset(cpp8_env* env, unsigned seed){
+    env->env.reset(seed);
+}
+
+int cpp8_env_step(cpp8_env* env, uint16_t action_mask, int frames, float* reward){
+    Chip8Env::StepResult result = env->env.step(action_mask, frames);
+
+    if(reward){
+        *reward = result.reward;
+    }
+
+    return result.done;
+}
+
+void cpp8_env_set_reward_fn(cpp8_env* env, cpp8_reward_fn fn, void* user){
+    if(fn)
+        env->env.setRewardFn([fn, user](const Chip8Env& e){ return fn(e.ram(), user); });
+    else
+        env->env.setRewardFn(nullptr);
+}
+
+void cpp8_env_set_done_fn(cpp8_env* env, cpp8_done_fn fn, void* user){
+    if(fn)
+        env->env.setDoneFn([fn, user](const Chip8Env& e){ return fn(e.ram(), user) != 0; });
+    else
+        env->env.setDoneFn(nullptr);
+}
+
+const uint64_t* cpp8_env_screen_plane(const cpp8_env* env, int plane){
+    return env->env.screen().planes[plane];
+}
+
+int cpp8_env_screen_planes(void){
+    return Chip8Screen::PLANES;
+}
+
+int cpp8_env_screen_words_per_row(const cpp8_env* env){
+    return env->env.screen().wordsPerRow();
+}
+
+int cpp8_env_screen_width(const cpp8_env* env){
+    return env->env.screenWidth();
+}
+
+int cpp8_env_screen_height(const cpp8_env* env){
+    return env->env.screenHeight();
+}
+
+void cpp8_env_unpack_framebuffer(const cpp8_env* env, uint8_t* out){
+    env->env.unpackFramebuffer(out);
+}
+
+uint8_t* cpp8_env_ram(cpp8_env* env){
+    return env->env.ram();
+}
+
+size_t cpp8_env_ram_size(const cpp8_env* env){
+    return env->env.ramSize();
+}
+
+int cpp8_env_width(void){
+    return Chip8Env::WIDTH;
+}
+
+int cpp8_env_height(void){
+    return Chip8Env::HEIGHT;
+}
+
+int cpp8_env_hires(const cpp8_env* env){
+    return env->env.screenWidth() != Chip8Env::WIDTH;
+}
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+#include "Chip8.hpp"
+#include <functional>
+
+//Headless Chip8 meant to be embedded in other programs,
+//for example as an environment for training agents.
+//Nothing is drawn or played and time is only advanced by step(),
+//so no multimedia library is needed and runs are deterministic.
+class Chip8Env : public Chip8{
+    public:
+        static constexpr int WIDTH = DISPLAY_WIDTH;
+        static constexpr int HEIGHT = DISPLAY_HEIGHT;
+        static constexpr int RAM_SIZE = Chip8Core::RAM_SIZE;
+
+        //What step() returns
+        struct StepResult{
+            float reward = 0;   //Sum of the reward function over the frames
+            bool done = false;  //The episode is over, reset() before stepping again
+            int frames = 0;     //Frames actually emulated, less than asked if done
+        };
+
+        //Called after every frame.
+        //The reward function returns the reward for that frame,
+        //the done function returns true when the episode is over.
+        using RewardFn = std::function<float(const Chip8Env& env)>;
+        using DoneFn = std::function<bool(const Chip8Env& env)>;
+
+        //Might throw FileNotFound or FileTooBig
+        explicit Chip8Env(std::string romFilename);
+        explicit Chip8Env(const std::vector<std::uint8_t>& romData);
+
+        //Reset the machine and start a new episode.
+        //The same seed always gives the same episode for the same actions.
+        void reset(unsigned seed);
+
+        //Same, but start from a machine saved with getCore() instead of power on.
+        //Much cheaper than constructing a new Chip8Env, for fuzzing and search.
+        void reset(const Chip8Core& state, unsigned seed);
+
+        //Hold the keys in actionMask (bit n is key n) for the given amount of 60hz frames.
+        //Stops early if the episode ends.
+        StepResult step(std::uint16_t actionMask, int frames);
+
+        void setRewardFn(RewardFn fn);
+        void setDoneFn(DoneFn fn);
+
+        //References into the machine, nothing is copied, valid for the lifetime of the object
+        //(ram() until the quirks change). screen() is packed, see Chip8Screen:
+        //screenWidth()*screenHeight() pixels, WIDTH*HEIGHT, or twice as wide and high
+        //in SUPER-CHIP high resolution. ram() can be written between steps, code included.
+        const Chip8Screen& screen() const;
+        int screenWidth() const;
+        int screenHeight() const;
+        std::uint8_t* ram();
+        const std::uint8_t* ram() const;
+        int ramSize() const;    //RAM_SIZE, or the 64KB of XO-CHIP
+        const std::uint8_t* registers() const; //V0 to VF
+        std::uint16_t indexRegister() const;
+        std::uint16_t programCounter() const;
+
+        //Unpack the screen to out, screenWidth()*screenHeight() bytes, one per pixel, row by row:
+        //1 if it's lit in either XO-CHIP plane, else 0. For callers that want bytes, at the cost of a copy.
+        void unpackFramebuffer(std::uint8_t* out) const;
+
+        //Frames emulated since the last reset
+        std::uint64_t frameCount() const;
+
+        //True if the program is stuck jumping to itself, the usual way Chip8 games halt,
+        //or has exited with the SUPER-CHIP 00FD
+        bool halted() const;
+
+    private:
+        RewardFn rewardFn;
+        DoneFn doneFn;
+        std::uint16_t heldKeys = 0;
+        std::uint64_t frames = 0;
+        bool done = false;
+
+        //Press and release keys so that exactly the keys in mask are held
+        void setKeys(std::uint16_t mask);
+
+        //Nothing to do, this is headless
+        void setTone(bool) override {}
+        void handleInput() override {}
+        void draw(const Chip8Screen&) override {}
+};
@@ -0,0 +1,265 @@
+#include "Chip8Grid.hpp"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <thread>
+
+namespace{
+    //The 32 pixels made of each pair of pixels of a row, lit if either is
+    std::uint64_t halveRow(std::uint64_t pixels){
+        std::uint64_t x = (pixels | pixels >> 1) & 0x5555555555555555;
+        x = (x | x >> 1) & 0x3333333333333333;
+        x = (x | x >> 2) & 0x0F0F0F0F0F0F0F0F;
+        x = (x | x >> 4) & 0x00FF00FF00FF00FF;
+        x = (x | x >> 8) & 0x0000FFFF0000FFFF;
+        x = (x | x >> 16) & 0x00000000FFFFFFFF;
+        return x;
+    }
+}
+
+Chip8Grid::Core::Core(std::string romFilename) : Chip8{romFilename, 1}{}
+
+void Chip8Grid::Core::setTone(bool on){
+    toneOn = on;
+}
+
+Chip8Grid::Cell::Cell(std::string romFilename, Upscaler::Filter filter)
+: core{romFilename}, name{romFilename}, upscaler{filter, 0, 0}{}
+
+Chip8Grid::Chip8Grid(int columns, int rows, int scale, Upscaler::Filter filter)
+: columns{columns}, rows{rows}, scale{scale}, filter{filter}, factor{Upscaler{filter, 0, 0}.factor()}
+{
+    //If SDL couldn't be initialised, SDLContext printed why
+    if(!sdl.ok()){
+        return;
+    }
+
+    if(window = SDL_CreateWindow("Chip8", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED,
+                                 CELL_WIDTH * scale * columns, CELL_HEIGHT * scale * rows, SDL_WINDOW_SHOWN);
+       window == NULL){
+        std::cerr << "SDL Window Error: " << SDL_GetError() << "\n";
+        return;
+    }
+
+    renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+
+    atlas = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                              CELL_WIDTH * factor * columns, CELL_HEIGHT * factor * rows);
+    if(atlas == NULL){
+        std::cerr << "SDL Texture Error: " << SDL_GetError() << "\n";
+    }
+
+    //Same as Chip8_SDL, the focused cell's tone is played
+    SDL_AudioSpec want{};
+    SDL_AudioSpec have{};
+    want.freq = 48000;
+    want.format = AUDIO_S16SYS;
+    want.channels = 1;
+    want.samples = 256;
+    want.callback = audioCallback;
+    want.userdata = &tone;
+
+    if(audioDevice = SDL_OpenAudioDevice(NULL, 0, &want, &have, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE); audioDevice == 0){
+        std::cerr << "Failed opening audio device: " << SDL_GetError() << "\n";
+    }
+    else{
+        tone.setSampleRate(have.freq);
+        SDL_PauseAudioDevice(audioDevice, 0);
+    }
+}
+
+Chip8Grid::~Chip8Grid(){
+    if(audioDevice != 0){
+        SDL_CloseAudioDevice(audioDevice);
+    }
+    if(atlas != NULL){
+        SDL_DestroyTexture(atlas);
+    }
+    if(renderer != NULL){
+        SDL_DestroyRenderer(renderer);
+    }
+    if(window != NULL){
+        SDL_DestroyWindow(window);
+    }
+}
+
+Chip8* Chip8Grid::add(std::string romFilename){
+    if(cells.size() >= static_cast<std::size_t>(columns * rows)){
+        return nullptr;
+    }
+
+    cells.push_back(std::make_unique<Cell>(romFilename, filter));
+
+    if(cells.size() == 1){
+        setFocus(0);
+    }
+
+    return &cells.back()->core;
+}
+
+void Chip8Grid::run(){
+    if(atlas == NULL){
+        return;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    constexpr std::chrono::microseconds frameTime{1000000 / 60};
+    Clock::time_point nextFrame = Clock::now();
+
+    while(running){
+        SDL_Event e;
+        while(SDL_PollEvent(&e)){
+            handleEvent(e);
+        }
+
+        //Streaming textures come back with undefined contents, every cell is rewritten
+        void* pixels;
+        int pitch;
+        if(SDL_LockTexture(atlas, NULL, &pixels, &pitch) == 0){
+            workers.parallelFor(static_cast<std::size_t>(columns * rows), [this, pixels, pitch](std::size_t cell){
+                runCell(cell, static_cast<std::uint8_t*>(pixels), pitch);
+            });
+            SDL_UnlockTexture(atlas);
+        }
+
+        if(!cells.empty()){
+            tone.setOn(cells[focus]->core.toneOn);
+        }
+
+        present();
+
+        //Don't try to catch up on slow frames
+        nextFrame += frameTime;
+        if(Clock::time_point now = Clock::now(); nextFrame < now){
+            nextFrame = now;
+        }
+        else{
+            std::this_thread::sleep_until(nextFrame);
+        }
+    }
+}
+
+void Chip8Grid::runCell(std::size_t index, std::uint8_t* pixels, int pitch){
+    const int width = CELL_WIDTH * factor;
+    const int height = CELL_HEIGHT * factor;
+    std::uint8_t* origin = pixels + (index / columns) * height * pitch + (index % columns) * width * sizeof(std::uint32_t);
+
+    //Empty cells are black
+    if(index >= cells.size()){
+        for(int y = 0; y < height; y++){
+            std::memset(origin + y * pitch, 0, width * sizeof(std::uint32_t));
+        }
+        return;
+    }
+
+    Cell& cell = *cells[index];
+    cell.core.runFrame();
+
+    //The texture is ARGB, colors are 0xRRGGBB
+    if(std::uint32_t fg = cell.core.getForeground() | 0xFF000000, bg = cell.core.getBackground() | 0xFF000000;
+       fg != cell.foreground || bg != cell.background){
+        cell.foreground = fg;
+        cell.background = bg;
+        cell.upscaler.setColors(fg, bg);
+    }
+
+    if(std::uint32_t second = cell.core.getSecondColor() | 0xFF000000, blend = cell.core.getBlendColor() | 0xFF000000;
+       second != cell.secondColor || blend != cell.blendColor){
+        cell.secondColor = second;
+        cell.blendColor = blend;
+        cell.upscaler.setPlaneColors(second, blend);
+    }
+
+    //Cells are 64x32, a 128x64 screen is shown at half size with each 2x2 block OR'ed into a pixel
+    const Chip8Screen& screen = cell.core.getScreen();
+    const std::uint64_t* planes[Chip8Screen::PLANES] = {screen.planes[0], screen.planes[1]};
+
+    if(screen.hires){
+        for(int p = 0; p < Chip8Screen::PLANES; p++){
+            for(int y = 0; y < CELL_HEIGHT; y++){
+                const std::uint64_t* pair = &screen.planes[p][y * 4];
+                cell.halvedScreen[p][y] = halveRow(pair[0] | pair[2]) << 32 | halveRow(pair[1] | pair[3]);
+            }
+
+            planes[p] = cell.halvedScreen[p].data();
+        }
+    }
+
+    if(screen.usesSecondPlane())
+        cell.upscaler.upscale(planes[0], planes[1], 1, CELL_HEIGHT, origin, pitch);
+    else
+        cell.upscaler.upscale(planes[0], 1, CELL_HEIGHT, origin, pitch);
+}
+
+void Chip8Grid::present(){
+    SDL_RenderCopy(renderer, atlas, NULL, NULL);
+
+    //Frame the focused cell
+    if(!cells.empty()){
+        const int w = CELL_WIDTH * scale, h = CELL_HEIGHT * scale;
+        const SDL_Rect outer{static_cast<int>(focus % columns) * w, static_cast<int>(focus / columns) * h, w, h};
+        const SDL_Rect inner{outer.x + 1, outer.y + 1, w - 2, h - 2};
+
+        SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
+        SDL_RenderDrawRect(renderer, &outer);
+        SDL_RenderDrawRect(renderer, &inner);
+    }
+
+    SDL_RenderPresent(renderer);
+}
+
+void Chip8Grid::handleEvent(const SDL_Event& e){
+    if(e.type == SDL_QUIT){
+        running = false;
+    }
+    else if(e.type == SDL_MOUSEBUTTONDOWN){
+        int column = e.button.x / (CELL_WIDTH * scale);
+        int row = e.button.y / (CELL_HEIGHT * scale);
+
+        if(column < columns && row < rows){
+            setFocus(row * columns + column);
+        }
+    }
+    else if((e.type == SDL_KEYDOWN || e.type == SDL_KEYUP) && !cells.empty()){
+        SDL_Keycode sym = e.key.keysym.sym;
+        int key = SDLContext::chip8Key(sym);
+
+        if(key >= 0){
+            if(e.type == SDL_KEYUP){
+                cells[focus]->core.releaseKey(key);
+            }
+            else if(!e.key.repeat){
+                cells[focus]->core.pressKey(key);
+            }
+        }
+        else if(e.type == SDL_KEYDOWN && sym == SDLK_TAB){
+            setFocus((focus + 1) % cells.size());
+        }
+        else if(e.type == SDL_KEYDOWN && sym == SDLK_ESCAPE){
+            running = false;
+        }
+    }
+}
+
+void Chip8Grid::setFocus(std::size_t cell){
+    if(cell >= cells.size()){
+        return;
+    }
+
+    //Keys held in the cell losing focus would never be released
+    for(std::uint8_t key = 0; key < 16; key++){
+        cells[focus]->core.releaseKey(key);
+    }
+
+    focus = cell;
+
+    if(window != NULL){
+        std::string title = "Chip8 - " + cells[focus]->name;
+        SDL_SetWindowTitle(window, title.c_str());
+    }
+}
+
+void Chip8Grid::audioCallback(void* userdata, Uint8* stream, int len){
+    static_cast<ToneGenerator*>(userdata)->generate(reinterpret_cast<std::int16_t*>(stream), len / sizeof(std::int16_t));
+}
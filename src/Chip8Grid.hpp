@@ -0,0 +1,101 @@
+#pragma once
+#include <SDL2/SDL.h>
+#include "Chip8.hpp"
+#include "SDLContext.hpp"
+#include "ToneGenerator.hpp"
+#include "Upscaler.hpp"
+#include "WorkerPool.hpp"
+#include <memory>
+#include <vector>
+
+//Several Chip8 in one window, a cell of a grid each,
+//for wall displays and for comparing quirk profiles side by side.
+//The cores run headless a frame at a time (see Chip8::runFrame), spread over a worker pool,
+//and are upscaled into one texture atlas with a cell per core.
+//Keys go to the focused cell, Tab or a click moves the focus. Only the focused cell beeps.
+class Chip8Grid{
+    public:
+        Chip8Grid(int columns, int rows, int scale, Upscaler::Filter filter = Upscaler::Filter::NONE);
+        ~Chip8Grid();
+
+        //Put a core running romFilename in the next free cell and return it, to be set up before run().
+        //nullptr if the grid is full. Might throw FileNotFound or FileTooBig.
+        Chip8* add(std::string romFilename);
+
+        //Run every core until the window is closed
+        void run();
+
+    private:
+        static constexpr int CELL_WIDTH = 64;
+        static constexpr int CELL_HEIGHT = 32;
+
+        //A core without a window of its own
+        class Core : public Chip8{
+            public:
+                explicit Core(std::string romFilename);
+
+                using Chip8::pressKey;
+                using Chip8::releaseKey;
+                using Chip8::runFrame;
+                using Chip8::getScreen;
+                using Chip8::getForeground;
+                using Chip8::getBackground;
+                using Chip8::getSecondColor;
+                using Chip8::getBlendColor;
+
+                bool toneOn = false;
+
+            private:
+                void setTone(bool on) override;
+                void handleInput() override {}
+                void draw(const Chip8Screen&) override {}
+        };
+
+        struct Cell{
+            Cell(std::string romFilename, Upscaler::Filter filter);
+
+            Core core;
+            std::string name;
+            Upscaler upscaler;
+            //SUPER-CHIP high resolution, shrunk to fit, for each plane
+            std::array<std::array<std::uint64_t, CELL_HEIGHT>, Chip8Screen::PLANES> halvedScreen;
+            std::uint32_t foreground = 0;
+            std::uint32_t background = 0;
+            std::uint32_t secondColor = 0;
+            std::uint32_t blendColor = 0;
+        };
+
+    //DATA
+        //First, so that SDL is up before the window and down after it
+        SDLContext sdl;
+        SDL_Window* window = NULL;
+        SDL_Renderer* renderer = NULL;
+
+        //Every cell upscaled, columns * rows cells of the upscaled size
+        SDL_Texture* atlas = NULL;
+
+        int columns;
+        int rows;
+        int scale;
+        Upscaler::Filter filter;
+        int factor;     //Of the upscaler, the atlas has factor times the pixels of the Chip8 screens
+        std::vector<std::unique_ptr<Cell>> cells;
+        std::size_t focus = 0;
+        bool running = true;
+
+        WorkerPool workers;
+
+        SDL_AudioDeviceID audioDevice = 0;
+        ToneGenerator tone;
+
+    //METHODS
+        void handleEvent(const SDL_Event& e);
+        void setFocus(std::size_t cell);
+
+        //Run a frame of a cell and upscale it into its place in the locked atlas
+        void runCell(std::size_t cell, std::uint8_t* pixels, int pitch);
+
+        void present();
+
+        static void audioCallback(void* userdata, Uint8* stream, int len);
+};
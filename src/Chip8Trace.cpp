@@ -0,0 +1,135 @@
+#include "Chip8Trace.hpp"
+#include <cstring>
+#include <iostream>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CPP8_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace{
+    constexpr char magic[8] = "CPP8TRC";
+    constexpr std::uint32_t version = 1;
+}
+
+TraceWriter::TraceWriter(const std::string& path, std::size_t capacity){
+    #ifdef CPP8_HAVE_MMAP
+    //Round capacity up to a power of 2, so the ring index is a mask
+    std::uint64_t size = 1;
+    while(size < capacity){
+        size <<= 1;
+    }
+
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    mapSize = sizeof(TraceHeader) + size * sizeof(TraceRecord);
+
+    if(fd < 0){
+        std::cerr << "Could not open trace file \"" << path << "\"\n";
+    }
+    else if(ftruncate(fd, mapSize) != 0){
+        std::cerr << "Could not resize trace file \"" << path << "\"\n";
+    }
+    else if(map = mmap(nullptr, mapSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0); map == MAP_FAILED){
+        std::cerr << "Could not map trace file \"" << path << "\"\n";
+        map = nullptr;
+    }
+    else{
+        header = static_cast<TraceHeader*>(map);
+        records = reinterpret_cast<TraceRecord*>(header + 1);
+        mask = size - 1;
+
+        std::memcpy(header->magic, magic, sizeof(magic));
+        header->version = version;
+        header->recordSize = sizeof(TraceRecord);
+        header->capacity = size;
+        header->written = 0;
+    }
+
+    //The mapping stays valid after closing
+    if(fd >= 0){
+        close(fd);
+    }
+    #else
+    std::cerr << "Tracing is not supported on this platform\n";
+    #endif
+}
+
+TraceWriter::~TraceWriter(){
+    #ifdef CPP8_HAVE_MMAP
+    if(map){
+        munmap(map, mapSize);
+    }
+    #endif
+}
+
+bool TraceWriter::ok() const{
+    return map != nullptr;
+}
+
+
+
+TraceReader::TraceReader(const std::string& path){
+    #ifdef CPP8_HAVE_MMAP
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat info;
+
+    if(fd < 0 || fstat(fd, &info) != 0){
+        std::cerr << "Could not open trace file \"" << path << "\"\n";
+    }
+    else if(static_cast<std::size_t>(info.st_size) < sizeof(TraceHeader)){
+        std::cerr << "\"" << path << "\" is not a trace file\n";
+    }
+    else if(map = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0); map == MAP_FAILED){
+        std::cerr << "Could not map trace file \"" << path << "\"\n";
+        map = nullptr;
+    }
+    else{
+        mapSize = info.st_size;
+        header = static_cast<const TraceHeader*>(map);
+        records = reinterpret_cast<const TraceRecord*>(header + 1);
+
+        //Check this is a trace we know how to read, and that it's all there
+        if(std::memcmp(header->magic, magic, sizeof(magic)) != 0
+           || header->version != version
+           || header->recordSize != sizeof(TraceRecord)
+           || mapSize < sizeof(TraceHeader) + header->capacity * sizeof(TraceRecord)){
+            std::cerr << "\"" << path << "\" is not a trace file\n";
+            munmap(map, mapSize);
+            map = nullptr;
+        }
+    }
+
+    if(fd >= 0){
+        close(fd);
+    }
+    #else
+    std::cerr << "Tracing is not supported on this platform\n";
+    #endif
+}
+
+TraceReader::~TraceReader(){
+    #ifdef CPP8_HAVE_MMAP
+    if(map){
+        munmap(map, mapSize);
+    }
+    #endif
+}
+
+bool TraceReader::ok() const{
+    return map != nullptr;
+}
+
+std::size_t TraceReader::size() const{
+    return header->written < header->capacity ? header->written : header->capacity;
+}
+
+const TraceRecord& TraceReader::operator[](std::size_t i) const{
+    return records[(dropped() + i) & (header->capacity - 1)];
+}
+
+std::uint64_t TraceReader::dropped() const{
+    return header->written - size();
+}
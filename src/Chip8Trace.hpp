@@ -0,0 +1,89 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+//Execution traces.
+//Every executed instruction is written as a fixed size record
+//into a ring buffer backed by a memory mapped file,
+//so writing one is a couple of stores and nothing is lost if the process dies.
+//When the ring is full the oldest records are overwritten.
+
+//One record per executed instruction
+struct TraceRecord{
+    std::uint64_t cycle;    //Instructions executed before this one
+    std::uint16_t pc;       //Address of the instruction
+    std::uint16_t opcode;
+    std::uint16_t I;        //I after the instruction
+    std::uint8_t reg;       //Index of the V register the instruction changed, NO_REG if none.
+                            //If more than one changed, the lowest one other than VF.
+    std::uint8_t value;     //Value of that register after the instruction
+
+    static constexpr std::uint8_t NO_REG = 0xFF;
+};
+static_assert(sizeof(TraceRecord) == 16, "Trace records are written to disk as they are");
+
+//Start of the trace file, followed by the records
+struct TraceHeader{
+    char magic[8];              //"CPP8TRC"
+    std::uint32_t version;
+    std::uint32_t recordSize;
+    std::uint64_t capacity;     //Records in the ring, a power of 2
+    std::uint64_t written;      //Records written since the start, including overwritten ones
+    std::uint8_t padding[32];   //Keep records aligned to a cache line
+};
+static_assert(sizeof(TraceHeader) == 64, "Trace header is written to disk as it is");
+
+
+class TraceWriter{
+    public:
+        //Creates or truncates the file at path, sized for capacity records.
+        //capacity is rounded up to a power of 2.
+        //Check ok() to know if it worked.
+        TraceWriter(const std::string& path, std::size_t capacity);
+        ~TraceWriter();
+
+        TraceWriter(const TraceWriter&) = delete;
+        TraceWriter& operator=(const TraceWriter&) = delete;
+
+        bool ok() const;
+
+        void write(const TraceRecord& record){
+            records[written & mask] = record;
+            header->written = ++written;
+        }
+
+    private:
+        void* map = nullptr;
+        std::size_t mapSize = 0;
+        TraceHeader* header = nullptr;
+        TraceRecord* records = nullptr;
+        std::uint64_t mask = 0;
+        std::uint64_t written = 0;
+};
+
+
+class TraceReader{
+    public:
+        //Maps the file at path read only. Check ok() to know if it worked.
+        explicit TraceReader(const std::string& path);
+        ~TraceReader();
+
+        TraceReader(const TraceReader&) = delete;
+        TraceReader& operator=(const TraceReader&) = delete;
+
+        bool ok() const;
+
+        //Records still in the ring, oldest first
+        std::size_t size() const;
+        const TraceRecord& operator[](std::size_t i) const;
+
+        //Records that were overwritten before the oldest one
+        std::uint64_t dropped() const;
+
+    private:
+        void* map = nullptr;
+        std::size_t mapSize = 0;
+        const TraceHeader* header = nullptr;
+        const TraceRecord* records = nullptr;
+};
@@ -1,40 +1,55 @@
 #include "Chip8_SDL.hpp"
-#include "../assets/beep.h"
+#include <algorithm>
 #include <iostream>
 
-Chip8_SDL::Chip8_SDL(std::string romFilename, int scale)
-: Chip8{romFilename, scale}
+Chip8_SDL::Chip8_SDL(std::string romFilename, int scale, Upscaler::Filter filter)
+: Chip8{romFilename, scale}, upscaler{filter, 0, 0}
 {
-    //If SDL_Init error
-    if(SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0){
-        std::cerr << "SDL_Init Error: " << SDL_GetError() << "\n";
+    //If SDL couldn't be initialised, SDLContext printed why
+    if(!sdl.ok()){
+        return;
     }
 
-    //Else init window and check if it is null
-    else if(window = SDL_CreateWindow("Chip8", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, DISPLAY_WIDTH*scale, DISPLAY_HEIGHT*scale, SDL_WINDOW_SHOWN);
+    //Init window and check if it is null
+    if(window = SDL_CreateWindow("Chip8", SDL_WINDOWPOS_CENTERED, SDL_WINDOWPOS_CENTERED, DISPLAY_WIDTH*scale, DISPLAY_HEIGHT*scale, SDL_WINDOW_SHOWN);
             window == NULL){
             std::cerr << "SDL Window Error: " << SDL_GetError() << "\n";
     }
-    //If no error, init rect and renderer
+    //If no error, init renderer and texture
     else{
         renderer = SDL_CreateRenderer(window, -1, SDL_RENDERER_ACCELERATED);
         SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255); //Black screen
         SDL_RenderClear(renderer);
-        rect.h = scale; rect.w = scale;
-
-        //Sound init
-        if(SDL_RWops* rw = SDL_RWFromConstMem(beepData.data(), beepData.size()); rw == NULL){
-            std::cerr << "Error obtaining sound effect from memory: " << SDL_GetError() << "\n";
-        } 
-        else if(SDL_LoadWAV_RW(rw, true, &beepSpec, &beepBuf, &beepLength) == NULL){
-            std::cerr << "Error loading sound effect: " << SDL_GetError() << "\n"; 
+
+        //Rewritten every frame. Scaled to the window with nearest neighbour,
+        //any smoothing is done by the upscaler.
+        //Big enough for the SUPER-CHIP resolution, a 64x32 frame only uses its top left corner,
+        //so switching resolution changes nothing but the part copied to the window.
+        SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, "nearest");
+        int factor = upscaler.factor();
+        texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING,
+                                    Chip8Screen::HIRES_WIDTH * factor, Chip8Screen::HIRES_HEIGHT * factor);
+        if(texture == NULL){
+            std::cerr << "SDL Texture Error: " << SDL_GetError() << "\n";
         }
-        else if(audioDevice = SDL_OpenAudioDevice(NULL, 0, &beepSpec, NULL, 0); audioDevice == 0){
+
+        //Sound init. The tone is made by audioCallback on SDL's audio thread,
+        //a short buffer keeps it within a few ms of the sound timer.
+        SDL_AudioSpec want{};
+        SDL_AudioSpec have{};
+        want.freq = 48000;
+        want.format = AUDIO_S16SYS;
+        want.channels = 1;
+        want.samples = 256;
+        want.callback = audioCallback;
+        want.userdata = &tone;
+
+        if(audioDevice = SDL_OpenAudioDevice(NULL, 0, &want, &have, SDL_AUDIO_ALLOW_FREQUENCY_CHANGE); audioDevice == 0){
             std::cerr << "Failed opening audio device: " << SDL_GetError() << "\n"; 
         }
         else{
+            tone.setSampleRate(have.freq);
             SDL_PauseAudioDevice(audioDevice, 0); //Unpause audio
-            audioSuccess = true;
         }
 
     }
@@ -42,231 +57,159 @@ Chip8_SDL::Chip8_SDL(std::string romFilename, int scale)
 }
 
 Chip8_SDL::~Chip8_SDL(){
+    if(texture != NULL){
+        SDL_DestroyTexture(texture);
+    }
     SDL_DestroyRenderer(renderer);
     SDL_DestroyWindow(window);
 
-    SDL_CloseAudioDevice(audioDevice);
-    SDL_FreeWAV(beepBuf);
-    SDL_Quit();
+    if(audioDevice != 0){
+        SDL_CloseAudioDevice(audioDevice);
+    }
 }
 
 
 void Chip8_SDL::handleInput(){
     SDL_Event buf;
 
+    //While the game waits for input, sleep until some comes.
+    //wakeUp() ends the wait early when the game goes on by itself.
+    if(idle() && SDL_WaitEventTimeout(&buf, 100)){
+        handleEvent(buf);
+    }
+
     while(SDL_PollEvent(&buf)){
-        if(buf.type == SDL_KEYDOWN || buf.type == SDL_KEYUP){
-            handleKeyEvent(buf);
-        }
-        else if(buf.type == SDL_QUIT){
-            stop();
-        }
+        handleEvent(buf);
     }
 }
 
-void Chip8_SDL::draw(const std::array<bool, DISPLAY_WIDTH*DISPLAY_HEIGHT>& screen){
-    int scale = getScale();
+void Chip8_SDL::handleEvent(const SDL_Event& e){
+    if(e.type == SDL_KEYDOWN || e.type == SDL_KEYUP){
+        handleKeyEvent(e);
+    }
+    else if(e.type == SDL_QUIT){
+        stop();
+    }
+}
 
-    //Use black to clear the screen
-    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 255);
-    SDL_RenderClear(renderer);
+//Called from the emulation thread, SDL_PushEvent is safe to call from any thread
+void Chip8_SDL::wakeUp(){
+    SDL_Event e{};
+    e.type = SDL_USEREVENT;
+    SDL_PushEvent(&e);
+}
 
-    //Use white for the pixels
-    SDL_SetRenderDrawColor(renderer, 255, 255, 255, 255); //White, no transparency
+void Chip8_SDL::draw(const Chip8Screen& screen){
+    void* pixels;
+    int pitch;
 
-    //For each coordinate
-    for(int y = 0; y < Chip8::DISPLAY_HEIGHT; y++){
-        for(int x = 0; x < Chip8::DISPLAY_WIDTH; x++){
+    if(texture == NULL){
+        return;
+    }
 
-            //If pixel is turned on, draw it
-            if(screen[(y * Chip8::DISPLAY_WIDTH) + x]){
-                rect.x = x * scale; 
-                rect.y = y * scale;
-                SDL_RenderFillRect(renderer, &rect);
-            }
+    //The texture is ARGB, colors are 0xRRGGBB
+    if(std::uint32_t fg = getForeground() | 0xFF000000, bg = getBackground() | 0xFF000000;
+       fg != foreground || bg != background){
+        foreground = fg;
+        background = bg;
+        upscaler.setColors(foreground, background);
+    }
 
-        }
+    if(std::uint32_t second = getSecondColor() | 0xFF000000, blend = getBlendColor() | 0xFF000000;
+       second != secondColor || blend != blendColor){
+        secondColor = second;
+        blendColor = blend;
+        upscaler.setPlaneColors(secondColor, blendColor);
+    }
+
+    //The screen is already packed, upscale it straight into the texture
+    const int factor = upscaler.factor();
+    const SDL_Rect area{0, 0, screen.width() * factor, screen.height() * factor};
+
+    if(SDL_LockTexture(texture, &area, &pixels, &pitch) == 0){
+        if(screen.usesSecondPlane())
+            upscaler.upscale(screen.planes[0], screen.planes[1], screen.wordsPerRow(), screen.height(), pixels, pitch);
+        else
+            upscaler.upscale(screen.planes[0], screen.wordsPerRow(), screen.height(), pixels, pitch);
+        SDL_UnlockTexture(texture);
     }
 
     //Update screen
+    SDL_RenderCopy(renderer, texture, &area, NULL);
+
+    if(const Metrics* metrics = getOverlay()){
+        drawOverlay(*metrics);
+    }
+
     SDL_RenderPresent(renderer);
-    //window.display();
 }
 
-void Chip8_SDL::playSound(){
-    if(audioSuccess && SDL_QueueAudio(audioDevice, beepBuf, beepLength) < 0){
-        std::cerr << "Failed to play sound effect: " << SDL_GetError() << "\n";
+void Chip8_SDL::drawOverlay(const Metrics& metrics){
+    //An overlay pixel is a fifth of a Chip8 pixel, so the text is readable at any scale
+    const int size = std::max(1, getScale() / 5);
+    const SDL_Rect box{0, 0, Metrics::OVERLAY_WIDTH * size, Metrics::OVERLAY_HEIGHT * size};
+
+    overlayRects.clear();
+    for(Metrics::Point p : metrics.overlay()){
+        overlayRects.push_back({p.x * size, p.y * size, size, size});
     }
+
+    //Yellow on translucent black, to stand out from any colors
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    SDL_SetRenderDrawColor(renderer, 0, 0, 0, 160);
+    SDL_RenderFillRect(renderer, &box);
+    SDL_SetRenderDrawColor(renderer, 255, 255, 0, 255);
+    SDL_RenderFillRects(renderer, overlayRects.data(), static_cast<int>(overlayRects.size()));
+}
+
+void Chip8_SDL::setTone(bool on){
+    tone.setOn(on);
+}
+
+void Chip8_SDL::setTonePattern(const std::uint8_t* pattern, float rate){
+    tone.setPattern(pattern, rate);
+}
+
+//Runs on SDL's audio thread
+void Chip8_SDL::audioCallback(void* userdata, Uint8* stream, int len){
+    static_cast<ToneGenerator*>(userdata)->generate(reinterpret_cast<std::int16_t*>(stream), len / sizeof(std::int16_t));
 }
 
 
 
-void Chip8_SDL::handleKeyEvent(SDL_Event e){
-    /*
-    Chip8 Key   Keyboard
-    ---------   ---------
-     1 2 3 C     1 2 3 4
-     4 5 6 D     q w e r
-     7 8 9 E     a s d f
-     A 0 B F     z x c v
-     */
-
-    switch(e.type){
-        //Key Pressed
-        case SDL_KEYDOWN:
-            switch(e.key.keysym.sym){
-                //ESC - Quit
-                case SDLK_ESCAPE:
-                    stop();
-                break;
-
-                //Pause
-                case SDLK_PAUSE:
-                case SDLK_F1:
-                    togglePause();
-                break;
-
-                case SDLK_1:
-                    pressKey(1);
-                break;
-
-                case SDLK_2:
-                    pressKey(2);
-                break;
-
-                case SDLK_3:
-                    pressKey(3);
-                break;
-
-                case SDLK_4:
-                    pressKey(0xC);
-                break;
-
-                case SDLK_q:
-                    pressKey(4);
-                break;
-
-                case SDLK_w:
-                    pressKey(5);
-                break;
-
-                case SDLK_e:
-                    pressKey(6);
-                break;
-
-                case SDLK_r:
-                    pressKey(0xD);
-                break;
-
-                case SDLK_a:
-                    pressKey(7);
-                break;
-
-                case SDLK_s:
-                    pressKey(8);
-                break;
-
-                case SDLK_d:
-                    pressKey(9);
-                break;
-
-                case SDLK_f:
-                    pressKey(0xE);
-                break;
-
-                case SDLK_z:
-                    pressKey(0xA);
-                break;
-
-                case SDLK_x:
-                    pressKey(0);
-                break;
-
-                case SDLK_c:
-                    pressKey(0xB);
-                break;
-
-                case SDLK_v:
-                    pressKey(0xF);
-                break;
-
-                default:
-                break;
-            }
-        break;
-
-        case SDL_KEYUP:
-            switch(e.key.keysym.sym){
-                case SDLK_1:
-                    releaseKey(1);
-                break;
-
-                case SDLK_2:
-                    releaseKey(2);
-                break;
-
-                case SDLK_3:
-                    releaseKey(3);
-                break;
-
-                case SDLK_4:
-                    releaseKey(0xC);
-                break;
-
-                case SDLK_q:
-                    releaseKey(4);
-                break;
-
-                case SDLK_w:
-                    releaseKey(5);
-                break;
-
-                case SDLK_e:
-                    releaseKey(6);
-                break;
-
-                case SDLK_r:
-                    releaseKey(0xD);
-                break;
-
-                case SDLK_a:
-                    releaseKey(7);
-                break;
-
-                case SDLK_s:
-                    releaseKey(8);
-                break;
-
-                case SDLK_d:
-                    releaseKey(9);
-                break;
-
-                case SDLK_f:
-                    releaseKey(0xE);
-                break;
-
-                case SDLK_z:
-                    releaseKey(0xA);
-                break;
-
-                case SDLK_x:
-                    releaseKey(0);
-                break;
-
-                case SDLK_c:
-                    releaseKey(0xB);
-                break;
-
-                case SDLK_v:
-                    releaseKey(0xF);
-                break;
-
-                default:
-                break;
-            }
-        break; 
+void Chip8_SDL::handleKeyEvent(const SDL_Event& e){
+    SDL_Keycode sym = e.key.keysym.sym;
+    int key = SDLContext::chip8Key(sym);
 
-        default:
-        break;
+    //Chip8 keys. Held keys repeat, but the game only needs to hear about the first press.
+    if(key >= 0){
+        if(e.type == SDL_KEYUP){
+            releaseKey(key);
+        }
+        else if(!e.key.repeat){
+            pressKey(key);
+        }
+    }
+    else if(e.type == SDL_KEYDOWN){
+        switch(sym){
+            //ESC - Quit
+            case SDLK_ESCAPE:
+                stop();
+            break;
+
+            //Pause
+            case SDLK_PAUSE:
+            case SDLK_F1:
+                togglePause();
+            break;
+
+            //Debugger
+            case SDLK_F2:
+                breakIntoDebugger();
+            break;
+
+            default:
+            break;
+        }
     }
 }
@@ -1,32 +1,54 @@
 #pragma once
 #include <SDL2/SDL.h>
 #include "Chip8.hpp"
+#include "SDLContext.hpp"
+#include "ToneGenerator.hpp"
+#include "Upscaler.hpp"
+#include <vector>
 
 class Chip8_SDL : public Chip8{
     public:
-        Chip8_SDL(std::string romFilename, int scale);
+        Chip8_SDL(std::string romFilename, int scale, Upscaler::Filter filter = Upscaler::Filter::NONE);
         ~Chip8_SDL();
 
     private:
     //DATA
-        SDL_Window* window;
-        SDL_Renderer* renderer;
-        SDL_Rect rect;
+        //First, so that SDL is up before the window and down after it
+        SDLContext sdl;
+        SDL_Window* window = NULL;
+        SDL_Renderer* renderer = NULL;
+
+        //The upscaled frame, stretched to the window by the renderer
+        SDL_Texture* texture = NULL;
+        Upscaler upscaler;
+        std::uint32_t foreground = 0;
+        std::uint32_t background = 0;
+        std::uint32_t secondColor = 0;
+        std::uint32_t blendColor = 0;
+
+        //Metrics overlay, one rectangle per lit pixel
+        std::vector<SDL_Rect> overlayRects;
 
         //For audio
-        bool audioSuccess = false;
-        SDL_AudioDeviceID audioDevice;
-        SDL_AudioSpec beepSpec;
-        std::uint32_t beepLength;
-        std::uint8_t* beepBuf;
+        SDL_AudioDeviceID audioDevice = 0;
+        ToneGenerator tone;
 
 
     //METHODS
-        //Helper method used in handleInput
-        void handleKeyEvent(SDL_Event e);
+        //Helper methods used in handleInput
+        void handleEvent(const SDL_Event& e);
+        void handleKeyEvent(const SDL_Event& e);
+
+        //Draws the metrics over the top left corner of the frame
+        void drawOverlay(const Metrics& metrics);
+
+        //Fills SDL's audio buffer with the tone
+        static void audioCallback(void* userdata, Uint8* stream, int len);
 
         //Overridden I/O methods
         void handleInput() override;
-        void playSound() override;
-        void draw(const std::array<bool, DISPLAY_WIDTH*DISPLAY_HEIGHT>& screen) override; 
+        void setTone(bool on) override;
+        void setTonePattern(const std::uint8_t* pattern, float rate) override;
+        void wakeUp() override;
+        void draw(const Chip8Screen& screen) override;
 };
\ No newline at end of file
@@ -1,8 +1,41 @@
 #include "Chip8_SFML.hpp"
-#include "../assets/beep.h"
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <thread>
 
-Chip8_SFML::Chip8_SFML(std::string romFilename, int resolutionScale)
-: Chip8{romFilename, resolutionScale}
+namespace{
+    /*
+    Chip8 Key   Keyboard
+    ---------   ---------
+     1 2 3 C     1 2 3 4
+     4 5 6 D     q w e r
+     7 8 9 E     a s d f
+     A 0 B F     z x c v
+     */
+    std::array<std::int8_t, sf::Keyboard::KeyCount> makeKeyTable(){
+        std::array<std::int8_t, sf::Keyboard::KeyCount> table;
+        const sf::Keyboard::Key keyboard[] = {
+            sf::Keyboard::Num1, sf::Keyboard::Num2, sf::Keyboard::Num3, sf::Keyboard::Num4,
+            sf::Keyboard::Q, sf::Keyboard::W, sf::Keyboard::E, sf::Keyboard::R,
+            sf::Keyboard::A, sf::Keyboard::S, sf::Keyboard::D, sf::Keyboard::F,
+            sf::Keyboard::Z, sf::Keyboard::X, sf::Keyboard::C, sf::Keyboard::V};
+        const std::int8_t chip8[] = {0x1, 0x2, 0x3, 0xC, 0x4, 0x5, 0x6, 0xD, 0x7, 0x8, 0x9, 0xE, 0xA, 0x0, 0xB, 0xF};
+
+        table.fill(-1);
+        for(int i = 0; i < 16; i++){
+            table[keyboard[i]] = chip8[i];
+        }
+
+        return table;
+    }
+}
+
+//Chip8 key for each SFML key, -1 if none
+const std::array<std::int8_t, sf::Keyboard::KeyCount> Chip8_SFML::keyTable = makeKeyTable();
+
+Chip8_SFML::Chip8_SFML(std::string romFilename, int resolutionScale, Upscaler::Filter filter)
+: Chip8{romFilename, resolutionScale}, upscaler{filter, 0, 0}
 {
     //Calculate window size and position.
     int scale = getScale();
@@ -10,25 +43,63 @@ Chip8_SFML::Chip8_SFML(std::string romFilename, int resolutionScale)
     sf::VideoMode desktop{sf::VideoMode::getDesktopMode()};
     sf::Vector2i center{static_cast<int>(desktop.width) / 2 - windowSize.x / 2, static_cast<int>(desktop.height) / 2 - windowSize.y / 2};
 
-    //1 bit per pixel. Chip8 is monochrome.
-    window.create(sf::VideoMode{static_cast<unsigned>(windowSize.x), static_cast<unsigned>(windowSize.y), 1}, "Chip8");
+    //Chip8 is monochrome, but the two colors can be anything
+    window.create(sf::VideoMode{static_cast<unsigned>(windowSize.x), static_cast<unsigned>(windowSize.y)}, "Chip8");
 
     //Center the window
     window.setPosition(center);
 
-    //Initialize rectangle
-    rect.setFillColor(sf::Color{sf::Color::White});
-    rect.setSize(sf::Vector2f{static_cast<float>(scale), static_cast<float>(scale)});
+    //Held keys would repeat, but the game only needs to hear about the first press, like with SDL
+    window.setKeyRepeatEnabled(false);
+
+    //Initialize the texture, rewritten every frame and stretched to the window.
+    //Big enough for the SUPER-CHIP resolution, a 64x32 frame only uses its top left corner,
+    //so switching resolution changes nothing but the part the sprite shows.
+    int factor = upscaler.factor();
+    texture.create(Chip8Screen::HIRES_WIDTH * factor, Chip8Screen::HIRES_HEIGHT * factor);
+    pixels.resize(Chip8Screen::HIRES_WIDTH * factor * Chip8Screen::HIRES_HEIGHT * factor);
+    sprite.setTexture(texture, true);
+    showResolution(DISPLAY_WIDTH, DISPLAY_HEIGHT);
 
-    //Load sounds
-    beepBuffer.loadFromMemory(beepData.data(), beepData.size());
-    beep.setBuffer(beepBuffer);
+    //The tone stream plays all the time, silent while the tone is off
+    toneStream.play();
+}
+
+Chip8_SFML::~Chip8_SFML(){
+    toneStream.stop();
+}
+
+
+//SFML streams sound from a thread of its own, asking for a chunk at a time
+Chip8_SFML::ToneStream::ToneStream(){
+    initialize(1, 48000);
+}
+
+Chip8_SFML::ToneStream::~ToneStream(){
+    //Stop the thread before the generator and the buffer go away
+    stop();
+}
+
+bool Chip8_SFML::ToneStream::onGetData(Chunk& data){
+    tone.generate(buffer.data(), buffer.size());
+    data.samples = buffer.data();
+    data.sampleCount = buffer.size();
+    return true;
+}
+
+void Chip8_SFML::ToneStream::onSeek(sf::Time){
 }
 
 
 void Chip8_SFML::handleInput(){
     sf::Event buf;
 
+    //SFML can't wait for an event with a timeout,
+    //so while the game waits for input, nap between polls instead
+    if(idle()){
+        std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+
     while(window.pollEvent(buf)){
         if(buf.type == sf::Event::KeyPressed || buf.type == sf::Event::KeyReleased){
             handleKeyEvent(buf);
@@ -39,198 +110,126 @@ void Chip8_SFML::handleInput(){
     }
 }
 
-void Chip8_SFML::playSound(){
-    beep.play();
+void Chip8_SFML::setTone(bool on){
+    toneStream.tone.setOn(on);
 }
 
+void Chip8_SFML::setTonePattern(const std::uint8_t* pattern, float rate){
+    toneStream.tone.setPattern(pattern, rate);
+}
 
-void Chip8_SFML::draw(const std::array<bool, Chip8::DISPLAY_WIDTH * Chip8::DISPLAY_HEIGHT>& screen){
-    int scale = getScale();
-    window.clear();
 
-    //For each coordinate
-    for(int y = 0; y < Chip8::DISPLAY_HEIGHT; y++){
-        for(int x = 0; x < Chip8::DISPLAY_WIDTH; x++){
+void Chip8_SFML::showResolution(int width, int height){
+    const int factor = upscaler.factor();
+    const float stretch = static_cast<float>(getScale()) * DISPLAY_WIDTH / width / factor;
 
-            //If pixel is turned on, draw it
-            if(screen[(y * Chip8::DISPLAY_WIDTH) + x]){
-                rect.setPosition(x * scale, y * scale);
-                window.draw(rect);
-            }
+    sprite.setTextureRect(sf::IntRect{0, 0, width * factor, height * factor});
+    sprite.setScale(stretch, stretch);
+    shownWidth = width;
+}
 
-        }
+void Chip8_SFML::draw(const Chip8Screen& screen){
+    //SFML textures are RGBA bytes, colors are 0xRRGGBB
+    auto toRGBA = [](std::uint32_t color){
+        const std::uint8_t bytes[4] = {static_cast<std::uint8_t>(color >> 16), static_cast<std::uint8_t>(color >> 8),
+                                       static_cast<std::uint8_t>(color), 0xFF};
+        std::uint32_t pixel;
+        std::memcpy(&pixel, bytes, sizeof(pixel));
+        return pixel;
+    };
+
+    if(std::uint32_t fg = toRGBA(getForeground()), bg = toRGBA(getBackground());
+       fg != foreground || bg != background){
+        foreground = fg;
+        background = bg;
+        upscaler.setColors(foreground, background);
+    }
+
+    if(std::uint32_t second = toRGBA(getSecondColor()), blend = toRGBA(getBlendColor());
+       second != secondColor || blend != blendColor){
+        secondColor = second;
+        blendColor = blend;
+        upscaler.setPlaneColors(secondColor, blendColor);
+    }
+
+    if(screen.width() != shownWidth){
+        showResolution(screen.width(), screen.height());
+    }
+
+    //The screen is already packed, upscale it and upload the part in use
+    const int factor = upscaler.factor();
+    const int width = screen.width() * factor;
+    if(screen.usesSecondPlane())
+        upscaler.upscale(screen.planes[0], screen.planes[1], screen.wordsPerRow(), screen.height(), pixels.data(), width * sizeof(std::uint32_t));
+    else
+        upscaler.upscale(screen.planes[0], screen.wordsPerRow(), screen.height(), pixels.data(), width * sizeof(std::uint32_t));
+    texture.update(reinterpret_cast<const sf::Uint8*>(pixels.data()), width, screen.height() * factor, 0, 0);
+
+    window.clear();
+    window.draw(sprite);
+
+    if(const Metrics* metrics = getOverlay()){
+        drawOverlay(*metrics);
     }
 
     window.display();
 }
 
+void Chip8_SFML::drawOverlay(const Metrics& metrics){
+    //An overlay pixel is a fifth of a Chip8 pixel, so the text is readable at any scale
+    const float size = std::max(1, getScale() / 5);
+    const sf::Color yellow{255, 255, 0};
+
+    overlayBox.setSize({Metrics::OVERLAY_WIDTH * size, Metrics::OVERLAY_HEIGHT * size});
+    overlayBox.setFillColor(sf::Color{0, 0, 0, 160});
+
+    overlayQuads.clear();
+    for(Metrics::Point p : metrics.overlay()){
+        const float x = p.x * size, y = p.y * size;
+        overlayQuads.append({{x, y}, yellow});
+        overlayQuads.append({{x + size, y}, yellow});
+        overlayQuads.append({{x + size, y + size}, yellow});
+        overlayQuads.append({{x, y + size}, yellow});
+    }
 
-void Chip8_SFML::handleKeyEvent(sf::Event e){
-    /*
-    Chip8 Key   Keyboard
-    ---------   ---------
-     1 2 3 C     1 2 3 4
-     4 5 6 D     q w e r
-     7 8 9 E     a s d f
-     A 0 B F     z x c v
-     */
+    window.draw(overlayBox);
+    window.draw(overlayQuads);
+}
 
-    switch(e.type){
-        //Key Pressed
-        case sf::Event::KeyPressed:
-            switch(e.key.code){
-                //ESC - Quit
-                case sf::Keyboard::Escape:
-                    stop();
-                break;
-
-                //Pause
-                case sf::Keyboard::Pause:
-                case sf::Keyboard::F1:
-                    togglePause();
-                break;
-
-                case sf::Keyboard::Num1:
-                    pressKey(1);
-                break;
-
-                case sf::Keyboard::Num2:
-                    pressKey(2);
-                break;
-
-                case sf::Keyboard::Num3:
-                    pressKey(3);
-                break;
-
-                case sf::Keyboard::Num4:
-                    pressKey(0xC);
-                break;
-
-                case sf::Keyboard::Q:
-                    pressKey(4);
-                break;
-
-                case sf::Keyboard::W:
-                    pressKey(5);
-                break;
-
-                case sf::Keyboard::E:
-                    pressKey(6);
-                break;
-
-                case sf::Keyboard::R:
-                    pressKey(0xD);
-                break;
-
-                case sf::Keyboard::A:
-                    pressKey(7);
-                break;
-
-                case sf::Keyboard::S:
-                    pressKey(8);
-                break;
-
-                case sf::Keyboard::D:
-                    pressKey(9);
-                break;
-
-                case sf::Keyboard::F:
-                    pressKey(0xE);
-                break;
-
-                case sf::Keyboard::Z:
-                    pressKey(0xA);
-                break;
-
-                case sf::Keyboard::X:
-                    pressKey(0);
-                break;
-
-                case sf::Keyboard::C:
-                    pressKey(0xB);
-                break;
-
-                case sf::Keyboard::V:
-                    pressKey(0xF);
-                break;
-
-                default:
-                break;
-            }
-        break;
-
-        case sf::Event::KeyReleased:
-            switch(e.key.code){
-                case sf::Keyboard::Num1:
-                    releaseKey(1);
-                break;
-
-                case sf::Keyboard::Num2:
-                    releaseKey(2);
-                break;
-
-                case sf::Keyboard::Num3:
-                    releaseKey(3);
-                break;
-
-                case sf::Keyboard::Num4:
-                    releaseKey(0xC);
-                break;
-
-                case sf::Keyboard::Q:
-                    releaseKey(4);
-                break;
-
-                case sf::Keyboard::W:
-                    releaseKey(5);
-                break;
-
-                case sf::Keyboard::E:
-                    releaseKey(6);
-                break;
-
-                case sf::Keyboard::R:
-                    releaseKey(0xD);
-                break;
-
-                case sf::Keyboard::A:
-                    releaseKey(7);
-                break;
-
-                case sf::Keyboard::S:
-                    releaseKey(8);
-                break;
-
-                case sf::Keyboard::D:
-                    releaseKey(9);
-                break;
-
-                case sf::Keyboard::F:
-                    releaseKey(0xE);
-                break;
-
-                case sf::Keyboard::Z:
-                    releaseKey(0xA);
-                break;
-
-                case sf::Keyboard::X:
-                    releaseKey(0);
-                break;
-
-                case sf::Keyboard::C:
-                    releaseKey(0xB);
-                break;
-
-                case sf::Keyboard::V:
-                    releaseKey(0xF);
-                break;
-
-                default:
-                break;
-            }
-        break; 
 
-        default:
-        break;
+void Chip8_SFML::handleKeyEvent(sf::Event e){
+    sf::Keyboard::Key code = e.key.code;
+    int key = code >= 0 && code < sf::Keyboard::KeyCount ? keyTable[code] : -1;
+
+    //Chip8 keys
+    if(key >= 0){
+        if(e.type == sf::Event::KeyPressed){
+            pressKey(key);
+        }
+        else{
+            releaseKey(key);
+        }
     }
-}
\ No newline at end of file
+    else if(e.type == sf::Event::KeyPressed){
+        switch(code){
+            //ESC - Quit
+            case sf::Keyboard::Escape:
+                stop();
+            break;
+
+            //Pause
+            case sf::Keyboard::Pause:
+            case sf::Keyboard::F1:
+                togglePause();
+            break;
+
+            //Debugger
+            case sf::Keyboard::F2:
+                breakIntoDebugger();
+            break;
+
+            default:
+            break;
+        }
+    }
+}
@@ -2,24 +2,66 @@
 #include <SFML/Graphics.hpp>
 #include <SFML/Audio.hpp>
 #include "Chip8.hpp"
+#include "ToneGenerator.hpp"
+#include "Upscaler.hpp"
+#include <vector>
 
 class Chip8_SFML : public Chip8{
     public:
-        Chip8_SFML(std::string romFilename, int scale);
+        Chip8_SFML(std::string romFilename, int scale, Upscaler::Filter filter = Upscaler::Filter::NONE);
+        ~Chip8_SFML();
 
     private:
     //DATA
         sf::RenderWindow window;
-        sf::RectangleShape rect;
-        sf::SoundBuffer beepBuffer;
-        sf::Sound beep;
+
+        //The upscaled frame, stretched to the window by the sprite
+        sf::Texture texture;
+        sf::Sprite sprite;
+        Upscaler upscaler;
+        std::vector<std::uint32_t> pixels;
+        int shownWidth = 0;     //Of the screen, the sprite shows that much of the texture
+        std::uint32_t foreground = 0;
+        std::uint32_t background = 0;
+        std::uint32_t secondColor = 0;
+        std::uint32_t blendColor = 0;
+
+        //Metrics overlay, a translucent box and a quad per lit pixel
+        sf::RectangleShape overlayBox;
+        sf::VertexArray overlayQuads{sf::Quads};
+
+        //Plays the tone made by a ToneGenerator
+        class ToneStream : public sf::SoundStream{
+            public:
+                ToneStream();
+                ~ToneStream();
+                ToneGenerator tone;
+
+            private:
+                //512 samples, about 10ms of sound per chunk
+                std::array<std::int16_t, 512> buffer;
+
+                bool onGetData(Chunk& data) override;
+                void onSeek(sf::Time) override;
+        };
+        ToneStream toneStream;
 
     //METHODS
         //Helper method used in handleInput
         void handleKeyEvent(sf::Event e);
 
+        //Stretch the part of the texture a width by height screen is upscaled into to the window
+        void showResolution(int width, int height);
+
+        //Draws the metrics over the top left corner of the frame
+        void drawOverlay(const Metrics& metrics);
+
+        //Chip8 key for each SFML key, -1 if none
+        static const std::array<std::int8_t, sf::Keyboard::KeyCount> keyTable;
+
         //Overridden I/O methods
         void handleInput() override;
-        void playSound() override;
-        void draw(const std::array<bool, DISPLAY_WIDTH*DISPLAY_HEIGHT>& screen) override; 
+        void setTone(bool on) override;
+        void setTonePattern(const std::uint8_t* pattern, float rate) override;
+        void draw(const Chip8Screen& screen) override;
 };
\ No newline at end of file
@@ -0,0 +1,390 @@
+#include "FrameStream.hpp"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+namespace{
+    constexpr char magic[8] = {'C', 'P', 'P', '8', 'F', 'R', 'M', '1'};
+    constexpr char indexMagic[8] = {'C', 'P', 'P', '8', 'I', 'D', 'X', '1'};
+    constexpr std::size_t headerSize = 16;
+
+    enum RecordType : std::uint8_t{ KEYFRAME, DELTA };
+
+    //Little endian integers, whatever the host
+    template<typename T>
+    void putLE(std::uint8_t* out, T value){
+        for(std::size_t i = 0; i < sizeof(T); i++){
+            out[i] = static_cast<std::uint8_t>(value >> (8 * i));
+        }
+    }
+
+    template<typename T>
+    T getLE(const std::uint8_t* in){
+        T value = 0;
+        for(std::size_t i = 0; i < sizeof(T); i++){
+            value |= static_cast<T>(in[i]) << (8 * i);
+        }
+        return value;
+    }
+
+    void appendVarint(std::vector<std::uint8_t>& out, std::uint64_t value){
+        while(value >= 0x80){
+            out.push_back(static_cast<std::uint8_t>(value) | 0x80);
+            value >>= 7;
+        }
+        out.push_back(static_cast<std::uint8_t>(value));
+    }
+
+    //Payload runs from a varint at data[at], false if it runs past size
+    bool parseVarint(const std::uint8_t* data, std::size_t size, std::size_t& at, std::uint64_t& value){
+        value = 0;
+        for(int shift = 0; at < size && shift < 64; shift += 7){
+            std::uint8_t byte = data[at++];
+            value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+
+            if(!(byte & 0x80)){
+                return true;
+            }
+        }
+        return false;
+    }
+}
+
+FrameRecorder::FrameRecorder(const std::string& path, int width, int height, int keyframeInterval)
+: file{path, std::ios::binary | std::ios::trunc}, width{width}, height{height},
+  keyframeInterval{std::max(keyframeInterval, 1)}
+{
+    const std::size_t frameBytes = static_cast<std::size_t>((width + 7) / 8) * height;
+    previous.assign(frameBytes, 0);
+    current.assign(frameBytes, 0);
+
+    if(!file){
+        std::cerr << "Could not create frame stream \"" << path << "\"\n";
+        return;
+    }
+
+    std::uint8_t header[headerSize];
+    std::memcpy(header, magic, sizeof(magic));
+    putLE<std::uint16_t>(header + 8, static_cast<std::uint16_t>(width));
+    putLE<std::uint16_t>(header + 10, static_cast<std::uint16_t>(height));
+    putLE<std::uint32_t>(header + 12, static_cast<std::uint32_t>(this->keyframeInterval));
+    write(header, sizeof(header));
+}
+
+FrameRecorder::~FrameRecorder(){
+    finish();
+}
+
+bool FrameRecorder::ok() const{
+    return file.is_open() && file.good();
+}
+
+void FrameRecorder::record(const bool* pixels){
+    if(!ok()){
+        return;
+    }
+
+    const int rowBytes = (width + 7) / 8;
+    std::fill(current.begin(), current.end(), 0);
+    for(int y = 0; y < height; y++){
+        for(int x = 0; x < width; x++){
+            current[y * rowBytes + x / 8] |= pixels[y * width + x] << (7 - x % 8);
+        }
+    }
+
+    //The same as the last one: the next record will say how long it lasted
+    if(records && current == previous){
+        frames++;
+        return;
+    }
+
+    const bool keyframe = records == 0 || frames - lastKeyframe >= static_cast<std::uint64_t>(keyframeInterval);
+
+    //Runs of unchanged and changed bytes of the XOR with the base frame
+    payload.clear();
+    const std::size_t size = current.size();
+    std::size_t at = 0;
+    while(at < size){
+        std::size_t unchanged = at;
+        while(unchanged < size && current[unchanged] == (keyframe ? 0 : previous[unchanged])){
+            unchanged++;
+        }
+        if(unchanged == size){
+            break;
+        }
+
+        std::size_t changed = unchanged;
+        while(changed < size && current[changed] != (keyframe ? 0 : previous[changed])){
+            changed++;
+        }
+
+        appendVarint(payload, unchanged - at);
+        appendVarint(payload, changed - unchanged);
+        for(std::size_t i = unchanged; i < changed; i++){
+            payload.push_back(current[i] ^ (keyframe ? 0 : previous[i]));
+        }
+
+        at = changed;
+    }
+
+    std::vector<std::uint8_t> head{static_cast<std::uint8_t>(keyframe ? KEYFRAME : DELTA)};
+    appendVarint(head, keyframe ? frames : frames - lastRecordFrame);
+    appendVarint(head, payload.size());
+
+    if(keyframe){
+        keyframes.push_back({frames, offset});
+        lastKeyframe = frames;
+    }
+
+    write(head.data(), head.size());
+    write(payload.data(), payload.size());
+
+    previous.swap(current);
+    lastRecordFrame = frames;
+    records++;
+    frames++;
+}
+
+void FrameRecorder::finish(){
+    if(!ok()){
+        return;
+    }
+
+    const std::uint64_t indexOffset = offset;
+    std::vector<std::uint8_t> index(8 + 16 + keyframes.size() * 16 + 8);
+
+    std::memcpy(index.data(), indexMagic, sizeof(indexMagic));
+    putLE<std::uint64_t>(&index[8], frames);
+    putLE<std::uint64_t>(&index[16], keyframes.size());
+    for(std::size_t i = 0; i < keyframes.size(); i++){
+        putLE<std::uint64_t>(&index[24 + i * 16], keyframes[i].first);
+        putLE<std::uint64_t>(&index[32 + i * 16], keyframes[i].second);
+    }
+    putLE<std::uint64_t>(&index[index.size() - 8], indexOffset);
+
+    write(index.data(), index.size());
+    file.close();
+}
+
+std::uint64_t FrameRecorder::frameCount() const{
+    return frames;
+}
+
+std::uint64_t FrameRecorder::recordCount() const{
+    return records;
+}
+
+void FrameRecorder::write(const void* data, std::size_t size){
+    file.write(static_cast<const char*>(data), size);
+    offset += size;
+}
+
+
+
+FrameReader::FrameReader(const std::string& path) : file{path, std::ios::binary}{
+    std::uint8_t header[headerSize];
+
+    if(!file || !file.read(reinterpret_cast<char*>(header), sizeof(header))
+       || std::memcmp(header, magic, sizeof(magic)) != 0){
+        std::cerr << "Could not read frame stream \"" << path << "\"\n";
+        return;
+    }
+
+    w = getLE<std::uint16_t>(header + 8);
+    h = getLE<std::uint16_t>(header + 10);
+    screen.assign(static_cast<std::size_t>(rowBytes()) * h, 0);
+    valid = true;
+
+    //The index, if the recorder got to write it
+    file.seekg(0, std::ios::end);
+    const std::uint64_t size = file.tellg();
+    std::uint8_t tail[8];
+    std::uint8_t head[24];
+
+    if(size >= headerSize + 32 && file.seekg(size - 8) && file.read(reinterpret_cast<char*>(tail), 8)){
+        const std::uint64_t indexOffset = getLE<std::uint64_t>(tail);
+
+        if(indexOffset >= headerSize && indexOffset + 32 <= size && file.seekg(indexOffset)
+           && file.read(reinterpret_cast<char*>(head), sizeof(head))
+           && std::memcmp(head, indexMagic, sizeof(indexMagic)) == 0){
+            const std::uint64_t count = getLE<std::uint64_t>(head + 16);
+
+            if(indexOffset + 32 + count * 16 == size){
+                std::vector<std::uint8_t> entries(count * 16);
+                file.read(reinterpret_cast<char*>(entries.data()), entries.size());
+
+                for(std::uint64_t i = 0; i < count; i++){
+                    keyframes.push_back({getLE<std::uint64_t>(&entries[i * 16]), getLE<std::uint64_t>(&entries[i * 16 + 8])});
+                }
+
+                frames = getLE<std::uint64_t>(head + 8);
+                recordsEnd = indexOffset;
+            }
+        }
+    }
+
+    file.clear();
+
+    if(recordsEnd == 0){
+        scan();
+    }
+
+    position = headerSize;
+}
+
+bool FrameReader::ok() const{
+    return valid;
+}
+
+int FrameReader::width() const{
+    return w;
+}
+
+int FrameReader::height() const{
+    return h;
+}
+
+int FrameReader::rowBytes() const{
+    return (w + 7) / 8;
+}
+
+std::uint64_t FrameReader::frameCount() const{
+    return frames;
+}
+
+std::size_t FrameReader::keyframeCount() const{
+    return keyframes.size();
+}
+
+bool FrameReader::next(std::uint64_t& frame, std::vector<std::uint8_t>& packed){
+    if(pending){
+        pending = false;
+    }
+    else if(!readRecord(lastFrame)){
+        return false;
+    }
+
+    frame = lastFrame;
+    packed = screen;
+    return true;
+}
+
+bool FrameReader::seek(std::uint64_t n){
+    auto after = std::upper_bound(keyframes.begin(), keyframes.end(), std::make_pair(n, UINT64_MAX));
+    if(!valid || after == keyframes.begin() || n >= frames){
+        return false;
+    }
+
+    //Decode from the keyframe up to the last record starting at or before n
+    position = std::prev(after)->second;
+    std::uint64_t frame = 0;
+    if(!readRecord(frame)){
+        return false;
+    }
+
+    for(;;){
+        const std::uint64_t before = position;
+        const std::vector<std::uint8_t> shown = screen;
+        std::uint64_t following = frame;
+
+        if(!readRecord(following) || following > n){
+            position = before;
+            screen = shown;
+            break;
+        }
+
+        frame = following;
+    }
+
+    lastFrame = frame;
+    pending = true;
+    return true;
+}
+
+bool FrameReader::pixel(const std::vector<std::uint8_t>& packed, int x, int y) const{
+    return (packed[y * rowBytes() + x / 8] >> (7 - x % 8)) & 1;
+}
+
+bool FrameReader::readRecord(std::uint64_t& frame, bool* keyframe){
+    if(position >= recordsEnd){
+        return false;
+    }
+
+    file.clear();
+    file.seekg(position);
+
+    std::uint64_t number = 0, size = 0;
+    const int type = file.get();
+    if(type == std::char_traits<char>::eof() || !readVarint(number) || !readVarint(size) || size > screen.size() * 3){
+        return false;
+    }
+
+    payload.resize(size);
+    if(!file.read(reinterpret_cast<char*>(payload.data()), size)){
+        return false;
+    }
+
+    if(keyframe){
+        *keyframe = type == KEYFRAME;
+    }
+
+    if(type == KEYFRAME){
+        std::fill(screen.begin(), screen.end(), 0);
+        frame = number;
+    }
+    else{
+        frame += number;
+    }
+
+    //Apply the runs, ignoring any that would go past the frame
+    std::size_t at = 0, out = 0;
+    std::uint64_t unchanged, changed;
+    while(at < payload.size() && parseVarint(payload.data(), payload.size(), at, unchanged)
+          && parseVarint(payload.data(), payload.size(), at, changed)){
+        out += unchanged;
+        for(std::uint64_t i = 0; i < changed && at < payload.size() && out < screen.size(); i++){
+            screen[out++] ^= payload[at++];
+        }
+    }
+
+    position = file.tellg();
+    return true;
+}
+
+bool FrameReader::readVarint(std::uint64_t& value){
+    value = 0;
+    for(int shift = 0; shift < 64; shift += 7){
+        const int byte = file.get();
+        if(byte == std::char_traits<char>::eof()){
+            return false;
+        }
+
+        value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+        if(!(byte & 0x80)){
+            return true;
+        }
+    }
+    return false;
+}
+
+void FrameReader::scan(){
+    recordsEnd = UINT64_MAX;
+    position = headerSize;
+
+    std::uint64_t frame = 0, end = position;
+    bool keyframe = false, any = false;
+
+    //Up to the end, or to a record cut short when the run was killed
+    for(std::uint64_t start = position; readRecord(frame, &keyframe); start = position){
+        if(keyframe){
+            keyframes.push_back({frame, start});
+        }
+
+        end = position;
+        any = true;
+    }
+
+    recordsEnd = end;
+    frames = any ? frame + 1 : 0;
+    std::fill(screen.begin(), screen.end(), 0);
+}
@@ -0,0 +1,118 @@
+#pragma once
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+//Recordings of every 60hz frame of a run, compact enough for long batch runs.
+//
+//Frames are packed at 1 bit per pixel, rows padded to whole bytes, the leftmost
+//pixel in the highest bit. A frame identical to the one before it is not written
+//at all, the next record says how many frames it lasted. The others are XORed
+//with the frame before them, or with a blank frame every keyframeInterval frames,
+//and only the runs of changed bytes are kept.
+//
+//File layout, integers little endian, "varint" being LEB128:
+//  header      "CPP8FRM1", width (u16), height (u16), keyframe interval (u32)
+//  records     type (u8): 0 keyframe, 1 delta
+//              keyframes: the frame number (varint), deltas: frames since the last record (varint)
+//              payload size (varint), then the payload: runs of unchanged bytes (varint),
+//              changed bytes (varint) and those XORed bytes, up to the end of the payload.
+//              Bytes past the last run are unchanged.
+//  index       "CPP8IDX1", frame count (u64), keyframe count (u64),
+//              frame number and file offset (u64 each) of every keyframe,
+//              and last the offset of the index itself (u64)
+//
+//The index is written when the recorder finishes. A stream without one,
+//from a run that was killed, can still be read: the reader scans the records.
+class FrameRecorder{
+    public:
+        //Create the file. If it can't be created, an error is printed and nothing is recorded.
+        FrameRecorder(const std::string& path, int width, int height, int keyframeInterval = 600);
+        ~FrameRecorder();
+
+        FrameRecorder(const FrameRecorder&) = delete;
+        FrameRecorder& operator=(const FrameRecorder&) = delete;
+
+        bool ok() const;
+
+        //Append the next frame, width * height pixels row by row. Once per 60hz frame.
+        void record(const bool* pixels);
+
+        //Write the index and close the file. Called by the destructor.
+        void finish();
+
+        std::uint64_t frameCount() const;
+        std::uint64_t recordCount() const;
+
+    private:
+        std::ofstream file;
+        int width;
+        int height;
+        int keyframeInterval;
+
+        std::vector<std::uint8_t> previous;
+        std::vector<std::uint8_t> current;
+        std::vector<std::uint8_t> payload;
+
+        std::uint64_t offset = 0;           //Bytes written so far
+        std::uint64_t frames = 0;
+        std::uint64_t records = 0;
+        std::uint64_t lastRecordFrame = 0;
+        std::uint64_t lastKeyframe = 0;
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> keyframes; //Frame number, offset
+
+        void write(const void* data, std::size_t size);
+};
+
+
+class FrameReader{
+    public:
+        //Check ok() to know if the file could be read
+        explicit FrameReader(const std::string& path);
+
+        bool ok() const;
+        int width() const;
+        int height() const;
+        int rowBytes() const;
+
+        //Frames recorded, counting the repeated ones
+        std::uint64_t frameCount() const;
+        std::size_t keyframeCount() const;
+
+        //Decode the next record: the frame it starts at, and its pixels packed like in the stream.
+        //It's shown until the frame the following record starts at, or frameCount().
+        //Returns false past the last record.
+        bool next(std::uint64_t& frame, std::vector<std::uint8_t>& packed);
+
+        //Make next() return the record showing frame n, decoding from the keyframe before it
+        bool seek(std::uint64_t n);
+
+        //Whether the pixel at x, y is lit in a packed frame
+        bool pixel(const std::vector<std::uint8_t>& packed, int x, int y) const;
+
+    private:
+        std::ifstream file;
+        bool valid = false;
+        int w = 0;
+        int h = 0;
+        std::uint64_t frames = 0;
+        std::uint64_t recordsEnd = 0;
+        std::vector<std::pair<std::uint64_t, std::uint64_t>> keyframes;
+
+        //Decoding state
+        std::vector<std::uint8_t> screen;
+        std::vector<std::uint8_t> payload;
+        std::uint64_t position = 0;
+        std::uint64_t lastFrame = 0;
+        bool pending = false;               //seek() decoded a record that next() hasn't returned yet
+
+        //Read the record at position into screen, false if there's none or it's cut short.
+        //frame is the one the previous record started at, and becomes the one this one starts at.
+        bool readRecord(std::uint64_t& frame, bool* keyframe = nullptr);
+        bool readVarint(std::uint64_t& value);
+
+        //Scan the records to rebuild the index of a stream that wasn't finished
+        void scan();
+};
@@ -0,0 +1,73 @@
+#pragma once
+#include <array>
+#include <cstdint>
+
+//Superinstructions: short instruction sequences common enough in games
+//to be executed by one handler, saving the fetch, decode and switch of all
+//but the first instruction.
+//
+//The set was picked by hand: a delay timer wait loop and pairs commonly seen
+//in game code, not measured on a corpus of games. cpp8-trace pairs counts the
+//back to back instruction pairs of traces, to pick more from real games.
+//To add a sequence, add its pattern here, in order of priority, and its case
+//in Chip8::fused().
+//
+//Chip8 looks for a pattern the first time an address is executed, and again
+//after any write near it, so code that modifies itself never runs a stale sequence.
+//Before running a sequence it checks the code still matches, for memory changed
+//from outside the interpreter.
+
+struct FusionPattern{
+    const char* name;
+    int length;                 //Instructions, 3 at most
+    std::uint16_t mask[3];
+    std::uint16_t value[3];
+    std::uint8_t sameX;         //Bit i set: instruction i uses the X register of the first.
+                                //Only for instructions with an X operand, in 1NNN it's the address.
+};
+
+enum FusionId : std::uint8_t{
+    NO_FUSION,
+    FUSE_WAIT_DELAY,    //FX07 3X00 1NNN    wait for the delay timer
+    FUSE_LOAD_LOAD,     //6XKK 6YKK         load two registers
+    FUSE_INDEX_DRAW,    //ANNN DXYN         point I at a sprite and draw it
+    FUSE_ADD_SKIP,      //7XKK 3XKK         loop counter
+    FUSE_ADD_LOAD,      //FX1E FY65         load registers from a table
+
+    UNKNOWN_FUSION = 0xFF,  //Not looked for yet
+};
+
+constexpr std::array<FusionPattern, 5> fusionPatterns{{
+    {"FX07 3X00 1NNN", 3, {0xF0FF, 0xF0FF, 0xF000}, {0xF007, 0x3000, 0x1000}, 0b011},
+    {"6XKK 6YKK",      2, {0xF000, 0xF000, 0},      {0x6000, 0x6000, 0},      0},
+    {"ANNN DXYN",      2, {0xF000, 0xF000, 0},      {0xA000, 0xD000, 0},      0},
+    {"7XKK 3XKK",      2, {0xF000, 0xF000, 0},      {0x7000, 0x3000, 0},      0b11},
+    {"FX1E FY65",      2, {0xF0FF, 0xF0FF, 0},      {0xF01E, 0xF065, 0},      0},
+}};
+
+//Whether the instructions at code, 2 bytes each, are the sequence id
+constexpr bool matchFusion(FusionId id, const std::uint8_t* code){
+    const FusionPattern& p = fusionPatterns[id - 1];
+
+    for(int i = 0; i < p.length; i++){
+        std::uint16_t op = (code[2 * i] << 8) | code[2 * i + 1];
+
+        if((op & p.mask[i]) != p.value[i] || (p.sameX >> i & 1 && (code[2 * i] & 0x0F) != (code[0] & 0x0F))){
+            return false;
+        }
+    }
+
+    return true;
+}
+
+//The first sequence found at code, NO_FUSION if none.
+//code must have 6 bytes, the longest sequence.
+constexpr FusionId findFusion(const std::uint8_t* code){
+    for(std::size_t id = 1; id <= fusionPatterns.size(); id++){
+        if(matchFusion(static_cast<FusionId>(id), code)){
+            return static_cast<FusionId>(id);
+        }
+    }
+
+    return NO_FUSION;
+}
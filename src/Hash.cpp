@@ -0,0 +1,96 @@
+#include "Hash.hpp"
+#include <cstring>
+
+//Constants and steps are the ones of the reference XXH64
+namespace{
+    constexpr std::uint64_t P1 = 0x9E3779B185EBCA87ULL;
+    constexpr std::uint64_t P2 = 0xC2B2AE3D27D4EB4FULL;
+    constexpr std::uint64_t P3 = 0x165667B19E3779F9ULL;
+    constexpr std::uint64_t P4 = 0x85EBCA77C2B2AE63ULL;
+    constexpr std::uint64_t P5 = 0x27D4EB2F165667C5ULL;
+
+    std::uint64_t rotl(std::uint64_t x, int r){
+        return (x << r) | (x >> (64 - r));
+    }
+
+    //Unaligned little endian reads
+    std::uint64_t read64(const std::uint8_t* p){
+        std::uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    std::uint32_t read32(const std::uint8_t* p){
+        std::uint32_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+
+    std::uint64_t round(std::uint64_t acc, std::uint64_t input){
+        acc += input * P2;
+        acc = rotl(acc, 31);
+        return acc * P1;
+    }
+
+    std::uint64_t mergeRound(std::uint64_t acc, std::uint64_t val){
+        acc ^= round(0, val);
+        return acc * P1 + P4;
+    }
+}
+
+std::uint64_t hash64(const void* data, std::size_t len, std::uint64_t seed){
+    const std::uint8_t* p = static_cast<const std::uint8_t*>(data);
+    const std::uint8_t* end = p + len;
+    std::uint64_t h;
+
+    //Four accumulators over 32 byte stripes
+    if(len >= 32){
+        std::uint64_t v1 = seed + P1 + P2;
+        std::uint64_t v2 = seed + P2;
+        std::uint64_t v3 = seed;
+        std::uint64_t v4 = seed - P1;
+
+        for(; p + 32 <= end; p += 32){
+            v1 = round(v1, read64(p));
+            v2 = round(v2, read64(p + 8));
+            v3 = round(v3, read64(p + 16));
+            v4 = round(v4, read64(p + 24));
+        }
+
+        h = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+        h = mergeRound(h, v1);
+        h = mergeRound(h, v2);
+        h = mergeRound(h, v3);
+        h = mergeRound(h, v4);
+    }
+    else{
+        h = seed + P5;
+    }
+
+    h += len;
+
+    //Tail
+    for(; p + 8 <= end; p += 8){
+        h ^= round(0, read64(p));
+        h = rotl(h, 27) * P1 + P4;
+    }
+
+    if(p + 4 <= end){
+        h ^= read32(p) * P1;
+        h = rotl(h, 23) * P2 + P3;
+        p += 4;
+    }
+
+    for(; p < end; p++){
+        h ^= *p * P5;
+        h = rotl(h, 11) * P1;
+    }
+
+    //Avalanche
+    h ^= h >> 33;
+    h *= P2;
+    h ^= h >> 29;
+    h *= P3;
+    h ^= h >> 32;
+    return h;
+}
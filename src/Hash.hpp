@@ -0,0 +1,7 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+//64-bit xxHash (XXH64) of len bytes starting at data.
+//Fast and with good distribution, used to identify ROMs and machine states.
+std::uint64_t hash64(const void* data, std::size_t len, std::uint64_t seed = 0);
@@ -0,0 +1,37 @@
+#include "LatencyProbe.hpp"
+#include <algorithm>
+#include <cstdio>
+
+void LatencyProbe::record(std::chrono::nanoseconds latency){
+    samples.push_back(std::chrono::duration<double, std::milli>(latency).count());
+}
+
+LatencyProbe::Summary LatencyProbe::summary() const{
+    Summary s;
+    std::vector<double> sorted{samples};
+    std::sort(sorted.begin(), sorted.end());
+
+    if(!sorted.empty()){
+        //Nearest rank
+        auto percentile = [&sorted](double p){
+            std::size_t rank = static_cast<std::size_t>(p * sorted.size() + 0.999999);
+            return sorted[std::clamp<std::size_t>(rank, 1, sorted.size()) - 1];
+        };
+
+        s.count = sorted.size();
+        s.p50 = percentile(0.50);
+        s.p90 = percentile(0.90);
+        s.p99 = percentile(0.99);
+        s.max = sorted.back();
+    }
+
+    return s;
+}
+
+void LatencyProbe::print(std::ostream& out) const{
+    Summary s = summary();
+    char line[128];
+    std::snprintf(line, sizeof(line), "latency count=%zu p50=%.2f p90=%.2f p99=%.2f max=%.2f\n",
+                  s.count, s.p50, s.p90, s.p99, s.max);
+    out << line;
+}
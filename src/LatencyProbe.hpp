@@ -0,0 +1,32 @@
+#pragma once
+#include <chrono>
+#include <cstddef>
+#include <ostream>
+#include <vector>
+
+//Input to photon latency: the time from a key press to the first frame
+//that shows a change being handed to the display.
+//Chip8 stamps each key press, carries the stamp along with the first frame
+//that differs from the screen at the time of the press, and the thread
+//drawing the frames records it here after draw() returns.
+class LatencyProbe{
+    public:
+        struct Summary{
+            std::size_t count = 0;
+            double p50 = 0; //Milliseconds
+            double p90 = 0;
+            double p99 = 0;
+            double max = 0;
+        };
+
+        //Only from the thread drawing the frames
+        void record(std::chrono::nanoseconds latency);
+
+        Summary summary() const;
+
+        //count=N p50=X p90=X p99=X max=X, in ms
+        void print(std::ostream& out) const;
+
+    private:
+        std::vector<double> samples;
+};
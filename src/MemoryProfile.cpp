@@ -0,0 +1,90 @@
+#include "MemoryProfile.hpp"
+#include <algorithm>
+#include <cmath>
+
+void MemoryProfile::fetch(std::uint16_t pc, std::uint16_t mask){
+    counts[pc & mask].executes++;
+    counts[(pc + 1) & mask].executes++;
+}
+
+void MemoryProfile::read(std::uint16_t address, int count, std::uint16_t mask){
+    for(int i = 0; i < count; i++){
+        counts[(address + i) & mask].reads++;
+    }
+}
+
+void MemoryProfile::write(std::uint16_t address, int count, std::uint16_t mask, std::uint16_t pc, std::uint64_t cycle){
+    for(int i = 0; i < count; i++){
+        std::uint16_t a = (address + i) & mask;
+        counts[a].writes++;
+
+        if(counts[a].executes){
+            modifyingWrites++;
+
+            if(!modified[a]){
+                modified[a] = true;
+                modifications.push_back({a, pc, cycle});
+            }
+        }
+    }
+}
+
+void MemoryProfile::clear(){
+    counts.fill(Counts{});
+    modified.fill(false);
+    modifications.clear();
+    modifyingWrites = 0;
+}
+
+const MemoryProfile::Counts& MemoryProfile::operator[](std::uint16_t address) const{
+    return counts[address & (SIZE - 1)];
+}
+
+const std::vector<MemoryProfile::SelfModification>& MemoryProfile::selfModifications() const{
+    return modifications;
+}
+
+std::uint64_t MemoryProfile::selfModifyingWrites() const{
+    return modifyingWrites;
+}
+
+void MemoryProfile::writeCsv(std::ostream& out) const{
+    out << "address,reads,writes,executes,self_modified\n";
+
+    for(int a = 0; a < SIZE; a++){
+        const Counts& c = counts[a];
+
+        if(c.reads || c.writes || c.executes){
+            out << a << ',' << c.reads << ',' << c.writes << ',' << c.executes << ',' << modified[a] << '\n';
+        }
+    }
+}
+
+void MemoryProfile::writeHeatmap(std::ostream& out) const{
+    std::uint32_t most = 1;
+    int used = 0;
+    for(int a = 0; a < SIZE; a++){
+        const Counts& c = counts[a];
+        most = std::max({most, c.reads, c.writes, c.executes});
+
+        if(c.reads || c.writes || c.executes){
+            used = a + 1;
+        }
+    }
+
+    //Whole rows of 64 addresses, at least the 4KB every program has
+    const int rows = std::max(64, (used + 63) / 64);
+
+    //Any access at all is at least a dim 64, the most frequent one is 255
+    const double range = std::log(static_cast<double>(most) + 1);
+    auto level = [range](std::uint32_t n){
+        return static_cast<char>(n ? 64 + static_cast<int>(191 * std::log(static_cast<double>(n) + 1) / range) : 0);
+    };
+
+    out << "P6\n64 " << rows << "\n255\n";
+    for(int a = 0; a < rows * 64; a++){
+        const Counts& c = counts[a];
+        const char pixel[3] = {level(c.writes), level(c.reads), level(c.executes)};
+        out.write(pixel, 3);
+    }
+}
@@ -0,0 +1,62 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <ostream>
+#include <vector>
+
+//Per address counts of the instruction fetches, reads and writes of a run,
+//and the writes to addresses that had already been executed: self-modifying code.
+//A ROM that never modifies its own code is safe to cache or translate ahead of time.
+//Chip8 only counts when built with the CPP8_MEMPROFILE option, otherwise the hooks compile to nothing.
+class MemoryProfile{
+    public:
+        static constexpr int SIZE = 65536;     //The XO-CHIP address space, CHIP-8 only uses the first 4KB
+
+        struct Counts{
+            std::uint32_t reads = 0;
+            std::uint32_t writes = 0;
+            std::uint32_t executes = 0;
+        };
+
+        //The first write to an address that had been executed
+        struct SelfModification{
+            std::uint16_t address;
+            std::uint16_t pc;       //Of the instruction writing
+            std::uint64_t cycle;
+        };
+
+        //Addresses wrap around at mask, the one of the interpreter: 0xFFF, or 0xFFFF in XO-CHIP
+
+        //The two bytes of the instruction at pc
+        void fetch(std::uint16_t pc, std::uint16_t mask);
+
+        //count bytes starting at address, by DXYN and FX65
+        void read(std::uint16_t address, int count, std::uint16_t mask);
+
+        //count bytes starting at address, by FX33 and FX55
+        void write(std::uint16_t address, int count, std::uint16_t mask, std::uint16_t pc, std::uint64_t cycle);
+
+        void clear();
+
+        const Counts& operator[](std::uint16_t address) const;
+
+        //One per address, in the order they happened
+        const std::vector<SelfModification>& selfModifications() const;
+
+        //All writes to executed addresses, not only the first ones
+        std::uint64_t selfModifyingWrites() const;
+
+        //address,reads,writes,executes,self_modified with a header line, one line per address used
+        void writeCsv(std::ostream& out) const;
+
+        //Binary PPM 64 pixels wide, one pixel per address row by row.
+        //64 rows for the 4KB of CHIP-8, more if XO-CHIP addresses past them were used.
+        //Red is writes, green reads and blue executes, log scaled so that rare accesses show.
+        void writeHeatmap(std::ostream& out) const;
+
+    private:
+        std::array<Counts, SIZE> counts;
+        std::array<bool, SIZE> modified{};
+        std::vector<SelfModification> modifications;
+        std::uint64_t modifyingWrites = 0;
+};
@@ -0,0 +1,172 @@
+#include "Metrics.hpp"
+#include <array>
+#include <cmath>
+#include <cstdio>
+#include <iostream>
+
+namespace{
+    using Clock = std::chrono::steady_clock;
+
+    //3x5 glyphs, a row every 3 bits from the top, leftmost pixel in the highest bit
+    constexpr std::array<std::uint16_t, 128> makeFont(){
+        std::array<std::uint16_t, 128> font{};
+        const char chars[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ./%:-";
+        const std::uint16_t glyphs[] = {
+            0b111101101101111, 0b010110010010111, 0b111001111100111, 0b111001111001111,
+            0b101101111001001, 0b111100111001111, 0b111100111101111, 0b111001010010010,
+            0b111101111101111, 0b111101111001111,
+            0b010101111101101, 0b110101110101110, 0b011100100100011, 0b110101101101110,
+            0b111100110100111, 0b111100110100100, 0b011100101101011, 0b101101111101101,
+            0b111010010010111, 0b001001001101010, 0b101101110101101, 0b100100100100111,
+            0b101111111101101, 0b110101101101101, 0b010101101101010, 0b110101110100100,
+            0b010101101110011, 0b110101110101101, 0b011100010001110, 0b111010010010010,
+            0b101101101101111, 0b101101101101010, 0b101101111111101, 0b101101010101101,
+            0b101101010010010, 0b111001010100111,
+            0b000000000000010, 0b001001010100100, 0b101001010100101, 0b000010000010000,
+            0b000000111000000,
+        };
+
+        for(std::size_t i = 0; i < sizeof(glyphs) / sizeof(glyphs[0]); i++){
+            font[static_cast<unsigned char>(chars[i])] = glyphs[i];
+        }
+
+        return font;
+    }
+
+    constexpr std::array<std::uint16_t, 128> font = makeFont();
+
+    double toMs(std::chrono::nanoseconds t){
+        return std::chrono::duration<double, std::milli>(t).count();
+    }
+}
+
+Metrics::Metrics(const std::string& statsFile, std::chrono::milliseconds period) : period{period}{
+    if(statsFile == "-"){
+        out = &std::cout;
+    }
+    else if(!statsFile.empty()){
+        file.open(statsFile);
+
+        if(file){
+            out = &file;
+        }
+        else{
+            std::cerr << "Couldn't create stats file " << statsFile << std::endl;
+        }
+    }
+}
+
+void Metrics::addInstructions(std::uint64_t count){
+    instructions.fetch_add(count, std::memory_order_relaxed);
+}
+
+void Metrics::addFramePublished(){
+    published.fetch_add(1, std::memory_order_relaxed);
+}
+
+void Metrics::addEmulationTime(std::chrono::nanoseconds executing, std::chrono::nanoseconds sleeping){
+    executingNs.fetch_add(executing.count(), std::memory_order_relaxed);
+    sleepingNs.fetch_add(sleeping.count(), std::memory_order_relaxed);
+}
+
+void Metrics::frameStart(Clock::time_point now, int hz){
+    if(start == Clock::time_point{}){
+        start = periodStart = lastFrame = now;
+        return;
+    }
+
+    double interval = toMs(now - lastFrame);
+    intervals++;
+    intervalSum += interval;
+    intervalSquares += interval * interval;
+    lastFrame = now;
+
+    if(now - periodStart >= period){
+        finishPeriod(now, hz);
+    }
+}
+
+void Metrics::frameDrawn(std::chrono::nanoseconds drawTime){
+    double ms = toMs(drawTime);
+    drawn++;
+    drawSum += ms;
+    drawMax = ms > drawMax ? ms : drawMax;
+}
+
+void Metrics::finishPeriod(Clock::time_point now, int hz){
+    const double seconds = std::chrono::duration<double>(now - periodStart).count();
+    const std::uint64_t frames = published.exchange(0, std::memory_order_relaxed);
+
+    report.time = std::chrono::duration<double>(now - start).count();
+    report.ips = instructions.exchange(0, std::memory_order_relaxed) / seconds;
+    report.hz = hz;
+    report.drawn = drawn;
+    //A frame published at the end of the last period may be drawn in this one
+    report.skipped = frames > drawn ? frames - drawn : 0;
+    report.drawMs = drawn ? drawSum / drawn : 0;
+    report.drawMaxMs = drawMax;
+
+    double mean = intervals ? intervalSum / intervals : 0;
+    double variance = intervals ? intervalSquares / intervals - mean * mean : 0;
+    report.jitterMs = variance > 0 ? std::sqrt(variance) : 0;
+
+    report.execMs = toMs(std::chrono::nanoseconds{executingNs.exchange(0, std::memory_order_relaxed)}) / seconds;
+    report.sleepMs = toMs(std::chrono::nanoseconds{sleepingNs.exchange(0, std::memory_order_relaxed)}) / seconds;
+
+    periodStart = now;
+    drawn = 0;
+    drawSum = drawMax = 0;
+    intervals = 0;
+    intervalSum = intervalSquares = 0;
+
+    if(out){
+        print(*out, report);
+        out->flush();
+    }
+
+    buildOverlay();
+}
+
+const Metrics::Report& Metrics::last() const{
+    return report;
+}
+
+const std::vector<Metrics::Point>& Metrics::overlay() const{
+    return pixels;
+}
+
+void Metrics::print(std::ostream& out, const Report& r){
+    char line[256];
+    std::snprintf(line, sizeof(line),
+                  "stats t=%.2f ips=%.0f hz=%d drawn=%llu skipped=%llu draw_ms=%.3f draw_max_ms=%.3f"
+                  " jitter_ms=%.3f exec_ms=%.1f sleep_ms=%.1f\n",
+                  r.time, r.ips, r.hz, static_cast<unsigned long long>(r.drawn),
+                  static_cast<unsigned long long>(r.skipped), r.drawMs, r.drawMaxMs,
+                  r.jitterMs, r.execMs, r.sleepMs);
+    out << line;
+}
+
+void Metrics::buildOverlay(){
+    const double busy = report.execMs / 10;   //Percent of each second
+    char lines[5][19];
+    std::snprintf(lines[0], sizeof(lines[0]), "HZ %.0f/%d", report.ips, report.hz);
+    std::snprintf(lines[1], sizeof(lines[1]), "FPS %llu SKIP %llu", static_cast<unsigned long long>(report.drawn),
+                  static_cast<unsigned long long>(report.skipped));
+    std::snprintf(lines[2], sizeof(lines[2]), "DRAW %.2fMS", report.drawMs);
+    std::snprintf(lines[3], sizeof(lines[3]), "JITTER %.2fMS", report.jitterMs);
+    std::snprintf(lines[4], sizeof(lines[4]), "BUSY %.0f%%", busy);
+
+    pixels.clear();
+    for(int line = 0; line < 5; line++){
+        for(int c = 0; lines[line][c]; c++){
+            std::uint16_t glyph = font[static_cast<unsigned char>(lines[line][c]) & 0x7F];
+
+            for(int bit = 0; bit < 15; bit++){
+                if(glyph & (0x4000 >> bit)){
+                    pixels.push_back({static_cast<std::int16_t>(1 + c * 4 + bit % 3),
+                                      static_cast<std::int16_t>(1 + line * 6 + bit / 3)});
+                }
+            }
+        }
+    }
+}
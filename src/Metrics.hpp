@@ -0,0 +1,88 @@
+#pragma once
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+//Runtime metrics, to tell whether the emulator keeps up on this machine.
+//The emulation thread adds to atomic counters, the thread drawing the frames
+//times its own work and once a period turns both into a Report.
+//The report is written as one line of key=value pairs, and kept as
+//overlay pixels for the frontends to draw over the game.
+class Metrics{
+    public:
+        struct Report{
+            double time = 0;            //Seconds since the first frame
+            double ips = 0;             //Instructions executed per second
+            int hz = 0;                 //The target
+            std::uint64_t drawn = 0;    //Frames drawn in the period
+            std::uint64_t skipped = 0;  //Frames published but replaced before they were drawn
+            double drawMs = 0;          //Average time in draw()
+            double drawMaxMs = 0;
+            double jitterMs = 0;        //Standard deviation of the time between frames
+            double execMs = 0;          //Per second, emulation thread executing instructions
+            double sleepMs = 0;         //Per second, emulation thread sleeping or waiting for input
+        };
+
+        //A lit pixel of the overlay, in the overlay's own pixels from its top left corner
+        struct Point{
+            std::int16_t x;
+            std::int16_t y;
+        };
+
+        //Size of the overlay in its own pixels, for a background behind it
+        static constexpr int OVERLAY_WIDTH = 18 * 4 + 1;
+        static constexpr int OVERLAY_HEIGHT = 5 * 6 + 1;
+
+        //A report is made every period. It's written to statsFile,
+        //or stdout if statsFile is "-", or nowhere if it's empty.
+        //If the file can't be created, an error is printed and nothing is written.
+        explicit Metrics(const std::string& statsFile, std::chrono::milliseconds period = std::chrono::seconds{1});
+
+        //Emulation thread
+        void addInstructions(std::uint64_t count);
+        void addFramePublished();
+        void addEmulationTime(std::chrono::nanoseconds executing, std::chrono::nanoseconds sleeping);
+
+        //Drawing thread: once at the start of each frame, and after each draw()
+        void frameStart(std::chrono::steady_clock::time_point now, int hz);
+        void frameDrawn(std::chrono::nanoseconds drawTime);
+
+        //Drawing thread: the last report, and the overlay showing it
+        const Report& last() const;
+        const std::vector<Point>& overlay() const;
+
+        //stats t=X ips=X hz=X drawn=X skipped=X draw_ms=X draw_max_ms=X jitter_ms=X exec_ms=X sleep_ms=X
+        static void print(std::ostream& out, const Report& report);
+
+    private:
+        std::chrono::steady_clock::duration period;
+
+        //Written by the emulation thread, taken by the drawing thread
+        std::atomic<std::uint64_t> instructions{0};
+        std::atomic<std::uint64_t> published{0};
+        std::atomic<std::int64_t> executingNs{0};
+        std::atomic<std::int64_t> sleepingNs{0};
+
+        //Drawing thread
+        std::chrono::steady_clock::time_point start;
+        std::chrono::steady_clock::time_point periodStart;
+        std::chrono::steady_clock::time_point lastFrame;
+        std::uint64_t drawn = 0;
+        double drawSum = 0;
+        double drawMax = 0;
+        std::uint64_t intervals = 0;
+        double intervalSum = 0;
+        double intervalSquares = 0;
+        Report report;
+        std::vector<Point> pixels;
+
+        std::ofstream file;
+        std::ostream* out = nullptr;
+
+        void finishPeriod(std::chrono::steady_clock::time_point now, int hz);
+        void buildOverlay();
+};
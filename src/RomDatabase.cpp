@@ -0,0 +1,159 @@
+#include "RomDatabase.hpp"
+#include "Hash.hpp"
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CPP8_HAVE_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace{
+    constexpr char magic[8] = "CPP8RDB";
+    constexpr std::uint32_t version = 1;
+}
+
+RomDatabase::RomDatabase(const std::string& path){
+    const void* data = nullptr;
+    std::size_t size = 0;
+
+    #ifdef CPP8_HAVE_MMAP
+    int fd = open(path.c_str(), O_RDONLY);
+    struct stat info;
+
+    if(fd >= 0 && fstat(fd, &info) == 0 && info.st_size > 0){
+        if(map = mmap(nullptr, info.st_size, PROT_READ, MAP_SHARED, fd, 0); map == MAP_FAILED){
+            map = nullptr;
+        }
+        else{
+            mapSize = info.st_size;
+            data = map;
+            size = mapSize;
+        }
+    }
+
+    if(fd >= 0){
+        close(fd);
+    }
+    #endif
+
+    //No mmap, read the whole file instead
+    if(!data){
+        std::ifstream file{path, std::ios::binary};
+        buffer.assign(std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{});
+        data = buffer.data();
+        size = buffer.size();
+
+        if(!file.good() && !file.eof()){
+            size = 0;
+        }
+    }
+
+    if(size == 0){
+        std::cerr << "Could not open ROM database \"" << path << "\"\n";
+        return;
+    }
+
+    //Check this is a database we know how to read, and that it's all there
+    const RomDatabaseHeader* h = static_cast<const RomDatabaseHeader*>(data);
+    if(size < sizeof(RomDatabaseHeader)
+       || std::memcmp(h->magic, magic, sizeof(magic)) != 0
+       || h->version != version
+       || h->entrySize != sizeof(RomEntry)
+       || (size - sizeof(RomDatabaseHeader)) / sizeof(RomEntry) < h->count){
+        std::cerr << "\"" << path << "\" is not a ROM database\n";
+        return;
+    }
+
+    header = h;
+    entries = reinterpret_cast<const RomEntry*>(header + 1);
+}
+
+RomDatabase::~RomDatabase(){
+    #ifdef CPP8_HAVE_MMAP
+    if(map){
+        munmap(map, mapSize);
+    }
+    #endif
+}
+
+bool RomDatabase::ok() const{
+    return header != nullptr;
+}
+
+//Entries are sorted by hash
+const RomEntry* RomDatabase::find(std::uint64_t hash) const{
+    if(!ok()){
+        return nullptr;
+    }
+
+    const RomEntry* end = entries + header->count;
+    const RomEntry* entry = std::lower_bound(entries, end, hash,
+        [](const RomEntry& e, std::uint64_t h){ return e.hash < h; });
+
+    return entry != end && entry->hash == hash ? entry : nullptr;
+}
+
+std::size_t RomDatabase::size() const{
+    return ok() ? header->count : 0;
+}
+
+const RomEntry& RomDatabase::operator[](std::size_t i) const{
+    return entries[i];
+}
+
+bool RomDatabase::write(const std::string& path, std::vector<RomEntry> list){
+    //Sort by hash, keeping the last of each group of duplicates
+    std::reverse(list.begin(), list.end());
+    std::stable_sort(list.begin(), list.end(),
+        [](const RomEntry& a, const RomEntry& b){ return a.hash < b.hash; });
+    list.erase(std::unique(list.begin(), list.end(),
+        [](const RomEntry& a, const RomEntry& b){ return a.hash == b.hash; }), list.end());
+
+    RomDatabaseHeader h{};
+    std::memcpy(h.magic, magic, sizeof(magic));
+    h.version = version;
+    h.entrySize = sizeof(RomEntry);
+    h.count = list.size();
+
+    std::ofstream file{path, std::ios::binary | std::ios::trunc};
+    file.write(reinterpret_cast<const char*>(&h), sizeof(h));
+    file.write(reinterpret_cast<const char*>(list.data()), list.size() * sizeof(RomEntry));
+
+    if(!file){
+        std::cerr << "Could not write ROM database \"" << path << "\"\n";
+        return false;
+    }
+
+    return true;
+}
+
+std::optional<std::uint64_t> RomDatabase::hashFile(const std::string& path){
+    std::ifstream file{path, std::ios::binary};
+
+    if(!file){
+        return std::nullopt;
+    }
+
+    std::vector<char> data{std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    return hash64(data.data(), data.size());
+}
+
+RomEntry RomDatabase::defaultEntry(std::uint64_t hash){
+    RomEntry e{};
+    e.hash = hash;
+    e.foreground = 0xFFFFFF;
+    e.background = 0x000000;
+
+    for(std::uint8_t k = 0; k < 16; k++){
+        e.keys[k] = k;
+    }
+
+    return e;
+}
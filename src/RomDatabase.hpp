@@ -0,0 +1,71 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+//Per game settings, looked up by the hash of the ROM.
+//The database is a file of fixed size entries sorted by hash,
+//memory mapped when opened, so looking up a game among hundreds
+//costs a binary search and nothing is parsed at startup.
+//Build it from a text description with cpp8-romdb.
+
+//Settings for one ROM
+struct RomEntry{
+    std::uint64_t hash;         //hash64 of the ROM file
+    char name[28];              //Zero terminated
+    std::uint16_t hz;           //Instructions per second, 0 to keep the default
+    std::uint8_t quirks;        //Chip8::Quirks::toBits()
+    std::uint8_t scale;         //Output scale, 0 to keep the default
+    std::uint32_t foreground;   //Pixel colors, 0xRRGGBB
+    std::uint32_t background;
+    std::uint8_t keys[16];      //Key layout, see Chip8::setKeyLayout
+};
+static_assert(sizeof(RomEntry) == 64, "ROM entries are written to disk as they are");
+
+//Start of the database file, followed by the entries
+struct RomDatabaseHeader{
+    char magic[8];              //"CPP8RDB"
+    std::uint32_t version;
+    std::uint32_t entrySize;
+    std::uint64_t count;
+    std::uint8_t padding[40];   //Keep entries aligned to a cache line
+};
+static_assert(sizeof(RomDatabaseHeader) == 64, "Database header is written to disk as it is");
+
+
+class RomDatabase{
+    public:
+        //Maps the file at path read only. Check ok() to know if it worked.
+        explicit RomDatabase(const std::string& path);
+        ~RomDatabase();
+
+        RomDatabase(const RomDatabase&) = delete;
+        RomDatabase& operator=(const RomDatabase&) = delete;
+
+        bool ok() const;
+
+        //The entry for the ROM with this hash, nullptr if there is none
+        const RomEntry* find(std::uint64_t hash) const;
+
+        std::size_t size() const;
+        const RomEntry& operator[](std::size_t i) const;
+
+        //Write entries to a database file at path.
+        //If more than one entry has the same hash, the last one is kept.
+        static bool write(const std::string& path, std::vector<RomEntry> entries);
+
+        //hash64 of the file at path, the key entries are found by
+        static std::optional<std::uint64_t> hashFile(const std::string& path);
+
+        //An entry with the default settings
+        static RomEntry defaultEntry(std::uint64_t hash);
+
+    private:
+        void* map = nullptr;
+        std::size_t mapSize = 0;
+        std::vector<std::uint8_t> buffer;   //The file, where it can't be mapped
+        const RomDatabaseHeader* header = nullptr;
+        const RomEntry* entries = nullptr;
+};
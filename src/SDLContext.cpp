@@ -0,0 +1,65 @@
+#include "SDLContext.hpp"
+#include <array>
+#include <cstdint>
+#include <iostream>
+#include <mutex>
+
+namespace{
+    std::mutex usersMutex;
+    int users = 0;
+
+    /*
+    Chip8 Key   Keyboard
+    ---------   ---------
+     1 2 3 C     1 2 3 4
+     4 5 6 D     q w e r
+     7 8 9 E     a s d f
+     A 0 B F     z x c v
+     */
+    constexpr std::array<std::int8_t, 128> makeKeyTable(){
+        std::array<std::int8_t, 128> table{};
+        const char keyboard[] = "1234qwerasdfzxcv";
+        const std::int8_t chip8[] = {0x1, 0x2, 0x3, 0xC, 0x4, 0x5, 0x6, 0xD, 0x7, 0x8, 0x9, 0xE, 0xA, 0x0, 0xB, 0xF};
+
+        for(auto& key : table){
+            key = -1;
+        }
+
+        for(int i = 0; i < 16; i++){
+            table[keyboard[i]] = chip8[i];
+        }
+
+        return table;
+    }
+
+    //Chip8 key for each keycode, -1 if none. The keycodes of letters and digits are their ASCII codes.
+    constexpr std::array<std::int8_t, 128> keyTable = makeKeyTable();
+}
+
+SDLContext::SDLContext(){
+    std::lock_guard<std::mutex> lock{usersMutex};
+
+    if(users == 0 && SDL_Init(SDL_INIT_VIDEO | SDL_INIT_AUDIO) < 0){
+        std::cerr << "SDL_Init Error: " << SDL_GetError() << "\n";
+        return;
+    }
+
+    users++;
+    initialised = true;
+}
+
+SDLContext::~SDLContext(){
+    std::lock_guard<std::mutex> lock{usersMutex};
+
+    if(initialised && --users == 0){
+        SDL_Quit();
+    }
+}
+
+bool SDLContext::ok() const{
+    return initialised;
+}
+
+int SDLContext::chip8Key(SDL_Keycode sym){
+    return sym >= 0 && sym < static_cast<SDL_Keycode>(keyTable.size()) ? keyTable[sym] : -1;
+}
@@ -0,0 +1,22 @@
+#pragma once
+#include <SDL2/SDL.h>
+
+//SDL is initialised once per process, not once per window.
+//The first SDLContext initialises it and the last one to go quits it,
+//so that several SDL frontends can live in one process without breaking each other.
+class SDLContext{
+    public:
+        SDLContext();
+        ~SDLContext();
+        SDLContext(const SDLContext&) = delete;
+        SDLContext& operator=(const SDLContext&) = delete;
+
+        //False if SDL couldn't be initialised, an error has been printed
+        bool ok() const;
+
+        //Chip8 key for a keycode, -1 if none
+        static int chip8Key(SDL_Keycode sym);
+
+    private:
+        bool initialised = false;
+};
@@ -0,0 +1,50 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+//Fixed size queue between exactly one producer thread and one consumer thread.
+//push() and pop() are wait-free, they fail instead of waiting when full or empty.
+//N must be a power of 2.
+template<typename T, std::size_t N>
+class SpscQueue{
+    static_assert(N > 0 && (N & (N - 1)) == 0, "SpscQueue size must be a power of 2");
+
+    public:
+        //Producer. Returns false if the queue is full.
+        bool push(const T& item){
+            std::size_t t = tail.load(std::memory_order_relaxed);
+
+            if(t - head.load(std::memory_order_acquire) == N){
+                return false;
+            }
+
+            items[t & (N - 1)] = item;
+            tail.store(t + 1, std::memory_order_release);
+            return true;
+        }
+
+        //Consumer. Returns false if the queue is empty.
+        bool pop(T& item){
+            std::size_t h = head.load(std::memory_order_relaxed);
+
+            if(h == tail.load(std::memory_order_acquire)){
+                return false;
+            }
+
+            item = items[h & (N - 1)];
+            head.store(h + 1, std::memory_order_release);
+            return true;
+        }
+
+        //Consumer
+        bool empty() const{
+            return head.load(std::memory_order_relaxed) == tail.load(std::memory_order_acquire);
+        }
+
+    private:
+        //On separate cache lines, each is written by one thread only
+        alignas(64) std::atomic<std::size_t> head{0};
+        alignas(64) std::atomic<std::size_t> tail{0};
+        std::array<T, N> items;
+};
@@ -0,0 +1,112 @@
+#include "ToneGenerator.hpp"
+#include <algorithm>
+
+namespace{
+    //Fade in and out over this many seconds
+    constexpr float fadeTime = 0.002f;
+}
+
+ToneGenerator::ToneGenerator(int sampleRate, float frequency, float volume)
+: frequency{frequency}, volume{volume}
+{
+    setSampleRate(sampleRate);
+}
+
+void ToneGenerator::setSampleRate(int rate){
+    sampleRate = rate;
+    increment = frequency / sampleRate;
+    gainStep = volume / (fadeTime * sampleRate);
+}
+
+void ToneGenerator::setOn(bool b){
+    on.store(b, std::memory_order_relaxed);
+}
+
+bool ToneGenerator::isOn() const{
+    return on.load(std::memory_order_relaxed);
+}
+
+void ToneGenerator::setPattern(const std::uint8_t* pattern, float rate){
+    if(pattern){
+        std::uint64_t high = 0, low = 0;
+        for(int i = 0; i < 8; i++){
+            high = high << 8 | pattern[i];
+            low = low << 8 | pattern[i + 8];
+        }
+
+        patternHigh.store(high, std::memory_order_relaxed);
+        patternLow.store(low, std::memory_order_relaxed);
+    }
+
+    patternRate.store(pattern ? rate : 0.0f, std::memory_order_relaxed);
+}
+
+void ToneGenerator::generate(std::int16_t* out, std::size_t count){
+    const float target = on.load(std::memory_order_relaxed) ? volume : 0.0f;
+
+    //Taken once per callback
+    if(const float rate = patternRate.load(std::memory_order_relaxed); rate > 0.0f){
+        const std::uint64_t high = patternHigh.load(std::memory_order_relaxed);
+        const std::uint64_t low = patternLow.load(std::memory_order_relaxed);
+        const float step = rate / sampleRate;
+
+        for(std::size_t i = 0; i < count; i++){
+            gain = gain < target ? std::min(gain + gainStep, target) : std::max(gain - gainStep, target);
+            out[i] = static_cast<std::int16_t>(patternSample(high, low, step) * gain * 32767.0f);
+        }
+
+        return;
+    }
+
+    for(std::size_t i = 0; i < count; i++){
+        //Keep the phase running while silent, so the wave always restarts smoothly
+        float value = phase < 0.5f ? 1.0f : -1.0f;
+        value += polyBlep(phase, increment);
+        value -= polyBlep(phase < 0.5f ? phase + 0.5f : phase - 0.5f, increment);
+
+        gain = gain < target ? std::min(gain + gainStep, target) : std::max(gain - gainStep, target);
+        out[i] = static_cast<std::int16_t>(value * gain * 32767.0f);
+
+        phase += increment;
+        if(phase >= 1.0f){
+            phase -= 1.0f;
+        }
+    }
+}
+
+//A box filter over the bits the output sample spans, then advance past them
+float ToneGenerator::patternSample(std::uint64_t high, std::uint64_t low, float step){
+    float sum = 0.0f;
+
+    for(float left = step; left > 0.0f;){
+        const int bit = static_cast<int>(position);
+        const float span = std::min(left, bit + 1 - position);
+        const bool set = (bit < 64 ? high >> (63 - bit) : low >> (127 - bit)) & 1;
+
+        sum += set ? span : -span;
+        left -= span;
+        position += span;
+
+        if(position >= 128.0f){
+            position -= 128.0f;
+        }
+    }
+
+    return sum / step;
+}
+
+//Smooths the jump of a naive square wave over the samples around it,
+//removing most of the harmonics above the sample rate that would alias back
+float ToneGenerator::polyBlep(float t, float dt){
+    if(t < dt){
+        t /= dt;
+        return t + t - t * t - 1.0f;
+    }
+    else if(t > 1.0f - dt){
+        t = (t - 1.0f) / dt;
+        return t * t + t + t + 1.0f;
+    }
+    else{
+        return 0.0f;
+    }
+}
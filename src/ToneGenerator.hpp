@@ -0,0 +1,59 @@
+#pragma once
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+//The Chip-8 beep: a square wave that plays while the sound timer is non-zero.
+//Samples are made on demand by the audio callback, so there's never
+//more than one callback buffer of sound waiting to be played.
+//The wave is band limited with PolyBLEP, so it doesn't alias into a harsh buzz,
+//and faded in and out over a couple of milliseconds, so it doesn't click.
+//
+//XO-CHIP programs replace the square wave with a pattern of 128 1-bit samples
+//and their own playback rate. The pattern is resampled to the output rate here,
+//in the callback, whatever the rate of the instructions changing it.
+class ToneGenerator{
+    public:
+        explicit ToneGenerator(int sampleRate = 48000, float frequency = 440.0f, float volume = 0.2f);
+
+        //Only before the audio device starts calling generate()
+        void setSampleRate(int sampleRate);
+
+        //Start or stop the tone. Safe to call from any thread.
+        void setOn(bool on);
+        bool isOn() const;
+
+        //Play the 16 bytes of pattern, highest bit first, looped at rate samples per second.
+        //nullptr goes back to the square wave. Safe to call from any thread.
+        void setPattern(const std::uint8_t* pattern, float rate);
+
+        //Fill out with count mono samples.
+        //Called on the audio thread, it never blocks or allocates.
+        void generate(std::int16_t* out, std::size_t count);
+
+    private:
+        std::atomic<bool> on{false};
+        float frequency;
+        float volume;
+        int sampleRate = 48000;
+
+        //The XO-CHIP pattern, first half and second half, and its rate: 0 for the square wave.
+        //The halves may be torn between two callbacks, for a change too short to hear.
+        std::atomic<std::uint64_t> patternHigh{0};
+        std::atomic<std::uint64_t> patternLow{0};
+        std::atomic<float> patternRate{0.0f};
+
+        //Only touched by generate()
+        float phase = 0.0f;     //0 to 1, the wave is high in the first half
+        float increment = 0.0f; //Phase per sample
+        float gain = 0.0f;      //Goes towards volume while on, towards 0 while off
+        float gainStep = 0.0f;  //Change of gain per sample while fading
+        float position = 0.0f;  //In the pattern, 0 to 128
+
+        //The average of the pattern bits from position over step bits, as -1 to 1.
+        //Averaging over the span of an output sample keeps fast patterns from aliasing.
+        float patternSample(std::uint64_t high, std::uint64_t low, float step);
+
+        //Correction for the discontinuity at t, with dt the phase per sample
+        static float polyBlep(float t, float dt);
+};
@@ -0,0 +1,46 @@
+#pragma once
+#include <array>
+#include <atomic>
+
+//Hands the latest value from one thread to another without locks.
+//The producer fills writeBuffer() and publish()es it, the consumer calls update()
+//and reads readBuffer(). Neither ever waits for the other: the producer always has
+//a free buffer to write, and the consumer skips values it was too slow to see.
+template<typename T>
+class TripleBuffer{
+    public:
+        //Producer
+        T& writeBuffer(){
+            return buffers[writeIndex];
+        }
+
+        void publish(){
+            writeIndex = middle.exchange(writeIndex | FRESH, std::memory_order_acq_rel) & INDEX;
+        }
+
+        //Consumer. Returns true if there was a new value since the last call.
+        bool update(){
+            if(!(middle.load(std::memory_order_relaxed) & FRESH)){
+                return false;
+            }
+
+            readIndex = middle.exchange(readIndex, std::memory_order_acq_rel) & INDEX;
+            return true;
+        }
+
+        const T& readBuffer() const{
+            return buffers[readIndex];
+        }
+
+    private:
+        static constexpr int INDEX = 3;
+        static constexpr int FRESH = 4;
+
+        std::array<T, 3> buffers{};
+
+        //The buffer between the two threads, with FRESH set if it wasn't read yet
+        std::atomic<int> middle{1};
+
+        int writeIndex = 0; //Only used by the producer
+        int readIndex = 2;  //Only used by the consumer
+};
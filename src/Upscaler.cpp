@@ -0,0 +1,379 @@
+#include "Upscaler.hpp"
+#include <cstring>
+
+namespace{
+    using Word = std::uint64_t;
+
+    //Bit i of a byte moved to bit 2i, and to bit 3i
+    constexpr std::array<std::uint16_t, 256> makeSpread2(){
+        std::array<std::uint16_t, 256> t{};
+        for(int b = 0; b < 256; b++)
+            for(int i = 0; i < 8; i++)
+                t[b] |= ((b >> i) & 1) << (2 * i);
+        return t;
+    }
+
+    constexpr std::array<std::uint32_t, 256> makeSpread3(){
+        std::array<std::uint32_t, 256> t{};
+        for(int b = 0; b < 256; b++)
+            for(int i = 0; i < 8; i++)
+                t[b] |= ((b >> i) & 1u) << (3 * i);
+        return t;
+    }
+
+    constexpr std::array<std::uint16_t, 256> spread2 = makeSpread2();
+    constexpr std::array<std::uint32_t, 256> spread3 = makeSpread3();
+
+    //Writes packed rows a few bits at a time, highest bits first
+    class BitWriter{
+        public:
+            explicit BitWriter(Word* out) : out{out} {}
+
+            //n is at most 32
+            void put(std::uint32_t v, int n){
+                if(bits + n < 64){
+                    acc = acc << n | v;
+                    bits += n;
+                }
+                else{
+                    int first = 64 - bits;
+                    int rest = n - first;
+                    *out++ = acc << first | v >> rest;
+                    acc = v & ((Word{1} << rest) - 1);
+                    bits = rest;
+                }
+            }
+
+        private:
+            Word* out;
+            Word acc = 0;
+            int bits = 0;
+    };
+
+    //Neighbours of the 64 pixels in word k of a row,
+    //pixels past the edges are taken as equal to the edge pixel
+    inline Word left(const Word* row, int k){
+        return row[k] >> 1 | (k > 0 ? row[k - 1] << 63 : row[k] & (Word{1} << 63));
+    }
+
+    inline Word right(const Word* row, int k, int words){
+        return row[k] << 1 | (k < words - 1 ? row[k + 1] >> 63 : row[k] & 1);
+    }
+
+    //x where the mask is set, e elsewhere
+    inline Word select(Word mask, Word x, Word e){
+        return e ^ ((e ^ x) & mask);
+    }
+}
+
+std::optional<Upscaler::Filter> Upscaler::parse(const std::string& name){
+    if(name == "none")          return Filter::NONE;
+    else if(name == "scale2x")  return Filter::SCALE2X;
+    else if(name == "scale3x")  return Filter::SCALE3X;
+    else if(name == "scale4x")  return Filter::SCALE4X;
+    else if(name == "hq2x")     return Filter::HQ2X;
+    else if(name == "hq3x")     return Filter::HQ3X;
+    else if(name == "hq4x")     return Filter::HQ4X;
+    else                        return std::nullopt;
+}
+
+Upscaler::Upscaler(Filter f, std::uint32_t foreground, std::uint32_t background)
+: filter{f}
+{
+    switch(filter){
+        case Filter::NONE:      scale = 1; break;
+        case Filter::SCALE2X:
+        case Filter::HQ2X:      scale = 2; break;
+        case Filter::SCALE3X:
+        case Filter::HQ3X:      scale = 3; break;
+        case Filter::SCALE4X:
+        case Filter::HQ4X:      scale = 4; break;
+    }
+
+    palette = {background, foreground, foreground, foreground};
+    setColors(foreground, background);
+    buildCoverage();
+}
+
+void Upscaler::setColors(std::uint32_t foreground, std::uint32_t background){
+    palette[0] = background;
+    palette[1] = foreground;
+
+    for(int b = 0; b < 256; b++){
+        for(int i = 0; i < 8; i++){
+            expandTable[b][i] = (b << i) & 0x80 ? foreground : background;
+        }
+    }
+
+    //Blend each byte separately, whatever the pixel format is
+    for(int level = 0; level <= 16; level++){
+        std::uint32_t color = 0;
+
+        for(int shift = 0; shift < 32; shift += 8){
+            std::uint32_t fg = (foreground >> shift) & 0xFF;
+            std::uint32_t bg = (background >> shift) & 0xFF;
+            color |= ((fg * level + bg * (16 - level) + 8) / 16) << shift;
+        }
+
+        blendTable[level] = color;
+    }
+}
+
+void Upscaler::setPlaneColors(std::uint32_t second, std::uint32_t blend){
+    palette[2] = second;
+    palette[3] = blend;
+}
+
+Upscaler::Filter Upscaler::getFilter() const{
+    return filter;
+}
+
+int Upscaler::factor() const{
+    return scale;
+}
+
+void Upscaler::upscale(const std::uint64_t* rows, int wordsPerRow, int height, void* pixels, int pitch){
+    switch(filter){
+        case Filter::NONE:
+            expand(rows, wordsPerRow, height, pixels, pitch);
+        break;
+
+        case Filter::SCALE2X:
+        case Filter::SCALE3X:
+        case Filter::SCALE4X:
+            expand(scaled(rows, wordsPerRow, height, scratch, scratch2), wordsPerRow * scale, height * scale, pixels, pitch);
+        break;
+
+        case Filter::HQ2X:
+        case Filter::HQ3X:
+        case Filter::HQ4X:
+            hq(rows, wordsPerRow, height, pixels, pitch);
+        break;
+    }
+}
+
+void Upscaler::upscale(const std::uint64_t* rows, const std::uint64_t* rows2, int wordsPerRow, int height, void* pixels, int pitch){
+    const std::uint64_t* first = scaled(rows, wordsPerRow, height, scratch, scratch2);
+    const std::uint64_t* second = scaled(rows2, wordsPerRow, height, planeScratch, planeScratch2);
+    expandPlanes(first, second, wordsPerRow * scale, height * scale, pixels, pitch);
+}
+
+const std::uint64_t* Upscaler::scaled(const std::uint64_t* rows, int wordsPerRow, int height,
+                                      std::vector<std::uint64_t>& out, std::vector<std::uint64_t>& temp) const{
+    switch(scale){
+        case 2:
+            out.resize(wordsPerRow * height * 4);
+            scale2x(rows, wordsPerRow, height, out.data());
+        break;
+
+        case 3:
+            out.resize(wordsPerRow * height * 9);
+            scale3x(rows, wordsPerRow, height, out.data());
+        break;
+
+        case 4:
+            temp.resize(wordsPerRow * height * 4);
+            out.resize(wordsPerRow * height * 16);
+            scale2x(rows, wordsPerRow, height, temp.data());
+            scale2x(temp.data(), wordsPerRow * 2, height * 2, out.data());
+        break;
+
+        default:
+            return rows;
+    }
+
+    return out.data();
+}
+
+void Upscaler::pack(const bool* pixels, int width, int height, std::uint64_t* rows){
+    for(int i = 0; i < width * height / 64; i++){
+        Word w = 0;
+
+        for(int x = 0; x < 64; x++){
+            w = w << 1 | pixels[x];
+        }
+
+        rows[i] = w;
+        pixels += 64;
+    }
+}
+
+//Packed rows to 32-bit pixels, 8 at a time
+void Upscaler::expand(const std::uint64_t* rows, int wordsPerRow, int height, void* pixels, int pitch) const{
+    for(int y = 0; y < height; y++){
+        std::uint8_t* out = static_cast<std::uint8_t*>(pixels) + y * pitch;
+
+        for(int k = 0; k < wordsPerRow; k++){
+            Word w = rows[y * wordsPerRow + k];
+
+            for(int shift = 56; shift >= 0; shift -= 8){
+                std::memcpy(out, expandTable[(w >> shift) & 0xFF].data(), 8 * sizeof(std::uint32_t));
+                out += 8 * sizeof(std::uint32_t);
+            }
+        }
+    }
+}
+
+//Two packed planes to 32-bit pixels: the bits of a pixel in each plane pick its color
+void Upscaler::expandPlanes(const std::uint64_t* rows, const std::uint64_t* rows2, int wordsPerRow, int height, void* pixels, int pitch) const{
+    for(int y = 0; y < height; y++){
+        std::uint32_t* out = reinterpret_cast<std::uint32_t*>(static_cast<std::uint8_t*>(pixels) + y * pitch);
+
+        for(int k = 0; k < wordsPerRow; k++){
+            const Word first = rows[y * wordsPerRow + k];
+            const Word second = rows2[y * wordsPerRow + k];
+
+            for(int bit = 63; bit >= 0; bit--){
+                *out++ = palette[(first >> bit & 1) | (second >> bit & 1) << 1];
+            }
+        }
+    }
+}
+
+//Scale2x on 64 pixels at a time. With B above E, D left, F right and H below:
+//  E0 = D == B ? D : E     E1 = B == F ? F : E
+//  E2 = D == H ? D : E     E3 = H == F ? F : E
+//when B != H and D != F, otherwise all four are E.
+void Upscaler::scale2x(const std::uint64_t* src, int wordsPerRow, int height, std::uint64_t* dst){
+    for(int y = 0; y < height; y++){
+        const Word* row = src + y * wordsPerRow;
+        const Word* up = y > 0 ? row - wordsPerRow : row;
+        const Word* down = y < height - 1 ? row + wordsPerRow : row;
+
+        BitWriter top{dst + (2 * y) * (2 * wordsPerRow)};
+        BitWriter bottom{dst + (2 * y + 1) * (2 * wordsPerRow)};
+
+        for(int k = 0; k < wordsPerRow; k++){
+            Word E = row[k], B = up[k], H = down[k];
+            Word D = left(row, k), F = right(row, k, wordsPerRow);
+            Word edge = (B ^ H) & (D ^ F);
+
+            Word e0 = select(edge & ~(D ^ B), D, E);
+            Word e1 = select(edge & ~(B ^ F), F, E);
+            Word e2 = select(edge & ~(D ^ H), D, E);
+            Word e3 = select(edge & ~(H ^ F), F, E);
+
+            //Interleave the left and right halves, a byte at a time
+            for(int shift = 56; shift >= 0; shift -= 8){
+                top.put(spread2[(e0 >> shift) & 0xFF] << 1 | spread2[(e1 >> shift) & 0xFF], 16);
+                bottom.put(spread2[(e2 >> shift) & 0xFF] << 1 | spread2[(e3 >> shift) & 0xFF], 16);
+            }
+        }
+    }
+}
+
+//Scale3x on 64 pixels at a time. Neighbours are
+//  A B C
+//  D E F
+//  G H I
+//and when B != H and D != F:
+//  E0 = D == B ? D : E
+//  E1 = (D == B && E != C) || (B == F && E != A) ? B : E
+//  E2 = B == F ? F : E
+//  E3 = (D == B && E != G) || (D == H && E != A) ? D : E
+//  E4 = E
+//  E5 = (B == F && E != I) || (H == F && E != C) ? F : E
+//  E6 = D == H ? D : E
+//  E7 = (D == H && E != I) || (H == F && E != G) ? H : E
+//  E8 = H == F ? F : E
+void Upscaler::scale3x(const std::uint64_t* src, int wordsPerRow, int height, std::uint64_t* dst){
+    for(int y = 0; y < height; y++){
+        const Word* row = src + y * wordsPerRow;
+        const Word* up = y > 0 ? row - wordsPerRow : row;
+        const Word* down = y < height - 1 ? row + wordsPerRow : row;
+
+        BitWriter out0{dst + (3 * y) * (3 * wordsPerRow)};
+        BitWriter out1{dst + (3 * y + 1) * (3 * wordsPerRow)};
+        BitWriter out2{dst + (3 * y + 2) * (3 * wordsPerRow)};
+
+        for(int k = 0; k < wordsPerRow; k++){
+            Word A = left(up, k), B = up[k], C = right(up, k, wordsPerRow);
+            Word D = left(row, k), E = row[k], F = right(row, k, wordsPerRow);
+            Word G = left(down, k), H = down[k], I = right(down, k, wordsPerRow);
+            Word edge = (B ^ H) & (D ^ F);
+
+            Word db = ~(D ^ B), bf = ~(B ^ F), dh = ~(D ^ H), hf = ~(H ^ F);
+
+            Word e[9];
+            e[0] = select(edge & db, D, E);
+            e[1] = select(edge & ((db & (E ^ C)) | (bf & (E ^ A))), B, E);
+            e[2] = select(edge & bf, F, E);
+            e[3] = select(edge & ((db & (E ^ G)) | (dh & (E ^ A))), D, E);
+            e[4] = E;
+            e[5] = select(edge & ((bf & (E ^ I)) | (hf & (E ^ C))), F, E);
+            e[6] = select(edge & dh, D, E);
+            e[7] = select(edge & ((dh & (E ^ I)) | (hf & (E ^ G))), H, E);
+            e[8] = select(edge & hf, F, E);
+
+            for(int shift = 56; shift >= 0; shift -= 8){
+                out0.put(spread3[(e[0] >> shift) & 0xFF] << 2 | spread3[(e[1] >> shift) & 0xFF] << 1 | spread3[(e[2] >> shift) & 0xFF], 24);
+                out1.put(spread3[(e[3] >> shift) & 0xFF] << 2 | spread3[(e[4] >> shift) & 0xFF] << 1 | spread3[(e[5] >> shift) & 0xFF], 24);
+                out2.put(spread3[(e[6] >> shift) & 0xFF] << 2 | spread3[(e[7] >> shift) & 0xFF] << 1 | spread3[(e[8] >> shift) & 0xFF], 24);
+            }
+        }
+    }
+}
+
+//The HQ filters find edges like Scale2x, but instead of filling
+//the corner of the pixel they cut it along the diagonal,
+//through the middle of the two sides touching the corner.
+//Each output pixel is sampled 16 times, so the cut is antialiased.
+void Upscaler::buildCoverage(){
+    //Bits of the index
+    constexpr int E = 1, B = 2, D = 4, F = 8, H = 16;
+
+    for(int n = 0; n < 32; n++){
+        auto on = [n](int bit){ return (n & bit) != 0; };
+        bool edge = on(B) != on(H) && on(D) != on(F);
+
+        for(int sy = 0; sy < scale; sy++){
+            for(int sx = 0; sx < scale; sx++){
+                int level = 0;
+
+                for(int s = 0; s < 16; s++){
+                    //Sample position relative to the center of the pixel, from -0.5 to 0.5
+                    float u = (sx + ((s % 4) + 0.5f) / 4) / scale - 0.5f;
+                    float v = (sy + ((s / 4) + 0.5f) / 4) / scale - 0.5f;
+
+                    //The neighbours next to the corner this sample is in
+                    bool horizontal = on(u < 0 ? D : F);
+                    bool vertical = on(v < 0 ? B : H);
+                    bool cut = edge && horizontal == vertical && (u < 0 ? -u : u) + (v < 0 ? -v : v) > 0.5f;
+
+                    level += cut ? vertical : on(E);
+                }
+
+                coverage[n][sy * scale + sx] = level;
+            }
+        }
+    }
+}
+
+void Upscaler::hq(const std::uint64_t* rows, int wordsPerRow, int height, void* pixels, int pitch) const{
+    for(int y = 0; y < height; y++){
+        const Word* row = rows + y * wordsPerRow;
+        const Word* up = y > 0 ? row - wordsPerRow : row;
+        const Word* down = y < height - 1 ? row + wordsPerRow : row;
+        std::uint8_t* out = static_cast<std::uint8_t*>(pixels) + y * scale * pitch;
+
+        for(int k = 0; k < wordsPerRow; k++){
+            Word E = row[k], B = up[k], H = down[k];
+            Word D = left(row, k), F = right(row, k, wordsPerRow);
+
+            for(int bit = 63; bit >= 0; bit--){
+                int n = (E >> bit & 1) | (B >> bit & 1) << 1 | (D >> bit & 1) << 2
+                      | (F >> bit & 1) << 3 | (H >> bit & 1) << 4;
+                const std::uint8_t* levels = coverage[n].data();
+
+                for(int sy = 0; sy < scale; sy++){
+                    std::uint32_t* dst = reinterpret_cast<std::uint32_t*>(out + sy * pitch);
+                    for(int sx = 0; sx < scale; sx++){
+                        dst[sx] = blendTable[levels[sy * scale + sx]];
+                    }
+                }
+
+                out += scale * sizeof(std::uint32_t);
+            }
+        }
+    }
+}
@@ -0,0 +1,93 @@
+#pragma once
+#include <array>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+//Pixel art upscalers, run on the CPU before the frame is handed to the GPU.
+//They work on packed framebuffers, 1 bit per pixel and one row every
+//wordsPerRow 64-bit words, leftmost pixel in the highest bit.
+//Being black and white, comparing neighbours is a bitwise operation,
+//so the Scale filters handle 64 pixels at a time.
+//The result is written as 32-bit pixels, ready to copy into a streaming texture.
+//
+//XO-CHIP screens have a second plane, for four colors. Each plane is scaled on its own,
+//then the bits of each pixel in the two pick its color.
+class Upscaler{
+    public:
+        enum class Filter{
+            NONE,       //1 output pixel per pixel, the GPU does the scaling
+            SCALE2X,    //Scale2x, also known as AdvMAME2x
+            SCALE3X,    //Scale3x, AdvMAME3x
+            SCALE4X,    //Scale2x applied twice
+            HQ2X,       //Diagonal edges found like Scale2x, then smoothed
+            HQ3X,       //by blending the two colors. Similar in look to hqNx,
+            HQ4X,       //but not the original hqNx tables.
+        };
+
+        //"none", "scale2x", "scale3x", "scale4x", "hq2x", "hq3x" or "hq4x"
+        static std::optional<Filter> parse(const std::string& name);
+
+        //foreground and background are pixel values as the texture wants them,
+        //they are blended a byte at a time.
+        Upscaler(Filter filter, std::uint32_t foreground, std::uint32_t background);
+
+        void setColors(std::uint32_t foreground, std::uint32_t background);
+
+        //Pixels lit only in the second plane, and in both
+        void setPlaneColors(std::uint32_t second, std::uint32_t blend);
+
+        Filter getFilter() const;
+
+        //Output pixels per input pixel, in each direction
+        int factor() const;
+
+        //Upscale a packed frame of 64 * wordsPerRow by height pixels.
+        //pixels receives factor() times as many rows and columns, rows are pitch bytes apart.
+        void upscale(const std::uint64_t* rows, int wordsPerRow, int height, void* pixels, int pitch);
+
+        //Same with two planes, in four colors. The HQ filters blend two colors only,
+        //so they scale the planes like the Scale filter of the same factor.
+        void upscale(const std::uint64_t* rows, const std::uint64_t* rows2, int wordsPerRow, int height, void* pixels, int pitch);
+
+        //Pack width by height pixels, row by row, into rows.
+        //width must be a multiple of 64.
+        static void pack(const bool* pixels, int width, int height, std::uint64_t* rows);
+
+    private:
+        Filter filter;
+        int scale;
+
+        //The 32-bit pixels for each byte of a packed row
+        std::array<std::array<std::uint32_t, 8>, 256> expandTable;
+
+        //Background, first plane, second plane and both
+        std::array<std::uint32_t, 4> palette;
+
+        //Colors between background (0) and foreground (16), for the HQ filters
+        std::array<std::uint32_t, 17> blendTable;
+
+        //HQ filters: for each combination of a pixel and its 4 neighbours,
+        //how much foreground (0 to 16) goes into each of the output pixels
+        std::array<std::array<std::uint8_t, 16>, 32> coverage;
+
+        //Packed intermediate results, kept to avoid allocating each frame
+        std::vector<std::uint64_t> scratch;
+        std::vector<std::uint64_t> scratch2;
+        std::vector<std::uint64_t> planeScratch;
+        std::vector<std::uint64_t> planeScratch2;
+
+        void buildCoverage();
+        void expand(const std::uint64_t* rows, int wordsPerRow, int height, void* pixels, int pitch) const;
+        void expandPlanes(const std::uint64_t* rows, const std::uint64_t* rows2, int wordsPerRow, int height, void* pixels, int pitch) const;
+
+        //rows scaled by the Scale filter of factor(), into out using temp. Returns the scaled rows.
+        const std::uint64_t* scaled(const std::uint64_t* rows, int wordsPerRow, int height,
+                                    std::vector<std::uint64_t>& out, std::vector<std::uint64_t>& temp) const;
+        void hq(const std::uint64_t* rows, int wordsPerRow, int height, void* pixels, int pitch) const;
+
+        //Packed to packed, dst has 2 or 3 times the words per row and rows
+        static void scale2x(const std::uint64_t* src, int wordsPerRow, int height, std::uint64_t* dst);
+        static void scale3x(const std::uint64_t* src, int wordsPerRow, int height, std::uint64_t* dst);
+};
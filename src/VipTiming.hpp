@@ -0,0 +1,109 @@
+#pragma once
+#include "Chip8Core.hpp"
+#include <cstdint>
+
+//How long each instruction took on the COSMAC VIP, the machine CHIP-8 was written for.
+//
+//The VIP is a CDP1802 at 1.7609 MHz, where a machine cycle is 8 clocks and nearly every
+//1802 instruction takes 2 of them. 60 times a second the CDP1861 display takes the bus
+//to fetch the screen, 8 bytes of DMA on each of its 128 lines, and the interpreter
+//gets what's left of the frame.
+//
+//The costs are in machine cycles, estimated from the 1802 routines of the interpreter:
+//the fetch and dispatch every instruction goes through, plus the routine of the opcode.
+//They are close, not exact, but they keep what matters: a 00E0 or a tall sprite costs
+//many times a 6XKK, and a DXYN waits for the next frame before anything else runs.
+//
+//Chip8::setVipTiming runs a frame's budget of machine cycles instead of hz/60 instructions.
+
+//CONSTANTS
+constexpr int VIP_CYCLES_PER_FRAME = 1760900 / 8 / 60;
+constexpr int VIP_DISPLAY_DMA_CYCLES = 8 * 128;
+constexpr int VIP_FRAME_BUDGET = VIP_CYCLES_PER_FRAME - VIP_DISPLAY_DMA_CYCLES;
+constexpr int VIP_FETCH_CYCLES = 40;
+constexpr int VIP_SKIP_CYCLES = 4;      //Extra when a skip is taken
+
+//What the instruction at PC costs
+struct VipCost{
+    int cycles;
+    bool displayWait;   //A low resolution DXYN: nothing more runs until the next frame
+};
+
+//Cost of the instruction at core.PC, from the state before it runs.
+//mem is the memory of the mode and mask its size minus one, like in Chip8::step.
+//Instructions the VIP didn't have, from SUPER-CHIP and XO-CHIP, cost like a 7XKK.
+constexpr VipCost vipCost(const Chip8Core& core, const std::uint8_t* mem, std::uint16_t mask){
+    const std::uint8_t high = mem[core.PC & mask];
+    const std::uint8_t low = mem[(core.PC + 1) & mask];
+    const std::uint8_t vx = core.V[high & 0xF];
+    const std::uint8_t vy = core.V[low >> 4];
+    const int taken = VIP_SKIP_CYCLES;
+    int cycles = 10;
+
+    switch(high >> 4){
+        case 0x0:
+            if(high == 0x00 && low == 0xE0)
+                cycles = 24 + 4 * 256;  //A store and a branch per byte of the 256 byte screen
+            break;
+        case 0x1:
+            cycles = 12;
+            break;
+        case 0x2:
+            cycles = 26;
+            break;
+        case 0x3:
+            cycles = vx == low ? 10 + taken : 10;
+            break;
+        case 0x4:
+            cycles = vx != low ? 10 + taken : 10;
+            break;
+        case 0x5:
+            cycles = vx == vy ? 14 + taken : 14;
+            break;
+        case 0x6:
+            cycles = 6;
+            break;
+        case 0x8:
+            cycles = 44;                //Patched into RAM and run as 1802 code
+            break;
+        case 0x9:
+            cycles = vx != vy ? 14 + taken : 14;
+            break;
+        case 0xA:
+            cycles = 12;
+            break;
+        case 0xB:
+            cycles = 22;
+            break;
+        case 0xC:
+            cycles = 36;
+            break;
+        case 0xD:
+            //Each row is shifted into place and XORed into two bytes
+            return {VIP_FETCH_CYCLES + 26 + 46 * (low & 0xF), !core.screen.hires};
+        case 0xE:
+            if(low == 0x9E)
+                cycles = core.keys[vx & 0xF] ? 14 + taken : 14;
+            else if(low == 0xA1)
+                cycles = !core.keys[vx & 0xF] ? 14 + taken : 14;
+            break;
+        case 0xF:
+            switch(low){
+                case 0x1E:
+                case 0x29:
+                    cycles = 16;
+                    break;
+                case 0x33:
+                    //Each digit by repeated subtraction
+                    cycles = 80 + 16 * (vx / 100 + vx / 10 % 10 + vx % 10);
+                    break;
+                case 0x55:
+                case 0x65:
+                    cycles = 14 + 14 * ((high & 0xF) + 1);
+                    break;
+            }
+            break;
+    }
+
+    return {VIP_FETCH_CYCLES + cycles, false};
+}
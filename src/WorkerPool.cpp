@@ -0,0 +1,83 @@
+#include "WorkerPool.hpp"
+#include <algorithm>
+
+WorkerPool::WorkerPool(unsigned n){
+    if(n == 0){
+        n = std::max(1u, std::thread::hardware_concurrency());
+    }
+
+    for(unsigned i = 1; i < n; i++){
+        threads.emplace_back([this]{ loop(); });
+    }
+}
+
+WorkerPool::~WorkerPool(){
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        quit = true;
+    }
+    started.notify_all();
+
+    for(std::thread& t : threads){
+        t.join();
+    }
+}
+
+void WorkerPool::parallelFor(std::size_t n, const std::function<void(std::size_t)>& f){
+    if(threads.empty()){
+        for(std::size_t i = 0; i < n; i++){
+            f(i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock{mutex};
+        task = &f;
+        count = n;
+        next = 0;
+        arrived = 0;
+        generation++;
+    }
+    started.notify_all();
+
+    work();
+
+    std::unique_lock<std::mutex> lock{mutex};
+    finished.wait(lock, [this]{ return arrived == threads.size(); });
+}
+
+unsigned WorkerPool::size() const{
+    return static_cast<unsigned>(threads.size() + 1);
+}
+
+void WorkerPool::loop(){
+    std::size_t seen = 0;
+
+    while(true){
+        {
+            std::unique_lock<std::mutex> lock{mutex};
+            started.wait(lock, [this, seen]{ return quit || generation != seen; });
+
+            if(quit){
+                return;
+            }
+
+            seen = generation;
+        }
+
+        work();
+
+        std::lock_guard<std::mutex> lock{mutex};
+        if(++arrived == threads.size()){
+            finished.notify_one();
+        }
+    }
+}
+
+//Take indices until there are none left
+void WorkerPool::work(){
+    for(std::size_t i = next.fetch_add(1); i < count; i = next.fetch_add(1)){
+        (*task)(i);
+    }
+}
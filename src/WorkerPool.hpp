@@ -0,0 +1,46 @@
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+//A fixed set of threads running one task over a range of indices,
+//for work that splits into independent pieces every frame.
+//Threads are started once and sleep between calls.
+class WorkerPool{
+    public:
+        //0 threads means one per hardware thread. The caller of parallelFor counts as one.
+        explicit WorkerPool(unsigned threads = 0);
+        ~WorkerPool();
+        WorkerPool(const WorkerPool&) = delete;
+        WorkerPool& operator=(const WorkerPool&) = delete;
+
+        //Call task(i) for every i below count, spread over the threads,
+        //and return when all are done. Only from one thread at a time.
+        void parallelFor(std::size_t count, const std::function<void(std::size_t)>& task);
+
+        unsigned size() const;
+
+    private:
+        std::vector<std::thread> threads;
+
+        //Set by parallelFor before a new generation starts, read by the workers after
+        const std::function<void(std::size_t)>* task = nullptr;
+        std::size_t count = 0;
+        std::atomic<std::size_t> next{0};
+
+        //Every worker takes part in every generation,
+        //so none can still be in the previous one when the next starts
+        std::mutex mutex;
+        std::condition_variable started;
+        std::condition_variable finished;
+        std::size_t generation = 0;
+        std::size_t arrived = 0;
+        bool quit = false;
+
+        void loop();
+        void work();
+};
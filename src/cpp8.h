@@ -0,0 +1,69 @@
+/*
+ * C interface to the headless interpreter (Chip8Env).
+ * Works without SDL or SFML, link against cpp8lib only.
+ *
+ * Typical use:
+ *   cpp8_env* env = cpp8_env_create(romBytes, romSize);
+ *   cpp8_env_reset(env, seed);
+ *   while(!cpp8_env_step(env, keys, 4, &reward)){ ... read cpp8_env_screen_plane(env, 0) ... }
+ *   cpp8_env_destroy(env);
+ */
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct cpp8_env cpp8_env;
+
+/* Called after every emulated frame with a pointer to the RAM, cpp8_env_ram_size bytes */
+typedef float (*cpp8_reward_fn)(const uint8_t* ram, void* user);
+typedef int (*cpp8_done_fn)(const uint8_t* ram, void* user);
+
+/* Return NULL if the ROM can't be read or doesn't fit in memory */
+cpp8_env* cpp8_env_create(const uint8_t* rom, size_t size);
+cpp8_env* cpp8_env_create_from_file(const char* path);
+void cpp8_env_destroy(cpp8_env* env);
+
+/* Power-on state. The same seed and actions always give the same episode. */
+void cpp8_env_reset(cpp8_env* env, unsigned seed);
+
+/* Hold the keys in action_mask (bit n is key n) for the given amount of 60hz frames.
+ * The summed reward is stored in *reward if it's not NULL.
+ * Returns non-zero when the episode is over. */
+int cpp8_env_step(cpp8_env* env, uint16_t action_mask, int frames, float* reward);
+
+/* Pass NULL to remove a function */
+void cpp8_env_set_reward_fn(cpp8_env* env, cpp8_reward_fn fn, void* user);
+void cpp8_env_set_done_fn(cpp8_env* env, cpp8_done_fn fn, void* user);
+
+/* These stay valid until cpp8_env_destroy, and nothing is copied.
+ * RAM is cpp8_env_ram_size bytes: 4096, or 65536 in XO-CHIP.
+ * The screen is 64x32, cpp8_env_width by cpp8_env_height. While cpp8_env_hires is non-zero
+ * (SUPER-CHIP 128x64 mode) it is twice as wide and twice as high:
+ * cpp8_env_screen_width and cpp8_env_screen_height give the current size. */
+uint8_t* cpp8_env_ram(cpp8_env* env);
+size_t cpp8_env_ram_size(const cpp8_env* env);
+int cpp8_env_width(void);
+int cpp8_env_height(void);
+int cpp8_env_hires(const cpp8_env* env);
+int cpp8_env_screen_width(const cpp8_env* env);
+int cpp8_env_screen_height(const cpp8_env* env);
+
+/* The screen as the machine keeps it, 1 bit per pixel in cpp8_env_screen_planes planes.
+ * Each plane is a row after another of cpp8_env_screen_words_per_row 64-bit words,
+ * the leftmost pixel in the highest bit. Only XO-CHIP draws to plane 1.
+ * The pointers stay valid until cpp8_env_destroy and always show the current screen. */
+const uint64_t* cpp8_env_screen_plane(const cpp8_env* env, int plane);
+int cpp8_env_screen_planes(void);
+int cpp8_env_screen_words_per_row(const cpp8_env* env);
+
+/* Unpack the screen to out, which must hold screen_width*screen_height bytes:
+ * 1 for a pixel lit in either plane, 0 otherwise, row by row. */
+void cpp8_env_unpack_framebuffer(const cpp8_env* env, uint8_t* out);
+
+#ifdef __cplusplus
+}
+#endif
@@ -3,48 +3,274 @@
 using Chip8_Implementation = Chip8_SFML;
 #else
 #include "Chip8_SDL.hpp"
+#include "Chip8Grid.hpp"
 using Chip8_Implementation = Chip8_SDL;
 #endif
 
+#include "RomDatabase.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
 #include <iostream>
 #include <string>
 
+//Instructions kept in the trace file, 16 bytes each
+constexpr std::size_t traceRecords = 1 << 22;
+
+//ROM database looked for in the working directory when -r isn't given
+const std::string defaultRomDatabase{"cpp8.romdb"};
+
+//Settings from the command line.
+//The empty ones are taken from the ROM database, if the game is in it.
+struct Options{
+    std::optional<Chip8::Quirks> quirks;
+    std::optional<int> scale;
+    std::optional<int> hz;
+    bool vipTiming = false;
+    Upscaler::Filter filter = Upscaler::Filter::NONE;
+    std::string romDatabase;
+    std::string traceFile;
+    bool debug = false;
+    std::string debugSocket;
+    bool latency = false;
+    std::string statsFile;
+    bool overlay = false;
+    std::string videoFile;
+};
+
 //Very const-correct do not touch
-void parseOptions(int argc, char const * const * const argv, bool& chip48, int& resolutionScale);
+//Options start at argv[first]
+void parseOptions(int argc, char const * const * const argv, int first, Options& options);
+
+//The ROM's settings from the database, the defaults if it isn't in it
+RomEntry lookUp(const std::string& romFilename, const Options& options);
+
+//Apply the ROM's settings, command line settings win over the database
+void configure(Chip8& chip8, const Options& options, const RomEntry& settings);
+
+//cpp8 --grid <columns>x<rows> rom... [options]
+int runGrid(int argc, char** argv);
+
+//Both ways to run cpp8 and every option, the README has the details
+void printUsage(const char* program);
 
 int main(int argc, char** argv){
     //If no rom path provided
     if(argc < 2){
-        std::cout << "Usage: " << argv[0] << " <chip8_rom> [chip48]" << std::endl;
+        printUsage(argv[0]);
+    }
+    else if(std::string{argv[1]} == "--grid"){
+        return runGrid(argc, argv);
     }
     else{
-        //Default chip8 options
-        bool chip48 = false;
-        int scale = 10;
+        //Read options from command line
+        Options options;
+        parseOptions(argc, argv, 2, options);
 
-        //Read options from command line and initialize chip8
-        parseOptions(argc, argv, chip48, scale);
-        Chip8_Implementation chip8{argv[1], scale};
-        chip8.setChip48(chip48);
+        //Look the game up, the database is optional unless given with -r
+        RomEntry settings = lookUp(argv[1], options);
+
+        Chip8_Implementation chip8{argv[1], options.scale.value_or(settings.scale ? settings.scale : 10), options.filter};
+        configure(chip8, options, settings);
+
+        if(!options.traceFile.empty()){
+            chip8.enableTrace(options.traceFile, traceRecords);
+        }
+
+        if(!options.debugSocket.empty()){
+            chip8.attachDebugger(Chip8Debugger::listen(options.debugSocket));
+        }
+        else if(options.debug){
+            chip8.attachDebugger(std::make_unique<Chip8Debugger>(stdin, stdout));
+        }
+
+        if(options.latency){
+            chip8.enableLatencyProbe();
+        }
+
+        if(!options.statsFile.empty() || options.overlay){
+            chip8.enableMetrics(options.statsFile, options.overlay);
+        }
+
+        if(!options.videoFile.empty()){
+            chip8.enableRecording(options.videoFile);
+        }
 
         //Run the interpreter
         chip8.run();
+
+        if(options.latency){
+            chip8.getLatencyProbe()->print(std::cout);
+        }
     }
 
     return 0;
 }
 
-void parseOptions(int argc, char const * const * const argv, bool& chip48, int& resolutionScale){
-    //argv[1] is the rom filename
-    for(int i = 2; i < argc; i++){
+RomEntry lookUp(const std::string& romFilename, const Options& options){
+    RomEntry settings = RomDatabase::defaultEntry(0);
+
+    if(!options.romDatabase.empty() || std::ifstream{defaultRomDatabase}){
+        RomDatabase db{options.romDatabase.empty() ? defaultRomDatabase : options.romDatabase};
+        std::optional<std::uint64_t> hash = RomDatabase::hashFile(romFilename);
+
+        if(const RomEntry* entry = hash ? db.find(*hash) : nullptr; entry){
+            settings = *entry;
+        }
+    }
+
+    return settings;
+}
+
+void configure(Chip8& chip8, const Options& options, const RomEntry& settings){
+    chip8.setQuirks(options.quirks.value_or(Chip8::Quirks::fromBits(settings.quirks)));
+    chip8.setHz(options.hz.value_or(settings.hz ? settings.hz : chip8.getHz()));
+    chip8.setVipTiming(options.vipTiming);
+    chip8.setColors(settings.foreground, settings.background);
+
+    std::array<std::uint8_t, 16> layout;
+    std::copy(std::begin(settings.keys), std::end(settings.keys), layout.begin());
+    chip8.setKeyLayout(layout);
+}
+
+int runGrid(int argc, char** argv){
+    int columns = 0, rows = 0;
+    if(argc < 4 || std::sscanf(argv[2], "%dx%d", &columns, &rows) != 2 || columns < 1 || rows < 1){
+        printUsage(argv[0]);
+        return 2;
+    }
+
+    #ifdef SFML
+    std::cerr << "Grid mode needs the SDL2 frontend\n";
+    return 1;
+    #else
+
+    //ROMs until the first option
+    int first = 3;
+    while(first < argc && argv[first][0] != '-' && std::string{argv[first]} != "chip48"){
+        first++;
+    }
+
+    Options options;
+    parseOptions(argc, argv, first, options);
+
+    //A cell is small, a scale of 10 would make a 4x4 grid bigger than most screens
+    Chip8Grid grid{columns, rows, options.scale.value_or(std::max(2, 10 / std::max(columns, rows))), options.filter};
+
+    for(int i = 3; i < first; i++){
+        //rom@quirks runs the ROM with its own quirks, to compare them side by side
+        std::string rom{argv[i]};
+        Options cellOptions = options;
+
+        if(std::size_t at = rom.rfind('@'); at != std::string::npos){
+            if(std::optional<Chip8::Quirks> q = Chip8::Quirks::parse(rom.substr(at + 1)); q){
+                cellOptions.quirks = *q;
+                rom.resize(at);
+            }
+        }
+
+        Chip8* chip8 = grid.add(rom);
+        if(chip8 == nullptr){
+            std::cerr << "Only " << columns * rows << " ROMs fit in a " << argv[2] << " grid\n";
+            break;
+        }
+
+        configure(*chip8, cellOptions, lookUp(rom, cellOptions));
+    }
+
+    grid.run();
+    return 0;
+
+    #endif
+}
+
+void printUsage(const char* program){
+    std::cout << "Usage: " << program << " <chip8_rom> [options]\n"
+              << "       " << program << " --grid <columns>x<rows> <chip8_rom>[@quirks]... [options]\n"
+              << "\n"
+              << "Options:\n"
+              << "  -q <quirks>      a profile (default, vip, chip48, schip, xochip) or a list like shift,clip\n"
+              << "  chip48           Chip-48 shifts, same as -q chip48\n"
+              << "  -f <hz>          instructions per second, 500 by default\n"
+              << "  -c               COSMAC VIP speed: instructions cost the cycles they took there\n"
+              << "  -s <scale>       multiplies the 64x32 resolution\n"
+              << "  -u <filter>      upscaler: none, scale2x, scale3x, scale4x, hq2x, hq3x, hq4x\n"
+              << "  -r <romdb>       ROM database, cpp8.romdb in the working directory if there is one\n"
+              << "  -t <traceFile>   write every executed instruction, decode it with cpp8-trace\n"
+              << "  -d               start stopped in the debugger, reading commands from the console\n"
+              << "  -D <socketPath>  same, reading commands from a client on a Unix socket\n"
+              << "  -l               measure the latency from each key press to the screen\n"
+              << "  -m <statsFile>   write runtime metrics every second, to the console with -\n"
+              << "  -o               show the metrics over the game\n"
+              << "  -v <videoFile>   record every frame, convert it with cpp8-frames" << std::endl;
+}
+
+void parseOptions(int argc, char const * const * const argv, int first, Options& options){
+    for(int i = first; i < argc; i++){
         const std::string param{argv[i]};
 
         if(param == "chip48"){
-            chip48 = true;
+            Chip8::Quirks q = options.quirks.value_or(Chip8::Quirks{});
+            q.shiftVx = true;
+            options.quirks = q;
+        }
+        else if(param == "-q" && i < argc - 1){
+            i++;
+            if(std::optional<Chip8::Quirks> q = Chip8::Quirks::parse(argv[i]); q){
+                options.quirks = *q;
+            }
+            else{
+                std::cerr << "Unknown quirks \"" << argv[i] << "\"\n";
+            }
         }
         else if(param == "-s" && i < argc - 1){
             i++;
-            resolutionScale = std::atoi(argv[i]);
+            options.scale = std::atoi(argv[i]);
+        }
+        else if(param == "-u" && i < argc - 1){
+            i++;
+            if(std::optional<Upscaler::Filter> f = Upscaler::parse(argv[i]); f){
+                options.filter = *f;
+            }
+            else{
+                std::cerr << "Unknown filter \"" << argv[i] << "\"\n";
+            }
+        }
+        else if(param == "-f" && i < argc - 1){
+            i++;
+            options.hz = std::atoi(argv[i]);
+        }
+        else if(param == "-c"){
+            options.vipTiming = true;
+        }
+        else if(param == "-r" && i < argc - 1){
+            i++;
+            options.romDatabase = argv[i];
+        }
+        else if(param == "-t" && i < argc - 1){
+            i++;
+            options.traceFile = argv[i];
+        }
+        else if(param == "-d"){
+            options.debug = true;
+        }
+        else if(param == "-D" && i < argc - 1){
+            i++;
+            options.debugSocket = argv[i];
+        }
+        else if(param == "-l"){
+            options.latency = true;
+        }
+        else if(param == "-m" && i < argc - 1){
+            i++;
+            options.statsFile = argv[i];
+        }
+        else if(param == "-o"){
+            options.overlay = true;
+        }
+        else if(param == "-v" && i < argc - 1){
+            i++;
+            options.videoFile = argv[i];
         }
     }
-}
\ No newline at end of file
+}
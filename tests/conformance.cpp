@@ -0,0 +1,727 @@
+//Golden-frame conformance suite.
+//Every case runs a small ROM headless for a fixed amount of frames,
+//then the framebuffer, registers and RAM are hashed and compared
+//against the hash stored in the goldens file.
+//Each case is run with and without instruction fusion, and both runs must agree.
+//
+//Usage: cpp8-conformance <goldens file> [--update] [rom.ch8 ...]
+//--update rewrites the goldens file with the current results.
+//Extra ROM files are run too, once per profile, and are named after their path.
+
+#include "Chip8Env.hpp"
+#include "Fusion.hpp"
+#include "Hash.hpp"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace{
+    //Keys held for some frames
+    struct Input{
+        std::uint16_t keys;
+        int frames;
+    };
+
+    //A byte written through Chip8Env::ram(), from outside the interpreter,
+    //after the input of the schedule at index after
+    struct Patch{
+        std::size_t after;
+        std::uint16_t address;
+        std::uint8_t value;
+    };
+
+    struct Case{
+        std::string name;
+        std::vector<std::uint8_t> rom;
+        Chip8::Quirks quirks = {};
+        std::vector<Input> schedule = {{0, 60}};
+        bool vipTiming = false;
+
+        //Sequences of Fusion.hpp the ROM must have at these addresses,
+        //so that the fused run really runs them
+        std::vector<std::pair<std::uint16_t, FusionId>> fusions = {};
+        std::vector<Patch> patches = {};
+    };
+
+    //Extra ROMs are run once for each of these
+    const char* profiles[] = {"default", "vip", "chip48", "schip"};
+
+    Chip8::Quirks profile(const char* name){
+        return *Chip8::Quirks::parse(name);
+    }
+
+    struct Result{
+        std::uint64_t hash = 0;
+        std::string error;
+    };
+
+    //Hand assembled ROMs. Each one halts by jumping to itself, or with the SUPER-CHIP 00FD.
+    std::vector<Case> builtinCases(){
+        std::vector<Case> cases;
+
+        //Logic and arithmetic, results are stored at 0x400
+        cases.push_back({"alu", {
+            0x6A, 0x0F,     //200 LD VA, 0F
+            0x6B, 0xF0,     //202 LD VB, F0
+            0x80, 0xA0,     //204 LD V0, VA
+            0x80, 0xB1,     //206 OR V0, VB     V0 = FF
+            0x81, 0xA0,     //208 LD V1, VA
+            0x81, 0xB2,     //20A AND V1, VB    V1 = 00
+            0x82, 0xA0,     //20C LD V2, VA
+            0x82, 0xB3,     //20E XOR V2, VB    V2 = FF
+            0x63, 0xC8,     //210 LD V3, 200
+            0x73, 0x64,     //212 ADD V3, 100   V3 = 44, VF untouched
+            0x64, 0xC8,     //214 LD V4, 200
+            0x65, 0x64,     //216 LD V5, 100
+            0x84, 0x54,     //218 ADD V4, V5    V4 = 44, VF = 1
+            0x86, 0xF0,     //21A LD V6, VF
+            0x67, 0x0A,     //21C LD V7, 10
+            0x68, 0x14,     //21E LD V8, 20
+            0x87, 0x85,     //220 SUB V7, V8    V7 = F6, VF = 0
+            0x89, 0xF0,     //222 LD V9, VF
+            0x6C, 0x05,     //224 LD VC, 5
+            0x6D, 0x03,     //226 LD VD, 3
+            0x8C, 0xD7,     //228 SUBN VC, VD   VC = FE, VF = 0
+            0x8E, 0xF0,     //22A LD VE, VF
+            0xA4, 0x00,     //22C LD I, 400
+            0xFE, 0x55,     //22E LD [I], VE
+            0x12, 0x30,     //230 JP 230
+        }});
+
+        //VF as an operand of flag setting instructions, the flag must win
+        cases.push_back({"vf_operand", {
+            0x6F, 0xFF,     //200 LD VF, FF
+            0x61, 0x01,     //202 LD V1, 1
+            0x8F, 0x14,     //204 ADD VF, V1    VF = 1 (carry)
+            0x80, 0xF0,     //206 LD V0, VF
+            0x6F, 0x05,     //208 LD VF, 5
+            0x62, 0x07,     //20A LD V2, 7
+            0x8F, 0x25,     //20C SUB VF, V2    VF = 0 (borrow)
+            0x83, 0xF0,     //20E LD V3, VF
+            0x6F, 0x03,     //210 LD VF, 3
+            0x8F, 0x27,     //212 SUBN VF, V2   VF = 1 (no borrow)
+            0x84, 0xF0,     //214 LD V4, VF
+            0x6F, 0x02,     //216 LD VF, 2
+            0x8F, 0xF6,     //218 SHR VF        VF = 0
+            0x85, 0xF0,     //21A LD V5, VF
+            0x6F, 0x81,     //21C LD VF, 81
+            0x8F, 0xFE,     //21E SHL VF        VF = 1
+            0x86, 0xF0,     //220 LD V6, VF
+            0x12, 0x22,     //222 JP 222
+        }});
+
+        //8XY6 and 8XYE, run with both shift behaviours
+        std::vector<std::uint8_t> shifts{
+            0x61, 0x81,     //200 LD V1, 81
+            0x62, 0x40,     //202 LD V2, 40
+            0x81, 0x26,     //204 SHR V1, V2    chip8: V1 = 20 VF = 0, chip48: V1 = 40 VF = 1
+            0x83, 0xF0,     //206 LD V3, VF
+            0x64, 0x81,     //208 LD V4, 81
+            0x65, 0x40,     //20A LD V5, 40
+            0x84, 0x5E,     //20C SHL V4, V5    chip8: V4 = 80 VF = 0, chip48: V4 = 02 VF = 1
+            0x86, 0xF0,     //20E LD V6, VF
+            0x12, 0x10,     //210 JP 210
+        };
+        cases.push_back({"shift_chip8", shifts, profile("default")});
+        cases.push_back({"shift_chip48", shifts, profile("chip48")});
+
+        //Conditional skips, V0 ends up as 2A
+        cases.push_back({"skips", {
+            0x60, 0x00,     //200 LD V0, 0
+            0x61, 0x05,     //202 LD V1, 5
+            0x31, 0x05,     //204 SE V1, 5      skip
+            0x70, 0x01,     //206 ADD V0, 1
+            0x31, 0x06,     //208 SE V1, 6
+            0x70, 0x02,     //20A ADD V0, 2
+            0x41, 0x06,     //20C SNE V1, 6     skip
+            0x70, 0x04,     //20E ADD V0, 4
+            0x41, 0x05,     //210 SNE V1, 5
+            0x70, 0x08,     //212 ADD V0, 8
+            0x62, 0x05,     //214 LD V2, 5
+            0x51, 0x20,     //216 SE V1, V2     skip
+            0x70, 0x10,     //218 ADD V0, 10
+            0x91, 0x20,     //21A SNE V1, V2
+            0x70, 0x20,     //21C ADD V0, 20
+            0x12, 0x1E,     //21E JP 21E
+        }});
+
+        //Nested calls, V0 ends up as 13
+        cases.push_back({"call_ret", {
+            0x60, 0x00,     //200 LD V0, 0
+            0x22, 0x08,     //202 CALL 208
+            0x70, 0x10,     //204 ADD V0, 10
+            0x12, 0x06,     //206 JP 206
+            0x70, 0x01,     //208 ADD V0, 1
+            0x22, 0x0E,     //20A CALL 20E
+            0x00, 0xEE,     //20C RET
+            0x70, 0x02,     //20E ADD V0, 2
+            0x00, 0xEE,     //210 RET
+        }});
+
+        //BNNN, the LD V1 are skipped
+        cases.push_back({"jump_v0", {
+            0x60, 0x04,     //200 LD V0, 4
+            0xB2, 0x06,     //202 JP V0, 206    to 20A
+            0x61, 0xFF,     //204 LD V1, FF
+            0x61, 0xFF,     //206 LD V1, FF
+            0x61, 0xFF,     //208 LD V1, FF
+            0x62, 0xAA,     //20A LD V2, AA
+            0x12, 0x0C,     //20C JP 20C
+        }});
+
+        //Sprite drawing and collision flag
+        cases.push_back({"draw_collision", {
+            0xA2, 0x18,     //200 LD I, 218
+            0x60, 0x08,     //202 LD V0, 8
+            0x61, 0x04,     //204 LD V1, 4
+            0xD0, 0x14,     //206 DRW V0, V1, 4     VF = 0
+            0x82, 0xF0,     //208 LD V2, VF
+            0xD0, 0x14,     //20A DRW V0, V1, 4     erased, VF = 1
+            0x83, 0xF0,     //20C LD V3, VF
+            0xD0, 0x14,     //20E DRW V0, V1, 4     VF = 0
+            0x60, 0x0A,     //210 LD V0, 10
+            0xD0, 0x14,     //212 DRW V0, V1, 4     overlaps, VF = 1
+            0x84, 0xF0,     //214 LD V4, VF
+            0x12, 0x16,     //216 JP 216
+            0xF0, 0x90,     //218 sprite
+            0x90, 0xF0,
+        }});
+
+        //BCD, register load and font sprites, draws "254"
+        cases.push_back({"bcd_font", {
+            0x60, 0xFE,     //200 LD V0, 254
+            0xA3, 0x00,     //202 LD I, 300
+            0xF0, 0x33,     //204 LD B, V0
+            0xF2, 0x65,     //206 LD V2, [I]    V0 = 2, V1 = 5, V2 = 4
+            0x63, 0x00,     //208 LD V3, 0
+            0x64, 0x00,     //20A LD V4, 0
+            0xF0, 0x29,     //20C LD F, V0
+            0xD3, 0x45,     //20E DRW V3, V4, 5
+            0x73, 0x05,     //210 ADD V3, 5
+            0xF1, 0x29,     //212 LD F, V1
+            0xD3, 0x45,     //214 DRW V3, V4, 5
+            0x73, 0x05,     //216 ADD V3, 5
+            0xF2, 0x29,     //218 LD F, V2
+            0xD3, 0x45,     //21A DRW V3, V4, 5
+            0x12, 0x1C,     //21C JP 21C
+        }});
+
+        //Register store and load, ADD I
+        cases.push_back({"memory", {
+            0x60, 0x11,     //200 LD V0, 11
+            0x61, 0x22,     //202 LD V1, 22
+            0x62, 0x33,     //204 LD V2, 33
+            0xA4, 0x00,     //206 LD I, 400
+            0xF2, 0x55,     //208 LD [I], V2
+            0x63, 0x01,     //20A LD V3, 1
+            0xF3, 0x1E,     //20C ADD I, V3
+            0xF1, 0x65,     //20E LD V1, [I]    V0 = 22, V1 = 33
+            0x12, 0x10,     //210 JP 210
+        }});
+
+        //Delay timer countdown, V1 counts the polls until it reaches 0
+        cases.push_back({"timers", {
+            0x60, 0x0A,     //200 LD V0, 10
+            0xF0, 0x15,     //202 LD DT, V0
+            0x61, 0x00,     //204 LD V1, 0
+            0xF2, 0x07,     //206 LD V2, DT
+            0x71, 0x01,     //208 ADD V1, 1
+            0x32, 0x00,     //20A SE V2, 0
+            0x12, 0x06,     //20C JP 206
+            0x63, 0x03,     //20E LD V3, 3
+            0xF3, 0x18,     //210 LD ST, V3
+            0x12, 0x12,     //212 JP 212
+        }});
+
+        //Key skips with key 5 held, then key 7 is pressed while waiting
+        cases.push_back({"keys", {
+            0x60, 0x05,     //200 LD V0, 5
+            0x61, 0x06,     //202 LD V1, 6
+            0x62, 0x00,     //204 LD V2, 0
+            0xE0, 0x9E,     //206 SKP V0        skip
+            0x72, 0x01,     //208 ADD V2, 1
+            0xE1, 0xA1,     //20A SKNP V1       skip
+            0x72, 0x02,     //20C ADD V2, 2
+            0xE0, 0xA1,     //20E SKNP V0
+            0x72, 0x04,     //210 ADD V2, 4
+            0xE1, 0x9E,     //212 SKP V1
+            0x72, 0x08,     //214 ADD V2, 8
+            0xF3, 0x0A,     //216 LD V3, K      V3 = 7
+            0x12, 0x18,     //218 JP 218
+        }, {}, {{1 << 5, 5}, {(1 << 5) | (1 << 7), 5}}});
+
+        //VF reset after logic instructions and I increment after FX55/FX65
+        std::vector<std::uint8_t> logicMem{
+            0x60, 0xF0,     //200 LD V0, F0
+            0x61, 0x0F,     //202 LD V1, 0F
+            0x6F, 0x05,     //204 LD VF, 5
+            0x80, 0x11,     //206 OR V0, V1     vip: VF = 0
+            0x82, 0xF0,     //208 LD V2, VF
+            0x6F, 0x05,     //20A LD VF, 5
+            0x80, 0x12,     //20C AND V0, V1    vip: VF = 0
+            0x83, 0xF0,     //20E LD V3, VF
+            0x6F, 0x05,     //210 LD VF, 5
+            0x80, 0x13,     //212 XOR V0, V1    vip: VF = 0
+            0x84, 0xF0,     //214 LD V4, VF
+            0xA4, 0x00,     //216 LD I, 400
+            0xF1, 0x55,     //218 LD [I], V1    vip: I = 402
+            0xF1, 0x65,     //21A LD V1, [I]    vip: V0 = V1 = 0, I = 404
+            0x12, 0x1C,     //21C JP 21C
+        };
+        cases.push_back({"quirk_logic_mem_default", logicMem, profile("default")});
+        cases.push_back({"quirk_logic_mem_vip", logicMem, profile("vip")});
+
+        //BNNN and BXNN
+        std::vector<std::uint8_t> jump{
+            0x60, 0x02,     //200 LD V0, 2
+            0x62, 0x04,     //202 LD V2, 4
+            0xB2, 0x08,     //204 JP V0, 208    default: to 20A, schip: to 20C
+            0x12, 0x06,     //206 JP 206
+            0x12, 0x08,     //208 JP 208
+            0x63, 0xAA,     //20A LD V3, AA
+            0x64, 0xBB,     //20C LD V4, BB
+            0x12, 0x0E,     //20E JP 20E
+        };
+        cases.push_back({"quirk_jump_default", jump, profile("default")});
+        cases.push_back({"quirk_jump_schip", jump, profile("schip")});
+
+        //Sprites crossing the screen edges wrap around, or are clipped
+        std::vector<std::uint8_t> edges{
+            0xA2, 0x10,     //200 LD I, 210
+            0x60, 0x3C,     //202 LD V0, 60
+            0x61, 0x1E,     //204 LD V1, 30
+            0xD0, 0x14,     //206 DRW V0, V1, 4     crosses the right and bottom edges
+            0x60, 0x43,     //208 LD V0, 67
+            0x61, 0x05,     //20A LD V1, 5
+            0xD0, 0x14,     //20C DRW V0, V1, 4     starts off screen, always wraps to x = 3
+            0x12, 0x0E,     //20E JP 20E
+            0xFF, 0x81,     //210 sprite
+            0x81, 0xFF,
+        };
+        cases.push_back({"draw_edges_wrap", edges, profile("default")});
+        cases.push_back({"draw_edges_clip", edges, profile("vip")});
+
+        //SUPER-CHIP high resolution: 16x16 sprites, the big font, scrolling and the RPL flags
+        std::vector<std::uint8_t> hires{
+            0x00, 0xFF,     //200 HIGH
+            0xA2, 0x40,     //202 LD I, 240
+            0x60, 0x78,     //204 LD V0, 120
+            0x61, 0x3A,     //206 LD V1, 58
+            0xD0, 0x10,     //208 DRW V0, V1, 0     16x16, crosses the right and bottom edges
+            0x62, 0x05,     //20A LD V2, 5
+            0xF2, 0x30,     //20C LD HF, V2
+            0x63, 0x10,     //20E LD V3, 16
+            0x64, 0x08,     //210 LD V4, 8
+            0xD3, 0x4A,     //212 DRW V3, V4, 10    big 5
+            0x00, 0xC3,     //214 SCD 3
+            0x00, 0xFB,     //216 SCR
+            0x00, 0xFB,     //218 SCR
+            0x00, 0xFC,     //21A SCL
+            0xF4, 0x75,     //21C LD R, V4
+            0x60, 0x00,     //21E LD V0, 0
+            0x64, 0x00,     //220 LD V4, 0
+            0xF4, 0x85,     //222 LD V4, R          V0 and V4 are back
+            0x00, 0xFD,     //224 EXIT
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xFF, 0xFF,     //240 16x16 sprite, a box
+            0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+            0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+            0xFF, 0xFF,
+        };
+        cases.push_back({"schip_hires_wrap", hires, profile("default")});
+        cases.push_back({"schip_hires_clip", hires, profile("vip")});
+
+        //Back to low resolution, which clears the screen, then the same in 64x32
+        std::vector<std::uint8_t> lores{
+            0x00, 0xFF,     //200 HIGH
+            0xA2, 0x20,     //202 LD I, 220
+            0xD0, 0x00,     //204 DRW V0, V0, 0
+            0x00, 0xFE,     //206 LOW               clears the screen
+            0x60, 0x3C,     //208 LD V0, 60
+            0x61, 0x1C,     //20A LD V1, 28
+            0xD0, 0x10,     //20C DRW V0, V1, 0     16x16, crosses the right and bottom edges
+            0x00, 0xC2,     //20E SCD 2
+            0x00, 0xFC,     //210 SCL
+            0x00, 0xFD,     //212 EXIT
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,   //220 16x16 sprite, a checkerboard
+            0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,
+            0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,
+            0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,
+        };
+        cases.push_back({"schip_lores_wrap", lores, profile("default")});
+        cases.push_back({"schip_lores_clip", lores, profile("vip")});
+
+        //XO-CHIP memory: F000 NNNN past 4KB, 5XY2 and 5XY3 both ways, stores wrapping
+        //around the 64KB, the audio registers, and skips over F000 NNNN, fused or not
+        cases.push_back({"xo_memory", {
+            0x60, 0x11,     //200 LD V0, 11
+            0x61, 0x22,     //202 LD V1, 22
+            0x62, 0x33,     //204 LD V2, 33
+            0xF0, 0x00,     //206 LD I, LONG 1234
+            0x12, 0x34,
+            0x50, 0x22,     //20A SAVE V0 - V2     1234 = 11 22 33
+            0x55, 0x33,     //20C LOAD V5 - V3     V5 = 11, V4 = 22, V3 = 33
+            0x30, 0x11,     //20E SE V0, 11        skips all 4 bytes
+            0xF0, 0x00,     //210 LD I, LONG 0FFF  as 2 instructions, 0FFF would be HIGH
+            0x0F, 0xFF,
+            0xF0, 0x00,     //214 LD I, LONG FFFE
+            0xFF, 0xFE,
+            0xF2, 0x55,     //218 LD [I], V2       FFFE = 11, FFFF = 22, 0000 = 33, I = 0001
+            0xF0, 0x02,     //21A AUDIO
+            0x67, 0x70,     //21C LD V7, 70
+            0xF7, 0x3A,     //21E PITCH V7
+            0x6A, 0x00,     //220 LD VA, 0
+            0x7A, 0x01,     //222 ADD VA, 1         7XKK 3XKK
+            0x3A, 0x01,     //224 SE VA, 1          skips all 4 bytes
+            0xF0, 0x00,     //226 LD I, LONG 6B55   as 2 instructions, 6B55 would be LD VB, 55
+            0x6B, 0x55,
+            0x12, 0x2A,     //22A JP 22A
+        }, profile("xochip")});
+
+        //XO-CHIP bitplanes: drawing to either plane or both, and scrolling and clearing only the selected ones
+        cases.push_back({"xo_planes", {
+            0xA2, 0x30,     //200 LD I, 230
+            0xF3, 0x01,     //202 PLANE 3
+            0x60, 0x04,     //204 LD V0, 4
+            0x61, 0x02,     //206 LD V1, 2
+            0xD0, 0x12,     //208 DRW V0, V1, 2     230 to the first plane, 232 to the second
+            0x82, 0xF0,     //20A LD V2, VF         0
+            0xF1, 0x01,     //20C PLANE 1
+            0xD0, 0x12,     //20E DRW V0, V1, 2     erases the first plane, VF = 1
+            0x83, 0xF0,     //210 LD V3, VF
+            0xF2, 0x01,     //212 PLANE 2
+            0x00, 0xD1,     //214 SCU 1
+            0x00, 0xFB,     //216 SCR
+            0xF1, 0x01,     //218 PLANE 1
+            0x60, 0x0A,     //21A LD V0, 10
+            0xD0, 0x14,     //21C DRW V0, V1, 4
+            0xF0, 0x01,     //21E PLANE 0
+            0xD0, 0x14,     //220 DRW V0, V1, 4     no plane, nothing drawn, VF = 0
+            0x84, 0xF0,     //222 LD V4, VF
+            0xF3, 0x01,     //224 PLANE 3
+            0x00, 0xC1,     //226 SCD 1
+            0x12, 0x28,     //228 JP 228
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xF0, 0x90,     //230 sprites
+            0x0F, 0x09,
+        }, profile("xochip")});
+
+        //XO-CHIP 16x16 sprites in both planes in high resolution, 32 bytes each
+        std::vector<std::uint8_t> xoHires{
+            0x00, 0xFF,     //200 HIGH
+            0xA2, 0x10,     //202 LD I, 210
+            0xF3, 0x01,     //204 PLANE 3
+            0x60, 0x7C,     //206 LD V0, 124
+            0xD0, 0x00,     //208 DRW V0, V0, 0     wraps around both edges
+            0x00, 0xD3,     //20A SCU 3
+            0x00, 0xFC,     //20C SCL
+            0x00, 0xFD,     //20E EXIT
+            0xFF, 0xFF,     //210 16x16 sprite for the first plane, a box
+            0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+            0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01, 0x80, 0x01,
+            0xFF, 0xFF,
+            0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,   //230 and for the second, a checkerboard
+            0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,
+            0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,
+            0xF0, 0x0F, 0x0F, 0xF0, 0xF0, 0x0F, 0x0F, 0xF0,
+        };
+        cases.push_back({"xo_planes_hires", xoHires, profile("xochip")});
+
+        //Stores, loads, sprites and fetches past the end of the 4KB wrap around to 0
+        std::vector<std::uint8_t> wrap{
+            0xAF, 0xFE,     //200 LD I, FFE
+            0x60, 0x07,     //202 LD V0, 7
+            0x61, 0x08,     //204 LD V1, 8
+            0x62, 0x09,     //206 LD V2, 9
+            0xF2, 0x55,     //208 LD [I], V2        FFE, FFF, 000
+            0x63, 0xF9,     //20A LD V3, 249
+            0xAF, 0xFF,     //20C LD I, FFF
+            0xF3, 0x33,     //20E LD B, V3          FFF, 000, 001
+            0xAF, 0xFD,     //210 LD I, FFD
+            0x60, 0x00,     //212 LD V0, 0
+            0x61, 0x00,     //214 LD V1, 0
+            0xD0, 0x15,     //216 DRW V0, V1, 5     FFD to 001
+            0x63, 0x10,     //218 LD V3, 10
+            0xF3, 0x1E,     //21A ADD I, V3         I = 100D, FX1E FY65
+            0xF3, 0x65,     //21C LD V3, [I]        00D to 010
+            0x60, 0x1F,     //21E LD V0, 1F
+            0x61, 0xFE,     //220 LD V1, FE
+            0xAF, 0xFE,     //222 LD I, FFE
+            0xF1, 0x55,     //224 LD [I], V1        FFE becomes JP FFE
+            0x1F, 0xFE,     //226 JP FFE
+        };
+        cases.push_back({"address_wrap_default", wrap, profile("default")});
+        cases.push_back({"address_wrap_vip", wrap, profile("vip")});
+
+        //Every fused sequence, and one overwritten after the ROM was loaded
+        std::vector<std::uint8_t> fusion{
+            0x6A, 0x03,     //200 LD VA, 3          6XKK 6YKK
+            0x6B, 0x05,     //202 LD VB, 5
+            0xA2, 0x40,     //204 LD I, 240         ANNN DXYN
+            0xDA, 0xB5,     //206 DRW VA, VB, 5
+            0x7C, 0x01,     //208 ADD VC, 1         7XKK 3XKK
+            0x3C, 0x10,     //20A SE VC, 16
+            0x12, 0x08,     //20C JP 208
+            0x6D, 0x14,     //20E LD VD, 20
+            0xFD, 0x15,     //210 LD DT, VD
+            0xFE, 0x07,     //212 LD VE, DT         FX07 3X00 1NNN
+            0x3E, 0x00,     //214 SE VE, 0
+            0x12, 0x12,     //216 JP 212
+            0xA2, 0x40,     //218 LD I, 240
+            0x60, 0x02,     //21A LD V0, 2
+            0xF0, 0x1E,     //21C ADD I, V0         FX1E FY65
+            0xF3, 0x65,     //21E LD V3, [I]        vip: I = 246
+            0xA4, 0x00,     //220 LD I, 400
+            0xF3, 0x55,     //222 LD [I], V3
+            0xA2, 0x30,     //224 LD I, 230
+            0x60, 0x7E,     //226 LD V0, 7E
+            0x61, 0x05,     //228 LD V1, 5
+            0xF1, 0x55,     //22A LD [I], V1        230 becomes ADD VE, 5
+            0x12, 0x30,     //22C JP 230
+            0x00, 0x00,     //22E
+            0x6E, 0x01,     //230 LD VE, 1          was 6XKK 6YKK
+            0x6D, 0x02,     //232 LD VD, 2
+            0x12, 0x34,     //234 JP 234
+            0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+            0xF0, 0x90,     //240 sprite
+            0xF0, 0x90,
+            0x90,
+        };
+        const std::vector<std::pair<std::uint16_t, FusionId>> fusionSites{
+            {0x200, FUSE_LOAD_LOAD}, {0x204, FUSE_INDEX_DRAW}, {0x208, FUSE_ADD_SKIP},
+            {0x212, FUSE_WAIT_DELAY}, {0x21C, FUSE_ADD_LOAD}, {0x230, FUSE_LOAD_LOAD},
+        };
+        cases.push_back({"fusion_default", fusion, profile("default"), {{0, 60}}, false, fusionSites});
+        cases.push_back({"fusion_vip", fusion, profile("vip"), {{0, 60}}, false, fusionSites});
+
+        //A fused sequence patched through ram() between frames must not run as it was
+        std::vector<std::uint8_t> patched{
+            0x6A, 0x03,     //200 LD VA, 3          6XKK 6YKK, then ADD VD, 5
+            0x6B, 0x05,     //202 LD VB, 5
+            0x7C, 0x01,     //204 ADD VC, 1
+            0x12, 0x00,     //206 JP 200
+        };
+        cases.push_back({"fusion_patched", patched, profile("default"), {{0, 10}, {0, 10}}, false,
+                         {{0x200, FUSE_LOAD_LOAD}}, {{0, 0x202, 0x7D}}});
+
+        //Instructions per frame, counted for 10 frames while the delay timer runs,
+        //then draws per frame. With VIP timing a frame fits 13 turns of the first loop,
+        //and a DXYN ends the frame.
+        std::vector<std::uint8_t> timing{
+            0x61, 0x0A,     //200 LD V1, 10
+            0xF1, 0x15,     //202 LD DT, V1
+            0x70, 0x01,     //204 ADD V0, 1
+            0xF2, 0x07,     //206 LD V2, DT
+            0x32, 0x00,     //208 SE V2, 0
+            0x12, 0x04,     //20A JP 204
+            0xF1, 0x15,     //20C LD DT, V1
+            0xD3, 0x31,     //20E DRW V3, V3, 1
+            0x74, 0x01,     //210 ADD V4, 1
+            0xF2, 0x07,     //212 LD V2, DT
+            0x32, 0x00,     //214 SE V2, 0
+            0x12, 0x0E,     //216 JP 20E
+            0xA4, 0x00,     //218 LD I, 400
+            0xF4, 0x55,     //21A LD [I], V4
+            0x12, 0x1C,     //21C JP 21C
+        };
+        cases.push_back({"timing_hz", timing, profile("vip")});
+        cases.push_back({"timing_vip", timing, profile("vip"), {{0, 60}}, true});
+
+        return cases;
+    }
+
+    //Hash of everything that matters at the end of a run
+    std::uint64_t stateHash(const Chip8Env& env){
+        std::vector<std::uint8_t> state(env.screenWidth() * env.screenHeight());
+        const std::uint8_t* v = env.registers();
+
+        env.unpackFramebuffer(state.data());
+        state.insert(state.end(), v, v + 16);
+        state.push_back(env.indexRegister() >> 8);
+        state.push_back(env.indexRegister() & 0xFF);
+        state.push_back(env.programCounter() >> 8);
+        state.push_back(env.programCounter() & 0xFF);
+        state.insert(state.end(), env.ram(), env.ram() + env.ramSize());
+
+        //The second plane only exists in XO-CHIP, where it has colors the framebuffer doesn't show
+        if(env.getQuirks().xoChip){
+            const Chip8Screen& screen = env.screen();
+            const auto* plane = reinterpret_cast<const std::uint8_t*>(screen.planes[1]);
+            state.insert(state.end(), plane, plane + sizeof(screen.planes[1]));
+        }
+
+        return hash64(state.data(), state.size());
+    }
+
+    std::uint64_t run(const Case& c, bool fusion){
+        Chip8Env env{c.rom};
+        env.setQuirks(c.quirks);
+        env.setFusion(fusion);
+        env.setVipTiming(c.vipTiming);
+        env.reset(0);
+
+        for(std::size_t i = 0; i < c.schedule.size(); i++){
+            env.step(c.schedule[i].keys, c.schedule[i].frames);
+
+            for(const Patch& p : c.patches){
+                if(p.after == i){
+                    env.ram()[p.address] = p.value;
+                }
+            }
+        }
+
+        return stateHash(env);
+    }
+
+    //Fused sequences must end in the same state as the instructions run one by one
+    Result runCase(const Case& c){
+        Result result;
+
+        for(const auto& [addr, id] : c.fusions){
+            std::uint8_t code[6] = {};
+            const std::size_t at = addr - 0x200;
+            std::copy(c.rom.begin() + std::min(at, c.rom.size()), c.rom.begin() + std::min(at + 6, c.rom.size()), code);
+
+            if(findFusion(code) != id){
+                char where[64];
+                std::snprintf(where, sizeof(where), "%s is not fused at %03X", fusionPatterns[id - 1].name, addr);
+                result.error = where;
+                return result;
+            }
+        }
+
+        try{
+            result.hash = run(c, false);
+
+            if(run(c, true) != result.hash){
+                result.error = "fused and unfused runs differ";
+            }
+        }
+        catch(std::exception&){
+            result.error = "could not load ROM";
+        }
+
+        return result;
+    }
+
+    std::vector<std::uint8_t> readFile(const std::string& path){
+        std::ifstream file{path, std::ios::in | std::ios::binary};
+        return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+    }
+
+    std::map<std::string, std::uint64_t> readGoldens(const std::string& path){
+        std::map<std::string, std::uint64_t> goldens;
+        std::ifstream file{path};
+        std::string line;
+
+        while(std::getline(file, line)){
+            std::istringstream words{line};
+            std::string name, hash;
+
+            if(line.empty() || line[0] == '#' || !(words >> name >> hash))
+                continue;
+
+            goldens[name] = std::stoull(hash, nullptr, 16);
+        }
+
+        return goldens;
+    }
+}
+
+int main(int argc, char** argv){
+    if(argc < 2){
+        std::cout << "Usage: " << argv[0] << " <goldens file> [--update] [rom.ch8 ...]" << std::endl;
+        return 2;
+    }
+
+    const std::string goldensPath{argv[1]};
+    bool update = false;
+    std::vector<Case> cases = builtinCases();
+
+    for(int i = 2; i < argc; i++){
+        const std::string param{argv[i]};
+
+        if(param == "--update"){
+            update = true;
+        }
+        else{
+            std::vector<std::uint8_t> rom = readFile(param);
+
+            for(const char* name : profiles){
+                cases.push_back({param + ":" + name, rom, profile(name), {{0, 600}}});
+            }
+        }
+    }
+
+    //Run the cases on every core
+    auto start = std::chrono::steady_clock::now();
+    std::vector<Result> results(cases.size());
+    std::atomic<std::size_t> next{0};
+    std::vector<std::thread> workers;
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+
+    for(unsigned t = 0; t < threads; t++){
+        workers.emplace_back([&]{
+            for(std::size_t i = next++; i < cases.size(); i = next++){
+                results[i] = runCase(cases[i]);
+            }
+        });
+    }
+
+    for(std::thread& worker : workers){
+        worker.join();
+    }
+
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+    //Write new goldens
+    if(update){
+        std::ofstream file{goldensPath};
+        file << "#Generated by cpp8-conformance --update\n";
+
+        for(std::size_t i = 0; i < cases.size(); i++){
+            char hash[17];
+            std::snprintf(hash, sizeof(hash), "%016llx", static_cast<unsigned long long>(results[i].hash));
+            file << cases[i].name << ' ' << hash << '\n';
+        }
+
+        std::cout << "Wrote " << cases.size() << " goldens to " << goldensPath << std::endl;
+        return 0;
+    }
+
+    //Or compare against the existing ones
+    std::map<std::string, std::uint64_t> goldens = readGoldens(goldensPath);
+    int failures = 0;
+
+    for(std::size_t i = 0; i < cases.size(); i++){
+        auto golden = goldens.find(cases[i].name);
+
+        if(!results[i].error.empty()){
+            std::cout << "FAIL " << cases[i].name << ": " << results[i].error << '\n';
+            failures++;
+        }
+        else if(golden == goldens.end()){
+            std::cout << "FAIL " << cases[i].name << ": no golden\n";
+            failures++;
+        }
+        else if(golden->second != results[i].hash){
+            std::cout << "FAIL " << cases[i].name << ": hash mismatch\n";
+            failures++;
+        }
+    }
+
+    std::cout << cases.size() - failures << "/" << cases.size() << " passed in "
+              << elapsed.count() << "us on " << threads << " threads" << std::endl;
+
+    return failures ? 1 : 0;
+}
@@ -0,0 +1,434 @@
+//Benchmarks for the parts of cpp8 that have a time budget
+//
+//Usage:
+//  cpp8-bench filters [frames]     time each upscaler on a 64x32 frame
+//  cpp8-bench latency [presses]    key press to frame presented, headless
+//  cpp8-bench timers [frames]      VIP timing: the timers tick once per frame run
+//  cpp8-bench stop [frames]        nothing is caught up after a debugger stop
+//
+//Before timing, the Scale filters are checked against a plain
+//pixel by pixel version of the same rules, so a run also tells if they're right.
+//
+//latency runs the real emulation and drawing threads with a scripted keyboard
+//and a presenter that draws nothing, so it needs no window and works in CI.
+//It fails if a press never shows up on screen.
+//
+//timers runs the real threads too, with VIP timing, and a ROM that ends each frame
+//drawing a sprite: its count of frames and the timers must add up, whatever the clock did.
+//
+//stop stops a running game in the debugger for some frames, then continues it:
+//the instructions and timer ticks after that must be the usual ones for the time, not the stop's.
+
+#include "Chip8.hpp"
+#include "Chip8Debugger.hpp"
+#include "LatencyProbe.hpp"
+#include "Upscaler.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CPP8_HAVE_PIPES
+#include <unistd.h>
+#endif
+
+namespace{
+    constexpr int width = 64;
+    constexpr int height = 32;
+    using Frame = std::array<bool, width * height>;
+
+    //Something like a game screen: a few sprites and lines on an empty background
+    Frame testFrame(unsigned seed){
+        Frame frame{};
+        std::mt19937 rng{seed};
+
+        for(int sprite = 0; sprite < 24; sprite++){
+            int x0 = rng() % width, y0 = rng() % height;
+            for(int y = 0; y < 5; y++){
+                std::uint8_t bits = rng();
+                for(int x = 0; x < 8; x++){
+                    frame[((y0 + y) % height) * width + (x0 + x) % width] ^= (bits >> (7 - x)) & 1;
+                }
+            }
+        }
+
+        for(int i = 0; i < height; i++){
+            frame[i * width + i] = true;
+            frame[i * width + width - 1 - i] = true;
+        }
+
+        return frame;
+    }
+
+    //Pixel by pixel Scale2x and Scale3x, clamped at the edges
+    std::vector<std::uint32_t> reference(const Frame& frame, int scale){
+        auto at = [&frame](int x, int y){
+            x = x < 0 ? 0 : x >= width ? width - 1 : x;
+            y = y < 0 ? 0 : y >= height ? height - 1 : y;
+            return static_cast<std::uint32_t>(frame[y * width + x]);
+        };
+
+        std::vector<std::uint32_t> out(width * height * scale * scale);
+        const int outWidth = width * scale;
+
+        for(int y = 0; y < height; y++){
+            for(int x = 0; x < width; x++){
+                std::uint32_t A = at(x - 1, y - 1), B = at(x, y - 1), C = at(x + 1, y - 1);
+                std::uint32_t D = at(x - 1, y),     E = at(x, y),     F = at(x + 1, y);
+                std::uint32_t G = at(x - 1, y + 1), H = at(x, y + 1), I = at(x + 1, y + 1);
+                std::uint32_t e[9] = {E, E, E, E, E, E, E, E, E};
+
+                if(B != H && D != F){
+                    if(scale == 2){
+                        e[0] = D == B ? D : E;
+                        e[1] = B == F ? F : E;
+                        e[2] = D == H ? D : E;
+                        e[3] = H == F ? F : E;
+                    }
+                    else{
+                        e[0] = D == B ? D : E;
+                        e[1] = (D == B && E != C) || (B == F && E != A) ? B : E;
+                        e[2] = B == F ? F : E;
+                        e[3] = (D == B && E != G) || (D == H && E != A) ? D : E;
+                        e[5] = (B == F && E != I) || (H == F && E != C) ? F : E;
+                        e[6] = D == H ? D : E;
+                        e[7] = (D == H && E != I) || (H == F && E != G) ? H : E;
+                        e[8] = H == F ? F : E;
+                    }
+                }
+
+                for(int sy = 0; sy < scale; sy++){
+                    for(int sx = 0; sx < scale; sx++){
+                        out[(y * scale + sy) * outWidth + x * scale + sx] = e[sy * scale + sx];
+                    }
+                }
+            }
+        }
+
+        return out;
+    }
+
+    bool check(const Frame& frame, Upscaler::Filter filter, int scale){
+        Upscaler upscaler{filter, 1, 0};
+        std::array<std::uint64_t, height> packed;
+        std::vector<std::uint32_t> out(width * height * scale * scale);
+
+        Upscaler::pack(frame.data(), width, height, packed.data());
+        upscaler.upscale(packed.data(), width / 64, height, out.data(), width * scale * sizeof(std::uint32_t));
+
+        return out == reference(frame, scale);
+    }
+
+    int filters(int frames){
+        const char* names[] = {"none", "scale2x", "scale3x", "scale4x", "hq2x", "hq3x", "hq4x"};
+        const Frame frame = testFrame(1);
+        bool ok = true;
+
+        for(unsigned seed = 1; seed <= 16; seed++){
+            ok = check(testFrame(seed), Upscaler::Filter::SCALE2X, 2) && ok;
+            ok = check(testFrame(seed), Upscaler::Filter::SCALE3X, 3) && ok;
+        }
+
+        if(!ok){
+            std::printf("Scale filters don't match the reference\n");
+            return 1;
+        }
+
+        std::printf("%-8s %9s %12s\n", "filter", "output", "ns/frame");
+
+        for(const char* name : names){
+            Upscaler upscaler{*Upscaler::parse(name), 0xFFFFFFFF, 0xFF000000};
+            const int scale = upscaler.factor();
+            std::array<std::uint64_t, height> packed;
+            std::vector<std::uint32_t> out(width * height * scale * scale);
+
+            //Packing is part of the cost, frontends do it every frame
+            auto start = std::chrono::steady_clock::now();
+            for(int i = 0; i < frames; i++){
+                Upscaler::pack(frame.data(), width, height, packed.data());
+                upscaler.upscale(packed.data(), width / 64, height, out.data(), width * scale * sizeof(std::uint32_t));
+            }
+            auto elapsed = std::chrono::steady_clock::now() - start;
+
+            std::printf("%-8s %4dx%-4d %12.0f\n", name, width * scale, height * scale,
+                        std::chrono::duration<double, std::nano>(elapsed).count() / frames);
+        }
+
+        return 0;
+    }
+
+    //Waits for a key and draws its digit, forever
+    const std::vector<std::uint8_t> echoRom = {
+        0xF0, 0x0A,     //LD V0, K
+        0x00, 0xE0,     //CLS
+        0xF0, 0x29,     //LD F, V0
+        0xD1, 0x15,     //DRW V1, V1, 5
+        0x12, 0x00,     //JP 0x200
+    };
+
+    //Presses a different key every few frames and presents frames nowhere
+    class ScriptedChip8 : public Chip8{
+        public:
+            ScriptedChip8(int presses) : Chip8{echoRom, 1}, presses{presses}{
+                enableLatencyProbe();
+            }
+
+        private:
+            static constexpr int framesPerPress = 4;
+            int presses;
+            int frame = 0;
+            int pressed = 0;
+
+            void setTone(bool) override {}
+
+            void handleInput() override{
+                const bool measured = getLatencyProbe()->summary().count >= static_cast<std::size_t>(presses);
+                const bool timedOut = frame > (presses + 2) * framesPerPress * 4;
+
+                if(measured || timedOut){
+                    stop();
+                    return;
+                }
+
+                const std::uint8_t key = pressed % 16;
+                if(frame % framesPerPress == 0){
+                    pressKey(key);
+                }
+                else if(frame % framesPerPress == 1){
+                    releaseKey(key);
+                    pressed++;
+                }
+
+                frame++;
+            }
+
+            void draw(const Chip8Screen&) override {}
+    };
+
+    //Sets both timers to 255, then counts frames in V1: each ends waiting for the display
+    const std::vector<std::uint8_t> frameCountRom = {
+        0x60, 0xFF,     //LD V0, 255
+        0xF0, 0x15,     //LD DT, V0
+        0xF0, 0x18,     //LD ST, V0
+        0x71, 0x01,     //ADD V1, 1
+        0xD0, 0x05,     //DRW V0, V0, 5
+        0x12, 0x06,     //JP 0x206
+    };
+
+    //Looks at a snapshot every frame, taken between two of the interpreter's frames
+    class FrameCountChip8 : public Chip8{
+        public:
+            FrameCountChip8(int frames) : Chip8{frameCountRom, 1}, frames{frames}{
+                setVipTiming(true);
+            }
+
+            int counted = 0;
+            int failures = 0;
+
+        private:
+            int frames;
+            int frame = 0;
+
+            void setTone(bool) override {}
+
+            void handleInput() override{
+                if(std::optional<Snapshot> s = takeSnapshot()){
+                    counted = s->V[1];
+                    if(counted > 0 && (s->delayTimer != 255 - counted || s->soundTimer != 255 - counted)){
+                        if(failures++ == 0){
+                            std::printf("After %d frames DT=%d ST=%d, expected %d\n", counted, s->delayTimer, s->soundTimer, 255 - counted);
+                        }
+                    }
+
+                    if(counted >= frames){
+                        stop();
+                        return;
+                    }
+                }
+
+                if(frame++ > frames * 4){
+                    stop();
+                    return;
+                }
+                controlSnapshot();
+            }
+
+            void draw(const Chip8Screen&) override {}
+    };
+
+    int timers(int frames){
+        FrameCountChip8 chip8{frames};
+        chip8.run();
+
+        std::printf("frames=%d failures=%d\n", chip8.counted, chip8.failures);
+        if(chip8.failures || chip8.counted < frames){
+            return 1;
+        }
+
+        return 0;
+    }
+
+    #ifdef CPP8_HAVE_PIPES
+    //Sets the delay timer to 255, then counts in V1 forever
+    const std::vector<std::uint8_t> countRom = {
+        0x60, 0xFF,     //LD V0, 255
+        0xF0, 0x15,     //LD DT, V0
+        0x71, 0x01,     //ADD V1, 1
+        0x12, 0x04,     //JP 0x204
+    };
+
+    //Snapshots before a debugger stop, right after it and a few frames later.
+    //The debugger reads its commands from a pipe, written from here.
+    class StoppedChip8 : public Chip8{
+        public:
+            static constexpr int hz = 500;
+            static constexpr int framesAfter = 12;
+
+            StoppedChip8(int stopFrames) : Chip8{countRom, 1}, stopFrames{stopFrames}{
+                int fds[2];
+                if(pipe(fds) == 0){
+                    commands = fdopen(fds[1], "w");
+                    replies = std::fopen("/dev/null", "w");
+                    auto d = std::make_unique<Chip8Debugger>(fdopen(fds[0], "r"), replies);
+                    debugger = d.get();
+                    attachDebugger(std::move(d));
+
+                    //It stops before the first instruction
+                    std::fputs("c\n", commands);
+                    std::fflush(commands);
+                }
+                setHz(hz);
+            }
+
+            ~StoppedChip8(){
+                attachDebugger(nullptr);
+                if(commands) std::fclose(commands);
+                if(replies) std::fclose(replies);
+            }
+
+            std::vector<Snapshot> snapshots;
+            bool ready() const{ return debugger; }
+
+        private:
+            int stopFrames;
+            int frame = 0;
+            Chip8Debugger* debugger = nullptr;
+            std::FILE* commands = nullptr;
+            std::FILE* replies = nullptr;
+
+            void setTone(bool) override {}
+
+            void handleInput() override{
+                const int stopAt = 10;
+                const int resumeAt = stopAt + stopFrames;
+
+                if(std::optional<Snapshot> s = takeSnapshot()){
+                    snapshots.push_back(*s);
+                }
+
+                if(frame == stopAt - 2){
+                    controlSnapshot();
+                }
+                else if(frame == stopAt){
+                    debugger->requestStop();
+                }
+                else if(frame == resumeAt){
+                    std::fputs("c\n", commands);
+                    std::fflush(commands);
+                    controlSnapshot();
+                }
+                else if(frame == resumeAt + framesAfter){
+                    controlSnapshot();
+                }
+                else if(snapshots.size() == 3 || frame > resumeAt + framesAfter * 4){
+                    stop();
+                    return;
+                }
+
+                frame++;
+            }
+
+            void draw(const Chip8Screen&) override {}
+    };
+
+    int stopped(int stopFrames){
+        StoppedChip8 chip8{stopFrames};
+        if(!chip8.ready()){
+            std::printf("Could not create the debugger pipe\n");
+            return 1;
+        }
+        chip8.run();
+
+        if(chip8.snapshots.size() < 3){
+            std::printf("Only %zu of 3 snapshots were taken\n", chip8.snapshots.size());
+            return 1;
+        }
+
+        //Around framesAfter / 60 seconds of instructions after the stop,
+        //and as many ticks as frames went by outside of it
+        const Chip8::Snapshot& before = chip8.snapshots[0];
+        const Chip8::Snapshot& resumed = chip8.snapshots[1];
+        const Chip8::Snapshot& after = chip8.snapshots[2];
+        const long long instructions = after.cycles - resumed.cycles;
+        const int ticks = before.delayTimer - after.delayTimer;
+        const long long expected = StoppedChip8::hz * StoppedChip8::framesAfter / 60;
+        std::printf("instructions=%lld expected=%lld ticks=%d\n", instructions, expected, ticks);
+
+        if(instructions <= 0 || instructions > expected * 5 / 2 || ticks > StoppedChip8::framesAfter + 10){
+            std::printf("The time stopped in the debugger was caught up\n");
+            return 1;
+        }
+
+        return 0;
+    }
+    #endif
+
+    int latency(int presses){
+        ScriptedChip8 chip8{presses};
+        chip8.run();
+
+        const LatencyProbe::Summary summary = chip8.getLatencyProbe()->summary();
+        chip8.getLatencyProbe()->print(std::cout);
+
+        if(summary.count < static_cast<std::size_t>(presses)){
+            std::printf("Only %zu of %d presses reached the screen\n", summary.count, presses);
+            return 1;
+        }
+
+        return 0;
+    }
+}
+
+int main(int argc, char** argv){
+    const std::string command{argc > 1 ? argv[1] : ""};
+
+    if(command == "filters"){
+        int frames = argc > 2 ? std::atoi(argv[2]) : 10000;
+        return filters(frames > 0 ? frames : 1);
+    }
+    else if(command == "latency"){
+        int presses = argc > 2 ? std::atoi(argv[2]) : 100;
+        return latency(presses > 0 ? presses : 1);
+    }
+    else if(command == "timers"){
+        int frames = argc > 2 ? std::atoi(argv[2]) : 120;
+        return timers(std::clamp(frames, 1, 250));
+    }
+    #ifdef CPP8_HAVE_PIPES
+    else if(command == "stop"){
+        int frames = argc > 2 ? std::atoi(argv[2]) : 60;
+        return stopped(std::clamp(frames, 1, 600));
+    }
+    #endif
+    else{
+        std::cout << "Usage: " << argv[0] << " filters [frames] | latency [presses] | timers [frames] | stop [frames]" << std::endl;
+        return 2;
+    }
+}
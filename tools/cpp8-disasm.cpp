@@ -0,0 +1,490 @@
+//Static disassembler and control flow analysis for ROMs (see Chip8Disasm.hpp)
+//
+//Usage:
+//  cpp8-disasm list <rom> [-q quirks] [-r romdb] [-j]      listing, or JSON with -j
+//  cpp8-disasm scan <rom or dir>... [-q quirks] [-r romdb] [-j]
+//  cpp8-disasm check                                       decodeInstruction against step()
+//
+//The quirks are the ones given with -q, else those of the ROM in the database given
+//with -r, else the defaults. They matter: XO-CHIP knows more opcodes, and F000 NNNN is 4 bytes.
+//
+//scan disassembles every ROM given, and every file in the directories given, in parallel,
+//and prints one line per ROM (a JSON object per line with -j):
+//  code, data              bytes reached as instructions, and the rest of the ROM
+//  blocks, functions       basic blocks and subroutines, calls the edges of the call graph
+//  indirect                BNNN jumps, which the analysis can't follow
+//  unknown                 unknown opcodes reached, the ones step() would report at run time
+//  escapes                 jumps, calls and skips to outside the ROM
+//  fusion                  addresses where a sequence of Fusion.hpp starts
+//  codewrites              stores to code with I known statically
+//  static                  yes if all the code is known ahead of time: none of the three above,
+//                          so the ROM can be cached or translated before it runs
+//then, in text, the unknown opcodes found in the most ROMs.
+//
+//check is run by ctest: every opcode, in each quirks profile, is decoded and then run
+//by step() once, and the two must agree on whether it's known and where it goes next.
+
+#include "Chip8Disasm.hpp"
+#include "Chip8Env.hpp"
+#include "RomDatabase.hpp"
+#include "Hash.hpp"
+#include "WorkerPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace{
+    struct Options{
+        std::optional<Chip8::Quirks> quirks;
+        std::unique_ptr<RomDatabase> romDatabase;
+        bool json = false;
+        std::vector<std::string> paths;
+    };
+
+    //Options start at argv[2]. Returns false and prints why if they're wrong.
+    bool parseOptions(int argc, char** argv, Options& options){
+        for(int i = 2; i < argc; i++){
+            const std::string arg{argv[i]};
+
+            if(arg == "-q" && i < argc - 1){
+                options.quirks = Chip8::Quirks::parse(argv[++i]);
+                if(!options.quirks){
+                    std::cerr << "Unknown quirks \"" << argv[i] << "\"\n";
+                    return false;
+                }
+            }
+            else if(arg == "-r" && i < argc - 1){
+                options.romDatabase = std::make_unique<RomDatabase>(argv[++i]);
+                if(!options.romDatabase->ok()){
+                    return false;
+                }
+            }
+            else if(arg == "-j"){
+                options.json = true;
+            }
+            else{
+                options.paths.push_back(arg);
+            }
+        }
+
+        return true;
+    }
+
+    bool load(const std::string& path, std::vector<std::uint8_t>& rom){
+        std::ifstream file{path, std::ios::binary};
+        if(!file){
+            return false;
+        }
+
+        rom.assign(std::istreambuf_iterator<char>{file}, {});
+        return true;
+    }
+
+    Chip8::Quirks quirksFor(const std::vector<std::uint8_t>& rom, const Options& options){
+        if(options.quirks){
+            return *options.quirks;
+        }
+
+        const RomEntry* entry = options.romDatabase ? options.romDatabase->find(hash64(rom.data(), rom.size())) : nullptr;
+        return entry ? Chip8::Quirks::fromBits(entry->quirks) : Chip8::Quirks{};
+    }
+
+    std::string describe(Chip8::Quirks q){
+        std::string s;
+        if(q.shiftVx) s += ",shift";
+        if(q.vfReset) s += ",vfreset";
+        if(q.incrementI) s += ",memi";
+        if(q.clipSprites) s += ",clip";
+        if(q.jumpVx) s += ",jump";
+        if(q.xoChip) s += ",xo";
+        return s.empty() ? "default" : s.substr(1);
+    }
+
+    //The pattern of an unknown opcode, by the parts step() decodes it by: "8XYF", "FX9A", "0X31"
+    std::string pattern(std::uint16_t opcode){
+        char buf[8];
+        const int first = opcode >> 12;
+
+        if(first == 0x5 || first == 0x8 || first == 0x9)
+            std::snprintf(buf, sizeof(buf), "%XXY%X", first, opcode & 0x0F);
+        else
+            std::snprintf(buf, sizeof(buf), "%XX%02X", first, opcode & 0xFF);
+
+        return buf;
+    }
+
+    //JSON strings: only paths need escaping
+    std::string quote(const std::string& s){
+        std::string out{"\""};
+        for(char c : s){
+            if(c == '"' || c == '\\'){
+                out += '\\';
+                out += c;
+            }
+            else if(static_cast<unsigned char>(c) < 0x20){
+                char buf[8];
+                std::snprintf(buf, sizeof(buf), "\\u%04x", c);
+                out += buf;
+            }
+            else{
+                out += c;
+            }
+        }
+        return out + "\"";
+    }
+
+    int calls(const Chip8Disasm& d){
+        int n = 0;
+        for(const Chip8Disasm::Function& f : d.functions()){
+            n += f.callees.size();
+        }
+        return n;
+    }
+
+    bool isStatic(const Chip8Disasm& d){
+        return d.indirectJumps().empty() && d.unknownOpcodes().empty() && d.codeWrites() == 0;
+    }
+
+    //The numbers scan prints, as key=value or as JSON members
+    std::string summary(const Chip8Disasm& d, bool json){
+        std::ostringstream out;
+        const char* format = json ? ",\"%s\":%d" : " %s=%d";
+        const std::pair<const char*, int> values[] = {
+            {"size", d.romSize()}, {"code", d.codeBytes()}, {"data", d.dataBytes()},
+            {"blocks", static_cast<int>(d.blocks().size())}, {"functions", static_cast<int>(d.functions().size())},
+            {"calls", calls(d)}, {"indirect", static_cast<int>(d.indirectJumps().size())},
+            {"unknown", static_cast<int>(d.unknownOpcodes().size())}, {"escapes", static_cast<int>(d.escapes().size())},
+            {"fusion", d.fusionSites()}, {"codewrites", d.codeWrites()},
+        };
+
+        for(const auto& [key, value] : values){
+            char buf[64];
+            std::snprintf(buf, sizeof(buf), format, key, value);
+            out << buf;
+        }
+
+        out << (json ? ",\"static\":" : " static=") << (isStatic(d) ? (json ? "true" : "yes") : (json ? "false" : "no"));
+        return out.str();
+    }
+
+    //The text listing: labels for functions and blocks, data bytes 8 to a line
+    void printListing(const std::string& path, const Chip8Disasm& d, Chip8::Quirks quirks){
+        const auto& instructions = d.instructions();
+        std::set<std::uint16_t> functions, blocks, indirect{d.indirectJumps().begin(), d.indirectJumps().end()};
+        for(const Chip8Disasm::Function& f : d.functions()) functions.insert(f.entry);
+        for(const Chip8Disasm::Block& b : d.blocks()) blocks.insert(b.start);
+
+        std::printf("; %s quirks=%s\n;%s\n", path.c_str(), describe(quirks).c_str(), summary(d, false).c_str());
+
+        int addr = 0x200;
+        const int end = 0x200 + d.romSize();
+        while(addr < end){
+            if(d.kind(addr) != Chip8Disasm::CODE){
+                std::printf("%04X  DB", addr);
+                for(int i = 0; i < 8 && addr < end && d.kind(addr) != Chip8Disasm::CODE; i++, addr++){
+                    std::printf(" %02X", d.byte(addr));
+                }
+                std::printf("\n");
+                continue;
+            }
+
+            const Chip8Instruction& in = *std::lower_bound(instructions.begin(), instructions.end(), addr,
+                [](const Chip8Instruction& i, int a){ return i.addr < a; });
+
+            if(functions.count(addr)){
+                std::printf("\nsub_%03X:\n", addr);
+            }
+            else if(blocks.count(addr)){
+                std::printf("L%03X:\n", addr);
+            }
+
+            const std::string text = formatInstruction(in, quirks);
+            if(in.length == 4)
+                std::printf("%04X  %04X %04X  %-20s", addr, in.opcode, in.operand, text.c_str());
+            else
+                std::printf("%04X  %04X       %-20s", addr, in.opcode, text.c_str());
+
+            if(in.flow == Chip8Instruction::UNKNOWN)
+                std::printf("; unknown opcode");
+            else if(indirect.count(addr))
+                std::printf("; indirect jump");
+            else if(in.flow == Chip8Instruction::CALL && functions.count(in.target))
+                std::printf("; sub_%03X", in.target);
+            std::printf("\n");
+
+            addr += in.length;
+        }
+    }
+
+    void printJson(const std::string& path, const Chip8Disasm& d, Chip8::Quirks quirks){
+        std::printf("{\"rom\":%s,\"quirks\":\"%s\"%s,\n", quote(path).c_str(), describe(quirks).c_str(), summary(d, true).c_str());
+
+        auto list = [](const std::vector<std::uint16_t>& values){
+            std::string s;
+            for(std::uint16_t v : values) s += (s.empty() ? "" : ",") + std::to_string(v);
+            return "[" + s + "]";
+        };
+
+        std::printf("\"instructions\":[");
+        for(std::size_t i = 0; i < d.instructions().size(); i++){
+            const Chip8Instruction& in = d.instructions()[i];
+            std::printf("%s\n{\"addr\":%d,\"opcode\":%d,\"length\":%d,\"asm\":\"%s\"}", i ? "," : "",
+                        in.addr, in.opcode, in.length, formatInstruction(in, quirks).c_str());
+        }
+
+        std::printf("],\n\"blocks\":[");
+        for(std::size_t i = 0; i < d.blocks().size(); i++){
+            const Chip8Disasm::Block& b = d.blocks()[i];
+            std::printf("%s\n{\"start\":%d,\"last\":%d,\"instructions\":%d,\"successors\":%s}", i ? "," : "",
+                        b.start, b.last, b.instructions, list(b.successors).c_str());
+        }
+
+        std::printf("],\n\"functions\":[");
+        for(std::size_t i = 0; i < d.functions().size(); i++){
+            const Chip8Disasm::Function& f = d.functions()[i];
+            std::printf("%s\n{\"entry\":%d,\"blocks\":%d,\"calls\":%s}", i ? "," : "",
+                        f.entry, f.blocks, list(f.callees).c_str());
+        }
+
+        std::printf("],\n\"indirect\":%s,\n\"unknown\":[", list(d.indirectJumps()).c_str());
+        for(std::size_t i = 0; i < d.unknownOpcodes().size(); i++){
+            const Chip8Instruction& in = d.unknownOpcodes()[i];
+            std::printf("%s{\"addr\":%d,\"opcode\":%d}", i ? "," : "", in.addr, in.opcode);
+        }
+
+        std::printf("],\n\"escapes\":[");
+        for(std::size_t i = 0; i < d.escapes().size(); i++){
+            std::printf("%s{\"from\":%d,\"to\":%d}", i ? "," : "", d.escapes()[i].first, d.escapes()[i].second);
+        }
+        std::printf("]}\n");
+    }
+
+    int list(const Options& options){
+        if(options.paths.size() != 1){
+            std::cerr << "list takes one ROM\n";
+            return 2;
+        }
+
+        std::vector<std::uint8_t> rom;
+        if(!load(options.paths[0], rom)){
+            std::cerr << "Could not open ROM \"" << options.paths[0] << "\"\n";
+            return 1;
+        }
+
+        const Chip8::Quirks quirks = quirksFor(rom, options);
+        const Chip8Disasm d{rom, quirks};
+
+        if(options.json)
+            printJson(options.paths[0], d, quirks);
+        else
+            printListing(options.paths[0], d, quirks);
+
+        return 0;
+    }
+
+    //The files in path if it's a directory, else path itself
+    std::vector<std::string> listRoms(const std::string& path){
+        std::vector<std::string> paths;
+
+        if(DIR* dir = opendir(path.c_str())){
+            while(dirent* entry = readdir(dir)){
+                if(entry->d_name[0] != '.'){
+                    paths.push_back(path + "/" + entry->d_name);
+                }
+            }
+            closedir(dir);
+            std::sort(paths.begin(), paths.end());
+        }
+        else{
+            paths.push_back(path);
+        }
+
+        return paths;
+    }
+
+    int scan(const Options& options){
+        std::vector<std::string> roms;
+        for(const std::string& path : options.paths){
+            const std::vector<std::string> found = listRoms(path);
+            roms.insert(roms.end(), found.begin(), found.end());
+        }
+
+        if(roms.empty()){
+            std::cerr << "No ROMs to scan\n";
+            return 2;
+        }
+
+        //Each ROM is read and disassembled on a worker, the lines printed in order after
+        struct Result{
+            bool ok = false;
+            bool isStatic = false;
+            std::string line;
+            std::set<std::string> unknown;
+        };
+        std::vector<Result> results(roms.size());
+        auto start = std::chrono::steady_clock::now();
+
+        WorkerPool pool;
+        pool.parallelFor(roms.size(), [&](std::size_t i){
+            std::vector<std::uint8_t> rom;
+            Result& r = results[i];
+
+            if(!load(roms[i], rom)){
+                return;
+            }
+
+            const Chip8::Quirks quirks = quirksFor(rom, options);
+            const Chip8Disasm d{rom, quirks};
+            r.ok = true;
+            r.isStatic = isStatic(d);
+
+            for(const Chip8Instruction& in : d.unknownOpcodes()){
+                r.unknown.insert(pattern(in.opcode));
+            }
+
+            if(options.json){
+                std::string unknown;
+                for(const std::string& p : r.unknown) unknown += (unknown.empty() ? "\"" : ",\"") + p + "\"";
+                r.line = "{\"rom\":" + quote(roms[i]) + ",\"quirks\":\"" + describe(quirks) + "\"" + summary(d, true)
+                       + ",\"unknown_opcodes\":[" + unknown + "]}";
+            }
+            else{
+                r.line = roms[i] + " quirks=" + describe(quirks) + summary(d, false);
+            }
+        });
+
+        const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::map<std::string, int> hotspots;
+        int failed = 0, statics = 0;
+
+        for(std::size_t i = 0; i < roms.size(); i++){
+            if(!results[i].ok){
+                std::cerr << "Could not open ROM \"" << roms[i] << "\"\n";
+                failed++;
+                continue;
+            }
+
+            std::printf("%s\n", results[i].line.c_str());
+            statics += results[i].isStatic;
+            for(const std::string& p : results[i].unknown){
+                hotspots[p]++;
+            }
+        }
+
+        if(options.json){
+            return failed ? 1 : 0;
+        }
+
+        //The unknown opcodes found in the most ROMs first
+        std::vector<std::pair<int, std::string>> ranked;
+        for(const auto& [p, count] : hotspots){
+            ranked.push_back({-count, p});
+        }
+        std::sort(ranked.begin(), ranked.end());
+
+        std::printf("\nroms=%zu static=%d failed=%d threads=%u seconds=%.3f\n",
+                    roms.size() - failed, statics, failed, pool.size(), seconds);
+        for(std::size_t i = 0; i < ranked.size() && i < 20; i++){
+            std::printf("unknown %s roms=%d\n", ranked[i].second.c_str(), -ranked[i].first);
+        }
+
+        return failed ? 1 : 0;
+    }
+
+    //Every opcode, decoded and run once, in each profile
+    int check(){
+        Chip8Env env{std::vector<std::uint8_t>{}};
+        env.setHz(60);       //One instruction per frame
+        env.setFusion(false);
+        const Chip8Core powerOn = env.getCore();
+
+        //reportCode writes to cerr
+        std::ostringstream reported;
+        std::streambuf* cerr = std::cerr.rdbuf(reported.rdbuf());
+        int failures = 0, checked = 0;
+
+        for(const char* profile : {"default", "schip", "xochip"}){
+            const Chip8::Quirks quirks = *Chip8::Quirks::parse(profile);
+            env.setQuirks(quirks);
+            Chip8Core state = powerOn;
+
+            for(int opcode = 0; opcode <= 0xFFFF; opcode++){
+                //Followed by an F000 NNNN, which XO-CHIP skips as a whole
+                state = powerOn;
+                state.PC = 0x300;
+                state.mem[0x300] = opcode >> 8;
+                state.mem[0x301] = opcode & 0xFF;
+                state.mem[0x302] = 0xF0;
+                state.mem[0x303] = 0x00;
+                state.I = 0x600;
+                state.SP = 1;
+                state.stack[0] = 0x400;
+                for(int v = 0; v < 16; v++) state.V[v] = v;
+
+                reported.str("");
+                env.reset(state, 0);
+                const Chip8Instruction in = decodeInstruction(env.ram(), env.ramSize(), 0x300, quirks);
+                const std::vector<std::uint16_t> next = in.successors(env.ram(), env.ramSize(), quirks);
+
+                env.step(0, 1);
+                const bool unknown = reported.str().find("Unknown Opcode") != std::string::npos;
+                const std::uint16_t pc = env.programCounter();
+                bool agree;
+
+                switch(in.flow){
+                    //Reported, or ignored like the F opcodes step() doesn't know
+                    case Chip8Instruction::UNKNOWN: agree = unknown || pc == 0x302; break;
+                    case Chip8Instruction::CALL: agree = !unknown && pc == in.target; break;
+                    case Chip8Instruction::RETURN: agree = !unknown && pc == 0x402; break;
+                    case Chip8Instruction::EXIT: agree = !unknown && pc == 0x300; break;
+                    case Chip8Instruction::INDIRECT: agree = !unknown; break;
+                    default:
+                        //FX0A waits on itself for a key
+                        agree = !unknown && (std::find(next.begin(), next.end(), pc) != next.end()
+                                             || ((opcode & 0xF0FF) == 0xF00A && pc == 0x300));
+                    break;
+                }
+
+                checked++;
+                if(!agree && failures++ < 20){
+                    std::fprintf(stderr, "%s: %04X decoded as \"%s\" but step() went to %03X%s\n", profile, opcode,
+                                 formatInstruction(in, quirks).c_str(), pc, unknown ? ", reporting it" : "");
+                }
+            }
+        }
+
+        std::cerr.rdbuf(cerr);
+        std::printf("checked=%d failures=%d\n", checked, failures);
+        return failures ? 1 : 0;
+    }
+}
+
+int main(int argc, char** argv){
+    const std::string command{argc > 1 ? argv[1] : ""};
+    Options options;
+
+    if(command == "check"){
+        return check();
+    }
+    else if((command == "list" || command == "scan") && parseOptions(argc, argv, options) && !options.paths.empty()){
+        return command == "list" ? list(options) : scan(options);
+    }
+    else{
+        std::cout << "Usage: " << argv[0] << " list <rom> [-q quirks] [-r romdb] [-j]\n"
+                  << "       " << argv[0] << " scan <rom or dir>... [-q quirks] [-r romdb] [-j]\n"
+                  << "       " << argv[0] << " check" << std::endl;
+        return 2;
+    }
+}
@@ -0,0 +1,573 @@
+//Converter for the frame streams written by cpp8 -v (see FrameStream.hpp)
+//
+//Usage:
+//  cpp8-frames info <stream>                               frames, records and size
+//  cpp8-frames pbm <stream> <prefix> [first] [count]       one prefix-NNNNNN.pbm per frame
+//  cpp8-frames png <stream> <prefix> [first] [count] [scale]
+//  cpp8-frames gif <stream> <out.gif> [scale]              animated, looping
+//  cpp8-frames record <rom> <stream> [frames]              run a ROM headless and record it
+//  cpp8-frames check [frames]                              write and read back random frames
+//
+//Lit pixels are white, the others black. The images are written by hand,
+//PNG with uncompressed deflate blocks, so nothing outside the standard library is needed.
+//
+//A GIF can't hold a frame for less than 2/100 of a second, so frames shorter than that
+//are merged into the next one. The PBM and PNG sequences have every 60hz frame.
+//
+//check is run by ctest: it records random frames with plenty of repeats, then reads them
+//back in order, after seeking, and from a copy cut short before the index.
+
+#include "Chip8Env.hpp"
+#include "FrameStream.hpp"
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace{
+    using Packed = std::vector<std::uint8_t>;
+
+    //Called for each record shown between first and first + count:
+    //the first frame it is shown in that range, for how many frames, and its pixels
+    using RecordFn = std::function<bool(std::uint64_t frame, std::uint64_t repeat, const Packed& packed)>;
+
+    bool forEachRecord(FrameReader& reader, std::uint64_t first, std::uint64_t count, const RecordFn& fn){
+        const std::uint64_t end = std::min(reader.frameCount(), first + std::min(count, UINT64_MAX - first));
+        std::uint64_t start;
+        Packed shown, following;
+
+        if(first >= end){
+            return true;
+        }
+        if(!reader.seek(first) || !reader.next(start, shown)){
+            std::cerr << "Could not seek to frame " << first << "\n";
+            return false;
+        }
+
+        for(std::uint64_t n = first; n < end;){
+            const bool more = reader.next(start, following);
+            const std::uint64_t until = std::min(more ? start : reader.frameCount(), end);
+
+            if(until > n && !fn(n, until - n, shown)){
+                return false;
+            }
+
+            n = until;
+            shown.swap(following);
+        }
+
+        return true;
+    }
+
+    std::string numbered(const std::string& prefix, std::uint64_t frame, const char* extension){
+        char number[32];
+        std::snprintf(number, sizeof(number), "-%06llu.", static_cast<unsigned long long>(frame));
+        return prefix + number + extension;
+    }
+
+    bool writeFile(const std::string& path, const std::vector<std::uint8_t>& data){
+        std::ofstream file{path, std::ios::binary | std::ios::trunc};
+        if(!file.write(reinterpret_cast<const char*>(data.data()), data.size())){
+            std::cerr << "Could not write \"" << path << "\"\n";
+            return false;
+        }
+        return true;
+    }
+
+    void putBE32(std::vector<std::uint8_t>& out, std::uint32_t value){
+        for(int shift = 24; shift >= 0; shift -= 8){
+            out.push_back(static_cast<std::uint8_t>(value >> shift));
+        }
+    }
+
+    void putLE16(std::vector<std::uint8_t>& out, std::uint16_t value){
+        out.push_back(static_cast<std::uint8_t>(value));
+        out.push_back(static_cast<std::uint8_t>(value >> 8));
+    }
+
+    //Binary PBM: 1 is black, so the packed bits are inverted
+    std::vector<std::uint8_t> pbm(const FrameReader& reader, const Packed& packed){
+        const std::string header = "P4\n" + std::to_string(reader.width()) + " " + std::to_string(reader.height()) + "\n";
+        std::vector<std::uint8_t> out{header.begin(), header.end()};
+
+        for(std::uint8_t byte : packed){
+            out.push_back(~byte);
+        }
+
+        return out;
+    }
+
+
+    //PNG
+
+    std::uint32_t crc32(const std::uint8_t* data, std::size_t size, std::uint32_t crc = 0){
+        static const std::array<std::uint32_t, 256> table = []{
+            std::array<std::uint32_t, 256> t;
+            for(std::uint32_t n = 0; n < 256; n++){
+                std::uint32_t c = n;
+                for(int k = 0; k < 8; k++){
+                    c = c & 1 ? 0xEDB88320 ^ (c >> 1) : c >> 1;
+                }
+                t[n] = c;
+            }
+            return t;
+        }();
+
+        crc = ~crc;
+        for(std::size_t i = 0; i < size; i++){
+            crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+        }
+        return ~crc;
+    }
+
+    void pngChunk(std::vector<std::uint8_t>& out, const char* type, const std::vector<std::uint8_t>& data){
+        putBE32(out, static_cast<std::uint32_t>(data.size()));
+        const std::size_t start = out.size();
+        out.insert(out.end(), type, type + 4);
+        out.insert(out.end(), data.begin(), data.end());
+        putBE32(out, crc32(&out[start], out.size() - start));
+    }
+
+    //1 bit grayscale, each pixel scale x scale
+    std::vector<std::uint8_t> png(const FrameReader& reader, const Packed& packed, int scale){
+        const int width = reader.width() * scale;
+        const int height = reader.height() * scale;
+        const std::size_t rowBytes = (width + 7) / 8;
+
+        //Filter type 0 and the row, for each row
+        std::vector<std::uint8_t> raw;
+        raw.reserve((rowBytes + 1) * height);
+        for(int y = 0; y < height; y++){
+            raw.push_back(0);
+            std::size_t rowStart = raw.size();
+            raw.resize(rowStart + rowBytes, 0);
+
+            for(int x = 0; x < width; x++){
+                raw[rowStart + x / 8] |= reader.pixel(packed, x / scale, y / scale) << (7 - x % 8);
+            }
+        }
+
+        //zlib stream of stored deflate blocks
+        std::vector<std::uint8_t> zlib{0x78, 0x01};
+        std::uint32_t a = 1, b = 0;
+        for(std::size_t at = 0; at < raw.size() || at == 0;){
+            const std::size_t size = std::min<std::size_t>(raw.size() - at, 65535);
+            zlib.push_back(at + size == raw.size());
+            putLE16(zlib, static_cast<std::uint16_t>(size));
+            putLE16(zlib, static_cast<std::uint16_t>(~size));
+
+            for(std::size_t i = at; i < at + size; i++){
+                zlib.push_back(raw[i]);
+                a = (a + raw[i]) % 65521;
+                b = (b + a) % 65521;
+            }
+
+            at += size;
+            if(size == 0){
+                break;
+            }
+        }
+        putBE32(zlib, (b << 16) | a);
+
+        std::vector<std::uint8_t> header;
+        putBE32(header, width);
+        putBE32(header, height);
+        header.insert(header.end(), {1, 0, 0, 0, 0});    //Bit depth, grayscale, deflate, filters, no interlace
+
+        std::vector<std::uint8_t> out{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+        pngChunk(out, "IHDR", header);
+        pngChunk(out, "IDAT", zlib);
+        pngChunk(out, "IEND", {});
+        return out;
+    }
+
+
+    //GIF
+
+    //Variable length codes, least significant bit first, in sub-blocks of up to 255 bytes
+    class CodeWriter{
+        public:
+            explicit CodeWriter(std::vector<std::uint8_t>& out) : out{out}{}
+
+            void write(unsigned code, int size){
+                bits |= static_cast<std::uint32_t>(code) << count;
+                count += size;
+
+                while(count >= 8){
+                    block.push_back(static_cast<std::uint8_t>(bits));
+                    bits >>= 8;
+                    count -= 8;
+
+                    if(block.size() == 255){
+                        flushBlock();
+                    }
+                }
+            }
+
+            void finish(){
+                if(count > 0){
+                    block.push_back(static_cast<std::uint8_t>(bits));
+                }
+                flushBlock();
+                out.push_back(0);
+            }
+
+        private:
+            std::vector<std::uint8_t>& out;
+            std::vector<std::uint8_t> block;
+            std::uint32_t bits = 0;
+            int count = 0;
+
+            void flushBlock(){
+                if(!block.empty()){
+                    out.push_back(static_cast<std::uint8_t>(block.size()));
+                    out.insert(out.end(), block.begin(), block.end());
+                    block.clear();
+                }
+            }
+    };
+
+    //LZW of pixel indices 0 and 1, the smallest code size a GIF allows
+    void lzw(std::vector<std::uint8_t>& out, const std::vector<std::uint8_t>& indices){
+        constexpr int minCodeSize = 2;
+        constexpr unsigned clearCode = 1 << minCodeSize;
+        constexpr unsigned endCode = clearCode + 1;
+        constexpr unsigned maxCodes = 4096;
+
+        out.push_back(minCodeSize);
+        CodeWriter writer{out};
+
+        std::unordered_map<std::uint32_t, unsigned> table;  //Prefix code << 8 | index, code
+        int codeSize = minCodeSize + 1;
+        unsigned lastCode = endCode;
+
+        writer.write(clearCode, codeSize);
+        unsigned prefix = indices[0];
+
+        for(std::size_t i = 1; i < indices.size(); i++){
+            const std::uint32_t key = prefix << 8 | indices[i];
+
+            if(auto found = table.find(key); found != table.end()){
+                prefix = found->second;
+                continue;
+            }
+
+            writer.write(prefix, codeSize);
+            table[key] = ++lastCode;
+
+            //The decoder adds its entries a code later, and widens its codes when it does
+            if(lastCode >= (1u << codeSize)){
+                codeSize++;
+            }
+
+            if(lastCode == maxCodes - 1){
+                writer.write(clearCode, codeSize);
+                table.clear();
+                codeSize = minCodeSize + 1;
+                lastCode = endCode;
+            }
+
+            prefix = indices[i];
+        }
+
+        writer.write(prefix, codeSize);
+        writer.write(endCode, codeSize);
+        writer.finish();
+    }
+
+    std::vector<std::uint8_t> gifStart(const FrameReader& reader, int scale){
+        std::vector<std::uint8_t> out{'G', 'I', 'F', '8', '9', 'a'};
+        putLE16(out, static_cast<std::uint16_t>(reader.width() * scale));
+        putLE16(out, static_cast<std::uint16_t>(reader.height() * scale));
+        out.insert(out.end(), {0x80, 0, 0});                //Global table of 2 colors
+        out.insert(out.end(), {0, 0, 0, 0xFF, 0xFF, 0xFF});  //Black and white
+
+        //Loop forever
+        out.insert(out.end(), {0x21, 0xFF, 11, 'N', 'E', 'T', 'S', 'C', 'A', 'P', 'E', '2', '.', '0', 3, 1, 0, 0, 0});
+        return out;
+    }
+
+    void gifFrame(std::vector<std::uint8_t>& out, const FrameReader& reader, const Packed& packed, int scale, unsigned delay){
+        const int width = reader.width() * scale;
+        const int height = reader.height() * scale;
+
+        //Graphic control: no disposal, delay in hundredths of a second
+        out.insert(out.end(), {0x21, 0xF9, 4, 0x04});
+        putLE16(out, static_cast<std::uint16_t>(std::min(delay, 0xFFFFu)));
+        out.insert(out.end(), {0, 0});
+
+        out.push_back(0x2C);
+        putLE16(out, 0);
+        putLE16(out, 0);
+        putLE16(out, static_cast<std::uint16_t>(width));
+        putLE16(out, static_cast<std::uint16_t>(height));
+        out.push_back(0);
+
+        std::vector<std::uint8_t> indices(static_cast<std::size_t>(width) * height);
+        for(int y = 0; y < height; y++){
+            for(int x = 0; x < width; x++){
+                indices[y * width + x] = reader.pixel(packed, x / scale, y / scale);
+            }
+        }
+
+        lzw(out, indices);
+    }
+
+    //Hundredths of a second at the start of a 60hz frame
+    unsigned centiseconds(std::uint64_t frame){
+        return static_cast<unsigned>((frame * 100 + 30) / 60);
+    }
+
+
+    int info(const std::string& path){
+        FrameReader reader{path};
+        if(!reader.ok()){
+            return 2;
+        }
+
+        std::uint64_t records = 0;
+        Packed packed;
+        std::uint64_t frame;
+        while(reader.next(frame, packed)){
+            records++;
+        }
+
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+        const unsigned long long bytes = file.tellg();
+        const unsigned long long raw = reader.frameCount() * reader.rowBytes() * reader.height();
+
+        std::printf("width=%d height=%d\n", reader.width(), reader.height());
+        std::printf("frames=%llu records=%llu keyframes=%zu seconds=%.2f\n",
+                    static_cast<unsigned long long>(reader.frameCount()), static_cast<unsigned long long>(records),
+                    reader.keyframeCount(), reader.frameCount() / 60.0);
+        std::printf("bytes=%llu packed_bytes=%llu ratio=%.1f\n", bytes, raw, bytes ? static_cast<double>(raw) / bytes : 0.0);
+        return 0;
+    }
+
+    int sequence(const std::string& path, const std::string& prefix, std::uint64_t first, std::uint64_t count, int scale, bool asPng){
+        FrameReader reader{path};
+        if(!reader.ok()){
+            return 2;
+        }
+
+        std::uint64_t written = 0;
+        const bool ok = forEachRecord(reader, first, count, [&](std::uint64_t frame, std::uint64_t repeat, const Packed& packed){
+            const std::vector<std::uint8_t> image = asPng ? png(reader, packed, scale) : pbm(reader, packed);
+
+            for(std::uint64_t i = 0; i < repeat; i++){
+                if(!writeFile(numbered(prefix, frame + i, asPng ? "png" : "pbm"), image)){
+                    return false;
+                }
+            }
+
+            written += repeat;
+            return true;
+        });
+
+        std::printf("Wrote %llu frames\n", static_cast<unsigned long long>(written));
+        return ok ? 0 : 1;
+    }
+
+    int gif(const std::string& path, const std::string& outPath, int scale){
+        FrameReader reader{path};
+        if(!reader.ok()){
+            return 2;
+        }
+
+        std::vector<std::uint8_t> out = gifStart(reader, scale);
+        Packed pending;
+        std::uint64_t pendingFrame = 0;
+        std::uint64_t images = 0;
+
+        //A record is written once the next one tells how long it lasts
+        const bool ok = forEachRecord(reader, 0, UINT64_MAX, [&](std::uint64_t frame, std::uint64_t, const Packed& packed){
+            if(!pending.empty()){
+                if(centiseconds(frame) - centiseconds(pendingFrame) < 2){
+                    pending = packed;
+                    return true;
+                }
+
+                gifFrame(out, reader, pending, scale, centiseconds(frame) - centiseconds(pendingFrame));
+                pendingFrame = frame;
+                images++;
+            }
+
+            pending = packed;
+            return true;
+        });
+
+        if(!pending.empty()){
+            gifFrame(out, reader, pending, scale, std::max(centiseconds(reader.frameCount()) - centiseconds(pendingFrame), 2u));
+            images++;
+        }
+
+        out.push_back(0x3B);
+
+        if(!ok || !writeFile(outPath, out)){
+            return 1;
+        }
+
+        std::printf("Wrote %llu images\n", static_cast<unsigned long long>(images));
+        return 0;
+    }
+
+    int record(const std::string& rom, const std::string& path, int frames){
+        std::unique_ptr<Chip8Env> env;
+
+        try{
+            env = std::make_unique<Chip8Env>(rom);
+        }
+        catch(const std::exception&){
+            std::cerr << "Could not load \"" << rom << "\"\n";
+            return 2;
+        }
+
+        env->reset(1);
+        env->enableRecording(path);
+        env->step(0, frames);
+        return 0;
+    }
+
+    //Random frames, each shown for 1 to 8 frames, with some small changes the way games draw
+    int check(int frames){
+        constexpr int width = Chip8Env::WIDTH;
+        constexpr int height = Chip8Env::HEIGHT;
+        const std::string path = "cpp8-frames-check.frames";
+        const std::string cut = "cpp8-frames-check-cut.frames";
+
+        std::mt19937 rng{1};
+        std::vector<std::array<bool, width * height>> expected(frames);
+        std::array<bool, width * height> screen{};
+
+        {
+            FrameRecorder recorder{path, width, height, 100};
+            if(!recorder.ok()){
+                return 2;
+            }
+
+            for(int frame = 0; frame < frames;){
+                if(rng() % 16 == 0){
+                    for(bool& pixel : screen){
+                        pixel = rng() % 2;
+                    }
+                }
+                else{
+                    for(int sprite = rng() % 3; sprite > 0; sprite--){
+                        int x = rng() % width, y = rng() % height;
+                        for(int i = 0; i < 8; i++){
+                            screen[y * width + (x + i) % width] ^= rng() % 2;
+                        }
+                    }
+                }
+
+                for(int repeat = 1 + rng() % 8; repeat > 0 && frame < frames; repeat--){
+                    expected[frame++] = screen;
+                    recorder.record(screen.data());
+                }
+            }
+        }
+
+        //A stream from a run that was killed: no index and half a record at the end
+        {
+            std::ifstream in{path, std::ios::binary};
+            std::vector<char> data{std::istreambuf_iterator<char>{in}, {}};
+            std::ofstream{cut, std::ios::binary}.write(data.data(), data.size() * 2 / 3);
+        }
+
+        int failures = 0;
+        auto compare = [&](const std::string& name, std::uint64_t first, std::uint64_t count){
+            FrameReader reader{name};
+            std::uint64_t checked = 0;
+
+            const bool ok = reader.ok() && forEachRecord(reader, first, count, [&](std::uint64_t frame, std::uint64_t repeat, const Packed& packed){
+                for(std::uint64_t n = frame; n < frame + repeat; n++, checked++){
+                    for(int i = 0; i < width * height; i++){
+                        if(reader.pixel(packed, i % width, i / width) != expected[n][i]){
+                            std::printf("FAIL %s frame %llu differs at pixel %d\n",
+                                        name.c_str(), static_cast<unsigned long long>(n), i);
+                            return false;
+                        }
+                    }
+                }
+                return true;
+            });
+
+            if(!ok || checked != std::min<std::uint64_t>(count, reader.frameCount() - std::min(first, reader.frameCount()))){
+                failures++;
+            }
+            return reader.frameCount();
+        };
+
+        if(compare(path, 0, UINT64_MAX) != static_cast<std::uint64_t>(frames)){
+            std::printf("FAIL %s has the wrong frame count\n", path.c_str());
+            failures++;
+        }
+
+        for(int seek = 0; seek < 50; seek++){
+            compare(path, rng() % frames, 1 + rng() % 300);
+        }
+
+        const std::uint64_t cutFrames = compare(cut, 0, UINT64_MAX);
+        if(cutFrames == 0 || cutFrames >= static_cast<std::uint64_t>(frames)){
+            std::printf("FAIL %s should have some of the frames\n", cut.c_str());
+            failures++;
+        }
+        else{
+            compare(cut, cutFrames / 2, UINT64_MAX);
+        }
+
+        std::ifstream file{path, std::ios::binary | std::ios::ate};
+        std::printf("%d frames in %lld bytes, %d failures\n", frames, static_cast<long long>(file.tellg()), failures);
+
+        std::remove(path.c_str());
+        std::remove(cut.c_str());
+        return failures ? 1 : 0;
+    }
+
+    std::uint64_t argument(int argc, char** argv, int i, std::uint64_t otherwise){
+        return argc > i ? std::strtoull(argv[i], nullptr, 10) : otherwise;
+    }
+}
+
+int main(int argc, char** argv){
+    const std::string command{argc > 1 ? argv[1] : ""};
+
+    if(command == "info" && argc >= 3){
+        return info(argv[2]);
+    }
+    else if(command == "pbm" && argc >= 4){
+        return sequence(argv[2], argv[3], argument(argc, argv, 4, 0), argument(argc, argv, 5, UINT64_MAX), 1, false);
+    }
+    else if(command == "png" && argc >= 4){
+        const int scale = std::max(1, static_cast<int>(argument(argc, argv, 6, 1)));
+        return sequence(argv[2], argv[3], argument(argc, argv, 4, 0), argument(argc, argv, 5, UINT64_MAX), scale, true);
+    }
+    else if(command == "gif" && argc >= 4){
+        return gif(argv[2], argv[3], std::max(1, static_cast<int>(argument(argc, argv, 4, 1))));
+    }
+    else if(command == "record" && argc >= 4){
+        return record(argv[2], argv[3], static_cast<int>(argument(argc, argv, 4, 600)));
+    }
+    else if(command == "check"){
+        return check(std::max(1, static_cast<int>(argument(argc, argv, 2, 5000))));
+    }
+    else{
+        std::cout << "Usage: " << argv[0] << " info <stream>\n"
+                  << "       " << argv[0] << " pbm <stream> <prefix> [first] [count]\n"
+                  << "       " << argv[0] << " png <stream> <prefix> [first] [count] [scale]\n"
+                  << "       " << argv[0] << " gif <stream> <out.gif> [scale]\n"
+                  << "       " << argv[0] << " record <rom> <stream> [frames]\n"
+                  << "       " << argv[0] << " check [frames]" << std::endl;
+        return 2;
+    }
+}
@@ -0,0 +1,189 @@
+//In-process fuzzer for the interpreter, only built with -DCPP8_FUZZ=ON.
+//Finds ROMs and inputs that make the interpreter itself misbehave:
+//the whole library is built with AddressSanitizer and UndefinedBehaviorSanitizer.
+//
+//Usage, built with Clang (a libFuzzer target):
+//  cpp8-fuzz [libFuzzer options] [corpus dirs]
+//Usage, built with other compilers (no libFuzzer, inputs are only replayed):
+//  cpp8-fuzz <input or dir>...         run each input once
+//  cpp8-fuzz -runs=N [-seed=S]         run N random inputs
+//
+//Each input is a ROM and the keys to press while it runs:
+//  byte 0          low 4 bits: the amount n of schedule entries
+//  byte 1          quirk bits (see Chip8::Quirks::toBits), bit 6 turns VIP timing on,
+//                  bit 7 turns fusion off
+//  n * 3 bytes     keys held (bit k is key k, little endian) and frames to hold them (1 to 4)
+//  the rest        the ROM, loaded at 0x200
+//
+//Coverage of the guest program, as edges between PCs, is fed back to libFuzzer
+//(see COVER_EDGE in Chip8.cpp), so it looks for ROMs reaching new code as well as
+//inputs reaching new host code. Between inputs the machine is reset by copying a
+//saved power-on Chip8Core, nothing is constructed or allocated.
+
+#include "Chip8Env.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <dirent.h>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace{
+    constexpr std::size_t HEADER_SIZE = 2;
+    constexpr std::size_t ENTRY_SIZE = 3;
+    constexpr int MAX_FRAMES_PER_ENTRY = 4;
+    constexpr int DEFAULT_FRAMES = 4;
+    constexpr std::size_t MAX_ROM_SIZE = Chip8Core::RAM_SIZE - 0x200;
+    constexpr unsigned VIP_TIMING_BIT = 64;
+    constexpr unsigned NO_FUSION_BIT = 128;
+
+    struct Harness{
+        Chip8Env env{std::vector<std::uint8_t>{}};
+        Chip8Core powerOn = env.getCore();  //Font loaded, PC at 0x200, nothing else
+        Chip8Core state;
+
+        //Random ROMs are mostly unknown opcodes, and reporting each would take
+        //most of the time. The sanitizers write to the file descriptor, not to cerr.
+        Harness(){
+            std::cerr.rdbuf(nullptr);
+        }
+    };
+
+    Harness& harness(){
+        static Harness h;
+        return h;
+    }
+}
+
+extern "C" int LLVMFuzzerTestOneInput(const std::uint8_t* data, std::size_t size){
+    if(size < HEADER_SIZE){
+        return 0;
+    }
+
+    Harness& h = harness();
+    const std::size_t entries = data[0] & 0x0F;
+    const unsigned flags = data[1];
+    const std::size_t romStart = std::min(size, HEADER_SIZE + entries * ENTRY_SIZE);
+    const std::size_t romSize = std::min(size - romStart, MAX_ROM_SIZE);
+
+    h.state = h.powerOn;
+    std::memcpy(h.state.mem.data() + 0x200, data + romStart, romSize);
+
+    h.env.setQuirks(Chip8::Quirks::fromBits(flags));
+    h.env.setFusion(!(flags & NO_FUSION_BIT));
+    h.env.setVipTiming(flags & VIP_TIMING_BIT);
+    h.env.reset(h.state, 0);
+
+    //The core only holds the first 4KB: what the last input left above them in XO-CHIP stays
+    if(h.env.ramSize() > Chip8Core::RAM_SIZE){
+        std::memset(h.env.ram() + Chip8Core::RAM_SIZE, 0, h.env.ramSize() - Chip8Core::RAM_SIZE);
+    }
+
+    if(romStart == HEADER_SIZE){
+        h.env.step(0, DEFAULT_FRAMES);
+        return 0;
+    }
+
+    for(std::size_t at = HEADER_SIZE; at + ENTRY_SIZE <= romStart; at += ENTRY_SIZE){
+        const std::uint16_t keys = data[at] | (data[at + 1] << 8);
+        const int frames = 1 + data[at + 2] % MAX_FRAMES_PER_ENTRY;
+
+        if(h.env.step(keys, frames).done){
+            break;
+        }
+    }
+
+    return 0;
+}
+
+//Without libFuzzer, a main replaying inputs or running random ones
+#ifndef CPP8_LIBFUZZER
+namespace{
+    std::vector<std::string> listInputs(const std::string& path){
+        std::vector<std::string> paths;
+
+        if(DIR* dir = opendir(path.c_str())){
+            while(dirent* entry = readdir(dir)){
+                if(entry->d_name[0] != '.'){
+                    paths.push_back(path + "/" + entry->d_name);
+                }
+            }
+            closedir(dir);
+            std::sort(paths.begin(), paths.end());
+        }
+        else{
+            paths.push_back(path);
+        }
+
+        return paths;
+    }
+
+    //A value given as -name=value, if arg is one
+    bool option(const char* arg, const char* name, unsigned long& value){
+        const std::size_t length = std::strlen(name);
+
+        if(std::strncmp(arg, name, length) == 0 && arg[length] == '='){
+            value = std::strtoul(arg + length + 1, nullptr, 10);
+            return true;
+        }
+
+        return false;
+    }
+}
+
+int main(int argc, char** argv){
+    unsigned long runs = 0, seed = 1;
+    std::vector<std::string> inputs;
+
+    for(int i = 1; i < argc; i++){
+        if(!option(argv[i], "-runs", runs) && !option(argv[i], "-seed", seed)){
+            const std::vector<std::string> found = listInputs(argv[i]);
+            inputs.insert(inputs.end(), found.begin(), found.end());
+        }
+    }
+
+    if(inputs.empty() && runs == 0){
+        std::fprintf(stderr, "Usage: %s <input or dir>... | -runs=N [-seed=S]\n", argv[0]);
+        return 2;
+    }
+
+    auto start = std::chrono::steady_clock::now();
+
+    for(const std::string& path : inputs){
+        std::ifstream file{path, std::ios::binary};
+        if(!file){
+            std::fprintf(stderr, "Can't open %s\n", path.c_str());
+            return 2;
+        }
+
+        std::vector<std::uint8_t> data{std::istreambuf_iterator<char>{file}, {}};
+        LLVMFuzzerTestOneInput(data.data(), data.size());
+    }
+
+    //Random bytes, mostly valid schedules followed by a small ROM
+    std::mt19937 rng{static_cast<unsigned>(seed)};
+    std::vector<std::uint8_t> data;
+
+    for(unsigned long run = 0; run < runs; run++){
+        data.resize(HEADER_SIZE + rng() % 256);
+        for(std::uint8_t& byte : data){
+            byte = static_cast<std::uint8_t>(rng());
+        }
+
+        LLVMFuzzerTestOneInput(data.data(), data.size());
+    }
+
+    const double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    const unsigned long total = inputs.size() + runs;
+    std::printf("Ran %lu inputs in %.2fs, %.0f/s\n", total, seconds, total / seconds);
+
+    return 0;
+}
+#endif
@@ -0,0 +1,107 @@
+//Memory access profiles, to find ROMs that modify their own code.
+//Only built with -DCPP8_MEMPROFILE=ON, which makes the interpreter count accesses.
+//
+//Usage:
+//  cpp8-memprofile map <rom> <prefix> [frames]     write prefix.csv and a prefix.ppm heatmap
+//  cpp8-memprofile scan <frames> <rom>...          tell which ROMs self-modify
+//
+//ROMs run headless for the given 60hz frames (default 3600, a minute),
+//with random keys held for a quarter of a second at a time so that games get past their title screens.
+
+#include "Chip8Env.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+
+namespace{
+    constexpr int framesPerAction = 15;
+
+    std::unique_ptr<Chip8Env> profile(const std::string& rom, int frames){
+        std::unique_ptr<Chip8Env> env;
+
+        try{
+            env = std::make_unique<Chip8Env>(rom);
+        }
+        catch(const std::exception&){
+            return nullptr;
+        }
+
+        env->reset(1);
+        std::mt19937 rng{1};
+
+        for(int frame = 0; frame < frames; frame += framesPerAction){
+            //Mostly one key at a time, the way games are played
+            std::uint16_t keys = rng() % 4 ? 1 << (rng() % 16) : 0;
+
+            if(env->step(keys, framesPerAction).done){
+                break;
+            }
+        }
+
+        return env;
+    }
+
+    void summary(const std::string& rom, const MemoryProfile& p){
+        const auto& mods = p.selfModifications();
+
+        if(mods.empty()){
+            std::printf("clean  %s\n", rom.c_str());
+        }
+        else{
+            std::printf("SMC    %s  writes=%llu addresses=%zu first=%03X by %03X at cycle %llu\n", rom.c_str(),
+                        static_cast<unsigned long long>(p.selfModifyingWrites()), mods.size(),
+                        mods[0].address, mods[0].pc, static_cast<unsigned long long>(mods[0].cycle));
+        }
+    }
+
+    int map(const std::string& rom, const std::string& prefix, int frames){
+        std::unique_ptr<Chip8Env> env = profile(rom, frames);
+        if(!env){
+            return 2;
+        }
+
+        std::ofstream csv{prefix + ".csv"};
+        std::ofstream ppm{prefix + ".ppm", std::ios::binary};
+        if(!csv || !ppm){
+            std::cerr << "Couldn't create " << prefix << ".csv and " << prefix << ".ppm\n";
+            return 2;
+        }
+
+        env->getMemoryProfile().writeCsv(csv);
+        env->getMemoryProfile().writeHeatmap(ppm);
+        summary(rom, env->getMemoryProfile());
+        return 0;
+    }
+
+    int scan(int frames, int count, char** roms){
+        for(int i = 0; i < count; i++){
+            if(std::unique_ptr<Chip8Env> env = profile(roms[i], frames)){
+                summary(roms[i], env->getMemoryProfile());
+            }
+        }
+
+        return 0;
+    }
+}
+
+int main(int argc, char** argv){
+    const std::string command{argc > 1 ? argv[1] : ""};
+
+    if(command == "map" && argc >= 4){
+        int frames = argc > 4 ? std::atoi(argv[4]) : 3600;
+        return map(argv[2], argv[3], frames > 0 ? frames : 1);
+    }
+    else if(command == "scan" && argc >= 4){
+        int frames = std::atoi(argv[2]);
+        return scan(frames > 0 ? frames : 1, argc - 3, argv + 3);
+    }
+    else{
+        std::cout << "Usage: " << argv[0] << " map <rom> <prefix> [frames]\n"
+                  << "       " << argv[0] << " scan <frames> <rom>..." << std::endl;
+        return 2;
+    }
+}
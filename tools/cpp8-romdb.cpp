@@ -0,0 +1,217 @@
+//Builds and reads the ROM databases used by cpp8 -r
+//
+//Usage:
+//  cpp8-romdb hash <rom>...                print the hash of each ROM
+//  cpp8-romdb build <list> <romdb>         build a database from a text list
+//  cpp8-romdb show <romdb> [rom]           print every entry, or the one for rom
+//
+//The list has one ROM per line: its hash (16 hex digits) or the path of the ROM file,
+//then any of these settings. Anything after a # is ignored.
+//  hz=N                instructions per second
+//  quirks=Q            a profile or a list of quirks, as for cpp8 -q
+//  scale=N             output scale
+//  fg=RRGGBB bg=RRGGBB pixel colors
+//  keys=XXXXXXXXXXXXXXXX   the key pressed for each of keys 0 to F
+//  name=...            the rest of the line
+//For example:
+//  roms/INVADERS quirks=chip48 hz=700 name=Space Invaders
+
+#include "Chip8.hpp"
+#include "RomDatabase.hpp"
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace{
+    bool parseHex(const std::string& s, std::uint64_t& value, std::size_t digits){
+        if(s.empty() || s.size() > digits || s.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos){
+            return false;
+        }
+
+        value = std::strtoull(s.c_str(), nullptr, 16);
+        return true;
+    }
+
+    //One line of the list. Returns false and prints why if it's wrong.
+    bool parseLine(const std::string& line, RomEntry& entry){
+        std::istringstream words{line};
+        std::string word;
+        words >> word;
+
+        std::uint64_t hash;
+        if(word.size() != 16 || !parseHex(word, hash, 16)){
+            std::optional<std::uint64_t> h = RomDatabase::hashFile(word);
+            if(!h){
+                std::cerr << "Could not open ROM \"" << word << "\"\n";
+                return false;
+            }
+            hash = *h;
+        }
+
+        entry = RomDatabase::defaultEntry(hash);
+
+        while(words >> word){
+            std::size_t eq = word.find('=');
+            const std::string key = word.substr(0, eq);
+            const std::string value = eq == std::string::npos ? "" : word.substr(eq + 1);
+            std::uint64_t n = 0;
+
+            if(key == "name"){
+                //The name is the rest of the line
+                std::string rest;
+                std::getline(words, rest);
+                std::snprintf(entry.name, sizeof(entry.name), "%s", (value + rest).c_str());
+            }
+            else if(key == "hz" && !value.empty() && std::atoi(value.c_str()) > 0){
+                entry.hz = std::atoi(value.c_str());
+            }
+            else if(key == "quirks" && Chip8::Quirks::parse(value)){
+                entry.quirks = Chip8::Quirks::parse(value)->toBits();
+            }
+            else if(key == "scale" && !value.empty() && std::atoi(value.c_str()) > 0){
+                entry.scale = std::atoi(value.c_str());
+            }
+            else if(key == "fg" && parseHex(value, n, 6)){
+                entry.foreground = n;
+            }
+            else if(key == "bg" && parseHex(value, n, 6)){
+                entry.background = n;
+            }
+            else if(key == "keys" && value.size() == 16 && parseHex(value, n, 16)){
+                for(int k = 0; k < 16; k++){
+                    entry.keys[k] = (n >> (60 - 4 * k)) & 0xF;
+                }
+            }
+            else{
+                std::cerr << "Bad setting \"" << word << "\"\n";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    int build(const std::string& listPath, const std::string& dbPath){
+        std::ifstream list{listPath};
+        std::vector<RomEntry> entries;
+        std::string line;
+        int lineNumber = 0;
+        bool ok = true;
+
+        if(!list){
+            std::cerr << "Could not open \"" << listPath << "\"\n";
+            return 2;
+        }
+
+        while(std::getline(list, line)){
+            lineNumber++;
+            line = line.substr(0, line.find('#'));
+
+            if(line.find_first_not_of(" \t\r") == std::string::npos){
+                continue;
+            }
+
+            if(RomEntry entry; parseLine(line, entry)){
+                entries.push_back(entry);
+            }
+            else{
+                std::cerr << "  at " << listPath << ":" << lineNumber << "\n";
+                ok = false;
+            }
+        }
+
+        if(!ok || !RomDatabase::write(dbPath, entries)){
+            return 1;
+        }
+
+        std::printf("%zu ROMs listed, written to %s\n", entries.size(), dbPath.c_str());
+        return 0;
+    }
+
+    void printEntry(const RomEntry& e){
+        std::string quirks;
+        const Chip8::Quirks q = Chip8::Quirks::fromBits(e.quirks);
+        if(q.shiftVx) quirks += ",shift";
+        if(q.vfReset) quirks += ",vfreset";
+        if(q.incrementI) quirks += ",memi";
+        if(q.clipSprites) quirks += ",clip";
+        if(q.jumpVx) quirks += ",jump";
+        if(q.xoChip) quirks += ",xo";
+
+        std::printf("%016llx quirks=%s", static_cast<unsigned long long>(e.hash),
+                    quirks.empty() ? "default" : quirks.c_str() + 1);
+
+        if(e.hz) std::printf(" hz=%u", e.hz);
+        if(e.scale) std::printf(" scale=%u", e.scale);
+        std::printf(" fg=%06X bg=%06X keys=", e.foreground, e.background);
+
+        for(std::uint8_t k : e.keys){
+            std::printf("%X", k);
+        }
+
+        if(e.name[0]){
+            std::printf(" name=%.*s", static_cast<int>(sizeof(e.name)), e.name);
+        }
+
+        std::printf("\n");
+    }
+}
+
+int main(int argc, char** argv){
+    const std::string command{argc > 1 ? argv[1] : ""};
+
+    if(command == "hash" && argc >= 3){
+        int status = 0;
+
+        for(int i = 2; i < argc; i++){
+            if(std::optional<std::uint64_t> h = RomDatabase::hashFile(argv[i]); h){
+                std::printf("%016llx  %s\n", static_cast<unsigned long long>(*h), argv[i]);
+            }
+            else{
+                std::cerr << "Could not open ROM \"" << argv[i] << "\"\n";
+                status = 1;
+            }
+        }
+
+        return status;
+    }
+    else if(command == "build" && argc >= 4){
+        return build(argv[2], argv[3]);
+    }
+    else if(command == "show" && argc >= 3){
+        RomDatabase db{argv[2]};
+
+        if(!db.ok()){
+            return 2;
+        }
+        else if(argc >= 4){
+            std::optional<std::uint64_t> h = RomDatabase::hashFile(argv[3]);
+            const RomEntry* e = h ? db.find(*h) : nullptr;
+
+            if(!e){
+                std::cout << "No entry for \"" << argv[3] << "\"" << std::endl;
+                return 1;
+            }
+
+            printEntry(*e);
+        }
+        else{
+            for(std::size_t i = 0; i < db.size(); i++){
+                printEntry(db[i]);
+            }
+        }
+
+        return 0;
+    }
+    else{
+        std::cout << "Usage: " << argv[0] << " hash <rom>...\n"
+                  << "       " << argv[0] << " build <list> <romdb>\n"
+                  << "       " << argv[0] << " show <romdb> [rom]" << std::endl;
+        return 2;
+    }
+}
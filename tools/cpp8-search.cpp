@@ -0,0 +1,664 @@
+//Searches for the inputs that get the most out of a game, for tool-assisted runs
+//of puzzle and score attack ROMs.
+//
+//Usage:
+//  cpp8-search run <rom> -a <addr>[:bytes] [-m] [-d depth] [-w width] [-k keys] [-n frames]
+//                  [-p replay] [-o replay] [-q quirks] [-r romdb] [-f hz] [-c] [-t threads] [-s seed]
+//  cpp8-search replay <rom> <replay> [-a <addr>[:bytes]] [-q quirks] [-r romdb] [-f hz] [-c] [-s seed]
+//  cpp8-search check
+//
+//run starts from the state the replay given with -p leaves the machine in, power on without one,
+//and searches breadth first: every state of a depth is tried with every action, and the
+//best width states of the results (all of them with -w 0) are the next depth.
+//An action is holding one of the keys given with -k (hex digits, all 16 by default),
+//or none, for the frames given with -n (4 by default).
+//
+//States are scored by the objective given with -a: the RAM bytes at addr, big endian,
+//highest first, or lowest first with -m. BCD scores written by FX33 compare right.
+//A state already seen at any depth is dropped, by a hash of V, I, PC, the timers, the stack,
+//the memory and the screen. States where the game has halted aren't searched further.
+//
+//The best state found, at the lowest depth on ties, is printed as a replay, and written
+//with -o: one action per line, the keys held as a hex mask and the frames, from power on,
+//the -p replay included. replay plays one back and prints the state it ends in.
+//
+//Each action is run from a saved state with the random engine reseeded, so what
+//follows a state depends on nothing else: that's what makes dropping the states
+//already seen right, and the replays exact. The states of a depth are expanded in
+//parallel, each worker restoring them into a Chip8Env of its own. Only the memory
+//the mode can address is kept and copied, so most of the time goes to executing.
+//
+//check is run by ctest: it searches a combination lock with one thread and with all of them.
+
+#include "Chip8Env.hpp"
+#include "RomDatabase.hpp"
+#include "Hash.hpp"
+#include "WorkerPool.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+namespace{
+    //Keys held for some frames
+    struct Action{
+        std::uint16_t keys;
+        int frames;
+    };
+
+    struct Options{
+        std::string rom;
+        std::string replay;                 //replay: the one to play
+        std::optional<Chip8::Quirks> quirks;
+        std::unique_ptr<RomDatabase> romDatabase;
+        std::optional<int> hz;
+        bool vipTiming = false;
+        unsigned seed = 0;
+
+        std::optional<std::uint16_t> address;
+        int bytes = 1;
+        bool minimize = false;
+        int depth = 20;
+        std::size_t width = 256;
+        std::string keys = "0123456789ABCDEF";
+        int frames = 4;
+        unsigned threads = 0;
+        std::string prefix;
+        std::string output;
+    };
+
+    //Options start at argv[first]. Returns false and prints why if they're wrong.
+    bool parseOptions(int argc, char** argv, int first, Options& options){
+        for(int i = first; i < argc; i++){
+            const std::string arg{argv[i]};
+            const bool hasValue = i < argc - 1;
+
+            if(arg == "-a" && hasValue){
+                unsigned address = 0;
+                int bytes = 1;
+                if(std::sscanf(argv[++i], "%x:%d", &address, &bytes) < 1 || bytes < 1 || bytes > 4){
+                    std::cerr << "Unknown objective \"" << argv[i] << "\"\n";
+                    return false;
+                }
+                options.address = static_cast<std::uint16_t>(address);
+                options.bytes = bytes;
+            }
+            else if(arg == "-m"){
+                options.minimize = true;
+            }
+            else if(arg == "-d" && hasValue){
+                options.depth = std::max(1, std::atoi(argv[++i]));
+            }
+            else if(arg == "-w" && hasValue){
+                options.width = std::strtoul(argv[++i], nullptr, 10);
+            }
+            else if(arg == "-k" && hasValue){
+                options.keys = argv[++i];
+                if(options.keys.find_first_not_of("0123456789abcdefABCDEF") != std::string::npos){
+                    std::cerr << "Keys must be hex digits, not \"" << options.keys << "\"\n";
+                    return false;
+                }
+            }
+            else if(arg == "-n" && hasValue){
+                options.frames = std::max(1, std::atoi(argv[++i]));
+            }
+            else if(arg == "-p" && hasValue){
+                options.prefix = argv[++i];
+            }
+            else if(arg == "-o" && hasValue){
+                options.output = argv[++i];
+            }
+            else if(arg == "-q" && hasValue){
+                options.quirks = Chip8::Quirks::parse(argv[++i]);
+                if(!options.quirks){
+                    std::cerr << "Unknown quirks \"" << argv[i] << "\"\n";
+                    return false;
+                }
+            }
+            else if(arg == "-r" && hasValue){
+                options.romDatabase = std::make_unique<RomDatabase>(argv[++i]);
+                if(!options.romDatabase->ok()){
+                    return false;
+                }
+            }
+            else if(arg == "-f" && hasValue){
+                options.hz = std::atoi(argv[++i]);
+            }
+            else if(arg == "-c"){
+                options.vipTiming = true;
+            }
+            else if(arg == "-t" && hasValue){
+                options.threads = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else if(arg == "-s" && hasValue){
+                options.seed = static_cast<unsigned>(std::strtoul(argv[++i], nullptr, 10));
+            }
+            else{
+                std::cerr << "Unknown option \"" << arg << "\"\n";
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    bool load(const std::string& path, std::vector<std::uint8_t>& rom){
+        std::ifstream file{path, std::ios::binary};
+        if(!file){
+            return false;
+        }
+
+        rom.assign(std::istreambuf_iterator<char>{file}, {});
+        return true;
+    }
+
+    //One action per line: the keys as a hex mask, and the frames. # starts a comment.
+    bool readReplay(const std::string& path, std::vector<Action>& actions){
+        std::ifstream file{path};
+        if(!file){
+            return false;
+        }
+
+        for(std::string line; std::getline(file, line);){
+            unsigned keys = 0;
+            int frames = 0;
+            if(line.empty() || line[0] == '#'){
+                continue;
+            }
+            if(std::sscanf(line.c_str(), "%x %d", &keys, &frames) != 2 || frames < 1){
+                return false;
+            }
+            actions.push_back({static_cast<std::uint16_t>(keys), frames});
+        }
+
+        return true;
+    }
+
+    bool writeReplay(const std::string& path, const std::vector<Action>& actions){
+        std::ofstream file{path};
+        for(const Action& a : actions){
+            char line[32];
+            std::snprintf(line, sizeof(line), "%04X %d\n", a.keys, a.frames);
+            file << line;
+        }
+
+        return static_cast<bool>(file);
+    }
+
+    std::string describe(const std::vector<Action>& actions){
+        std::string s;
+        for(const Action& a : actions){
+            char buf[32];
+            std::snprintf(buf, sizeof(buf), "%s%04X:%d", s.empty() ? "" : ",", a.keys, a.frames);
+            s += buf;
+        }
+        return s;
+    }
+
+    //Quirks, speed and seed, the same for the whole search and its replays
+    struct Settings{
+        Chip8::Quirks quirks;
+        int hz;
+        bool vipTiming;
+        unsigned seed;
+    };
+
+    Settings settingsFor(const std::vector<std::uint8_t>& rom, const Options& options){
+        const RomEntry* entry = options.romDatabase ? options.romDatabase->find(hash64(rom.data(), rom.size())) : nullptr;
+        Settings s;
+        s.quirks = options.quirks.value_or(entry ? Chip8::Quirks::fromBits(entry->quirks) : Chip8::Quirks{});
+        s.hz = options.hz.value_or(entry && entry->hz ? entry->hz : 500);
+        s.vipTiming = options.vipTiming;
+        s.seed = options.seed;
+        return s;
+    }
+
+    std::unique_ptr<Chip8Env> makeEnv(const std::vector<std::uint8_t>& rom, const Settings& s){
+        auto env = std::make_unique<Chip8Env>(rom);
+        env->setQuirks(s.quirks);
+        env->setHz(s.hz);
+        env->setVipTiming(s.vipTiming);
+        env->reset(s.seed);
+        return env;
+    }
+
+    //Run one action from state, the way the search and the replays all do.
+    //upper is the XO-CHIP memory above the 4KB in the core, or null to keep the machine's.
+    Chip8Env::StepResult play(Chip8Env& env, const Chip8Core& state, const std::uint8_t* upper, const Action& a, unsigned seed){
+        env.reset(state, seed);
+        if(upper && env.ramSize() > Chip8Core::RAM_SIZE){
+            std::memcpy(env.ram() + Chip8Core::RAM_SIZE, upper, env.ramSize() - Chip8Core::RAM_SIZE);
+        }
+        return env.step(a.keys, a.frames);
+    }
+
+    //Everything that decides what the machine does next, except the held keys,
+    //which the next action replaces: only FX0A waiting for a press tells them apart
+    std::uint64_t stateHash(const Chip8Core& core, const std::uint8_t* mem, int memSize){
+        std::uint8_t regs[48];
+        std::size_t n = 0;
+
+        std::memcpy(regs, core.V, 16);
+        n += 16;
+        regs[n++] = core.PC >> 8;
+        regs[n++] = core.PC & 0xFF;
+        regs[n++] = core.I >> 8;
+        regs[n++] = core.I & 0xFF;
+        regs[n++] = core.delayTimer;
+        regs[n++] = core.soundTimer;
+        regs[n++] = core.SP;
+        regs[n++] = core.planeMask;
+        regs[n++] = core.screen.hires;
+        regs[n++] = core.waitingForKey;
+        regs[n++] = core.pitch;
+        regs[n++] = core.patternLoaded;
+        if(core.waitingForKey){
+            for(bool key : core.keys){
+                regs[n++] = key;
+            }
+        }
+
+        const Chip8Screen& screen = core.screen;
+        const std::size_t screenWords = screen.wordsPerRow() * screen.height();
+        std::uint64_t h = hash64(regs, n);
+        h = hash64(core.stack, core.SP * sizeof(core.stack[0]), h);
+        h = hash64(core.flags, sizeof(core.flags), h);
+        h = hash64(core.audioPattern, sizeof(core.audioPattern), h);
+        h = hash64(mem, memSize, h);
+        h = hash64(screen.planes[0], screenWords * sizeof(std::uint64_t), h);
+        return hash64(screen.planes[1], screenWords * sizeof(std::uint64_t), h);
+    }
+
+    //The objective, big endian, negated when minimizing so that higher is always better
+    std::int64_t score(const std::uint8_t* mem, int memSize, const Options& options){
+        std::int64_t value = 0;
+        if(!options.address){
+            return value;
+        }
+
+        for(int i = 0; i < options.bytes; i++){
+            value = value << 8 | mem[(*options.address + i) & (memSize - 1)];
+        }
+
+        return options.minimize ? -value : value;
+    }
+
+    //A machine state, with the memory above the core's 4KB in XO-CHIP:
+    //as much as its mode addresses to keep and to copy
+    class PackedCore{
+        public:
+            void pack(const Chip8Env& env){
+                const Chip8Core core = env.getCore();
+                data.resize(sizeof(Chip8Core) + env.ramSize() - Chip8Core::RAM_SIZE);
+                std::memcpy(data.data(), &core, sizeof(Chip8Core));
+                std::memcpy(data.data() + sizeof(Chip8Core), env.ram() + Chip8Core::RAM_SIZE, data.size() - sizeof(Chip8Core));
+            }
+
+            void unpack(Chip8Core& core) const{
+                std::memcpy(&core, data.data(), sizeof(Chip8Core));
+            }
+
+            //The memory above, for play()
+            const std::uint8_t* upper() const{
+                return data.data() + sizeof(Chip8Core);
+            }
+
+        private:
+            std::vector<std::uint8_t> data;
+    };
+
+    //What a search found
+    struct Result{
+        std::int64_t best = 0;
+        int depth = 0;                  //Of the best state
+        std::vector<Action> replay;     //From power on to the best state
+        std::size_t states = 0;         //Actions run
+        std::size_t unique = 0;         //States not seen before
+        unsigned threads = 0;
+        double seconds = 0;
+    };
+
+    struct SearchError{
+        std::string what;
+    };
+
+    Result search(const std::vector<std::uint8_t>& rom, const Options& options, bool verbose){
+        const Settings settings = settingsFor(rom, options);
+        WorkerPool pool{options.threads};
+
+        //A few workers a thread, so that uneven states even out
+        struct Worker{
+            std::unique_ptr<Chip8Env> env;
+            std::unique_ptr<Chip8Core> scratch = std::make_unique<Chip8Core>();
+            const std::uint8_t* upper = nullptr;
+            std::size_t restored = SIZE_MAX;    //In the layer, of the state in scratch
+
+            //Consecutive children share a parent, unpacked once
+            void restore(const std::vector<PackedCore>& layer, std::size_t parent){
+                if(parent != restored){
+                    layer[parent].unpack(*scratch);
+                    upper = layer[parent].upper();
+                    restored = parent;
+                }
+            }
+        };
+        std::vector<Worker> workers(pool.size() * 4);
+        for(Worker& w : workers){
+            w.env = makeEnv(rom, settings);
+            *w.scratch = w.env->getCore();
+        }
+
+        Chip8Env& main = *workers[0].env;
+        const int memSize = main.ramSize();
+
+        //The start: power on, then the prefix
+        std::vector<Action> prefix;
+        if(!options.prefix.empty() && !readReplay(options.prefix, prefix)){
+            throw SearchError{"Could not read replay \"" + options.prefix + "\""};
+        }
+        for(const Action& a : prefix){
+            *workers[0].scratch = main.getCore();
+            play(main, *workers[0].scratch, nullptr, a, settings.seed);
+        }
+
+        std::vector<Action> actions{{0, options.frames}};
+        for(char c : options.keys){
+            actions.push_back({static_cast<std::uint16_t>(1 << std::stoi(std::string{c}, nullptr, 16)), options.frames});
+        }
+
+        Result result;
+        result.threads = pool.size();
+        result.best = score(main.ram(), memSize, options);
+        result.replay = prefix;
+
+        std::vector<PackedCore> layer(1);
+        layer[0].pack(main);
+        std::unordered_set<std::uint64_t> visited{stateHash(main.getCore(), main.ram(), memSize)};
+
+        //For each depth, the parent in the previous one and the action of each state kept
+        struct Link{
+            std::uint32_t parent;
+            std::uint16_t action;
+        };
+        std::vector<std::vector<Link>> lineage;
+
+        auto pathTo = [&](int depth, std::size_t node){
+            std::vector<Action> path(depth);
+            for(int d = depth; d > 0; d--){
+                const Link& link = lineage[d - 1][node];
+                path[d - 1] = actions[link.action];
+                node = link.parent;
+            }
+            path.insert(path.begin(), prefix.begin(), prefix.end());
+            return path;
+        };
+
+        //Run fn(worker, i) for every i below count, each worker on a contiguous range
+        auto forEach = [&](std::size_t count, auto fn){
+            const std::size_t chunks = std::min(count, workers.size());
+            for(Worker& w : workers){
+                w.restored = SIZE_MAX;
+            }
+            pool.parallelFor(chunks, [&](std::size_t c){
+                for(std::size_t i = count * c / chunks; i < count * (c + 1) / chunks; i++){
+                    fn(workers[c], i);
+                }
+            });
+        };
+
+        struct Child{
+            std::uint64_t hash;
+            std::int64_t score;
+            bool done;
+        };
+        std::vector<Child> children;
+        std::vector<std::size_t> fresh;
+
+        //Unknown opcodes would be reported by every state that runs into them
+        std::streambuf* cerr = std::cerr.rdbuf(nullptr);
+        auto start = std::chrono::steady_clock::now();
+
+        for(int depth = 1; depth <= options.depth && !layer.empty(); depth++){
+            const std::size_t count = layer.size() * actions.size();
+            children.resize(count);
+
+            forEach(count, [&](Worker& w, std::size_t i){
+                w.restore(layer, i / actions.size());
+                const Chip8Env::StepResult r = play(*w.env, *w.scratch, w.upper, actions[i % actions.size()], settings.seed);
+                const std::uint8_t* mem = w.env->ram();
+                children[i] = {stateHash(w.env->getCore(), mem, memSize), score(mem, memSize, options), r.done};
+            });
+            result.states += count;
+
+            //In order, so that the result doesn't depend on the threads
+            fresh.clear();
+            for(std::size_t i = 0; i < count; i++){
+                if(visited.insert(children[i].hash).second){
+                    fresh.push_back(i);
+                }
+            }
+            std::stable_sort(fresh.begin(), fresh.end(), [&](std::size_t a, std::size_t b){
+                return children[a].score > children[b].score;
+            });
+
+            if(!fresh.empty() && children[fresh[0]].score > result.best){
+                const std::size_t i = fresh[0];
+                result.best = children[i].score;
+                result.depth = depth;
+                result.replay = pathTo(depth - 1, i / actions.size());
+                result.replay.push_back(actions[i % actions.size()]);
+            }
+
+            //The best of the states the game goes on from
+            std::vector<Link> kept;
+            for(std::size_t i : fresh){
+                if(options.width && kept.size() == options.width){
+                    break;
+                }
+                if(!children[i].done){
+                    kept.push_back({static_cast<std::uint32_t>(i / actions.size()), static_cast<std::uint16_t>(i % actions.size())});
+                }
+            }
+
+            //Run again to keep them, cheaper than keeping every child
+            std::vector<PackedCore> next(kept.size());
+            forEach(kept.size(), [&](Worker& w, std::size_t i){
+                w.restore(layer, kept[i].parent);
+                play(*w.env, *w.scratch, w.upper, actions[kept[i].action], settings.seed);
+                next[i].pack(*w.env);
+            });
+
+            if(verbose){
+                std::printf("depth=%d states=%zu new=%zu kept=%zu best=%lld\n", depth, count, fresh.size(), kept.size(),
+                            static_cast<long long>(options.minimize ? -result.best : result.best));
+                std::fflush(stdout);
+            }
+
+            layer = std::move(next);
+            lineage.push_back(std::move(kept));
+        }
+
+        result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        result.unique = visited.size();
+        std::cerr.rdbuf(cerr);
+        return result;
+    }
+
+    //Play actions from power on
+    std::unique_ptr<Chip8Env> playBack(const std::vector<std::uint8_t>& rom, const Settings& settings, const std::vector<Action>& actions){
+        std::unique_ptr<Chip8Env> env = makeEnv(rom, settings);
+        auto state = std::make_unique<Chip8Core>();
+
+        for(const Action& a : actions){
+            *state = env->getCore();
+            play(*env, *state, nullptr, a, settings.seed);
+        }
+
+        return env;
+    }
+
+    int run(const Options& options){
+        std::vector<std::uint8_t> rom;
+        if(!load(options.rom, rom)){
+            std::cerr << "Could not open ROM \"" << options.rom << "\"\n";
+            return 2;
+        }
+
+        Result r;
+        try{
+            r = search(rom, options, true);
+        }
+        catch(SearchError& e){
+            std::cerr << e.what << "\n";
+            return 2;
+        }
+        catch(std::exception&){
+            std::cerr << "Could not load ROM \"" << options.rom << "\"\n";
+            return 2;
+        }
+
+        std::printf("best=%lld depth=%d states=%zu unique=%zu threads=%u seconds=%.3f states_per_s=%.0f\n",
+                    static_cast<long long>(options.minimize ? -r.best : r.best), r.depth, r.states, r.unique,
+                    r.threads, r.seconds, r.states / std::max(r.seconds, 1e-9));
+        std::printf("replay=%s\n", describe(r.replay).c_str());
+
+        if(!options.output.empty() && !writeReplay(options.output, r.replay)){
+            std::cerr << "Could not write replay \"" << options.output << "\"\n";
+            return 1;
+        }
+
+        return 0;
+    }
+
+    int replay(const Options& options){
+        std::vector<std::uint8_t> rom;
+        std::vector<Action> actions;
+
+        if(!load(options.rom, rom)){
+            std::cerr << "Could not open ROM \"" << options.rom << "\"\n";
+            return 2;
+        }
+        if(!readReplay(options.replay, actions)){
+            std::cerr << "Could not read replay \"" << options.replay << "\"\n";
+            return 2;
+        }
+
+        const std::unique_ptr<Chip8Env> env = playBack(rom, settingsFor(rom, options), actions);
+        const Chip8Core core = env->getCore();
+        int frames = 0;
+        for(const Action& a : actions){
+            frames += a.frames;
+        }
+
+        const std::int64_t value = score(env->ram(), env->ramSize(), options);
+        std::printf("actions=%zu frames=%d score=%lld halted=%s hash=%016llx\n", actions.size(), frames,
+                    static_cast<long long>(options.minimize ? -value : value), env->halted() ? "yes" : "no",
+                    static_cast<unsigned long long>(stateHash(core, env->ram(), env->ramSize())));
+        return 0;
+    }
+
+    //A combination lock: each key from 1 up, in order, adds one to the count at 300.
+    //Every other action leaves the same state, so most of them are dropped as seen.
+    int check(){
+        const std::vector<std::uint8_t> lock{
+            0x60, 0x00,     //200 LD V0, 0
+            0x62, 0x01,     //202 LD V2, 1          the key wanted
+            0xA3, 0x00,     //204 LD I, 300
+            0xE2, 0x9E,     //206 SKP V2
+            0x12, 0x06,     //208 JP 206
+            0x70, 0x01,     //20A ADD V0, 1
+            0x72, 0x01,     //20C ADD V2, 1
+            0xF0, 0x55,     //20E LD [I], V0
+            0x12, 0x06,     //210 JP 206
+        };
+        constexpr int DEPTH = 6;
+
+        Options options;
+        options.address = 0x300;
+        options.depth = DEPTH;
+        options.width = 8;
+        int failures = 0;
+
+        options.threads = 1;
+        const Result single = search(lock, options, false);
+        options.threads = 0;
+        const Result parallel = search(lock, options, false);
+
+        std::vector<Action> expected;
+        for(int key = 1; key <= DEPTH; key++){
+            expected.push_back({static_cast<std::uint16_t>(1 << key), options.frames});
+        }
+
+        if(single.best != DEPTH || describe(single.replay) != describe(expected)){
+            std::printf("FAIL best=%lld replay=%s\n", static_cast<long long>(single.best), describe(single.replay).c_str());
+            failures++;
+        }
+        if(parallel.best != single.best || describe(parallel.replay) != describe(single.replay) || parallel.unique != single.unique){
+            std::printf("FAIL %u threads found best=%lld unique=%zu, 1 thread best=%lld unique=%zu\n", parallel.threads,
+                        static_cast<long long>(parallel.best), parallel.unique, static_cast<long long>(single.best), single.unique);
+            failures++;
+        }
+
+        const std::unique_ptr<Chip8Env> env = playBack(lock, settingsFor(lock, options), single.replay);
+        if(score(env->ram(), env->ramSize(), options) != single.best){
+            std::printf("FAIL the replay scores %lld\n", static_cast<long long>(score(env->ram(), env->ramSize(), options)));
+            failures++;
+        }
+
+        //Two states apart only in what FX75, F002 or FX3A write run differently later on
+        const Chip8Core saved = env->getCore();
+        const std::uint64_t savedHash = stateHash(saved, env->ram(), env->ramSize());
+        for(int field = 0; field < 4; field++){
+            Chip8Core changed = saved;
+            switch(field){
+                case 0: changed.flags[0] ^= 1; break;
+                case 1: changed.audioPattern[0] ^= 1; break;
+                case 2: changed.pitch ^= 1; break;
+                case 3: changed.patternLoaded = !changed.patternLoaded; break;
+            }
+            if(stateHash(changed, env->ram(), env->ramSize()) == savedHash){
+                std::printf("FAIL the hash doesn't change with field %d\n", field);
+                failures++;
+            }
+        }
+
+        std::printf("states=%zu unique=%zu threads=%u failures=%d\n", parallel.states, parallel.unique, parallel.threads, failures);
+        return failures ? 1 : 0;
+    }
+}
+
+int main(int argc, char** argv){
+    const std::string command{argc > 1 ? argv[1] : ""};
+    Options options;
+
+    if(command == "check"){
+        return check();
+    }
+    else if(command == "run" && argc > 2 && parseOptions(argc, argv, 3, options) && options.address){
+        options.rom = argv[2];
+        return run(options);
+    }
+    else if(command == "replay" && argc > 3 && parseOptions(argc, argv, 4, options)){
+        options.rom = argv[2];
+        options.replay = argv[3];
+        return replay(options);
+    }
+    else{
+        std::cout << "Usage: " << argv[0] << " run <rom> -a <addr>[:bytes] [-m] [-d depth] [-w width] [-k keys] [-n frames]\n"
+                  << "       " << std::string(std::strlen(argv[0]), ' ') << "     [-p replay] [-o replay] [-q quirks] [-r romdb] [-f hz] [-c] [-t threads] [-s seed]\n"
+                  << "       " << argv[0] << " replay <rom> <replay> [-a <addr>[:bytes]] [-q quirks] [-r romdb] [-f hz] [-c] [-s seed]\n"
+                  << "       " << argv[0] << " check" << std::endl;
+        return 2;
+    }
+}
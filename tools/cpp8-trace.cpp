@@ -0,0 +1,189 @@
+//Decoder for the trace files written by cpp8 -t
+//
+//Usage:
+//  cpp8-trace print <trace> [first] [count]    print records, oldest first
+//  cpp8-trace diff <traceA> <traceB>           find where two traces diverge
+//  cpp8-trace pairs <trace>... [top]           most frequent back to back instructions
+//
+//pairs is how the sequences the interpreter fuses (see Fusion.hpp) were chosen:
+//trace a few games, and the pairs at the top are the candidates.
+
+#include "Chip8Trace.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <iostream>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace{
+    void printRecord(const char* prefix, const TraceRecord& r){
+        std::printf("%s%10llu  %03X  %04X  I=%03X", prefix,
+                    static_cast<unsigned long long>(r.cycle), r.pc, r.opcode, r.I);
+
+        if(r.reg != TraceRecord::NO_REG)
+            std::printf("  V%X=%02X", r.reg, r.value);
+
+        std::printf("\n");
+    }
+
+    bool sameRecord(const TraceRecord& a, const TraceRecord& b){
+        return a.cycle == b.cycle && a.pc == b.pc && a.opcode == b.opcode
+            && a.I == b.I && a.reg == b.reg && a.value == b.value;
+    }
+
+    int print(const TraceReader& trace, std::size_t first, std::size_t count){
+        if(trace.dropped()){
+            std::printf("(%llu older records were overwritten)\n", static_cast<unsigned long long>(trace.dropped()));
+        }
+
+        for(std::size_t i = first; i < trace.size() && i - first < count; i++){
+            printRecord("", trace[i]);
+        }
+
+        return 0;
+    }
+
+    //Align the two traces on cycle number, then compare record by record
+    int diff(const TraceReader& a, const TraceReader& b){
+        constexpr std::size_t context = 8;
+        std::size_t i = 0, j = 0;
+
+        if(a.size() == 0 || b.size() == 0){
+            std::printf("Nothing to compare\n");
+            return 0;
+        }
+
+        //Skip the records only one of the traces still has
+        while(i < a.size() && a[i].cycle < b[0].cycle) i++;
+        while(j < b.size() && b[j].cycle < a[0].cycle) j++;
+
+        for(; i < a.size() && j < b.size(); i++, j++){
+            if(!sameRecord(a[i], b[j])){
+                std::printf("Traces diverge at cycle %llu\n", static_cast<unsigned long long>(a[i].cycle));
+
+                std::size_t back = std::min({context, i, j});
+                for(std::size_t k = back; k > 0; k--){
+                    printRecord("    ", a[i - k]);
+                }
+
+                printRecord("A > ", a[i]);
+                printRecord("B > ", b[j]);
+                return 1;
+            }
+        }
+
+        std::printf("No divergence in the %zu overlapping records\n", i);
+        return 0;
+    }
+
+    //The instruction an opcode is, with its operands as letters: 8XY4, FX65, DXYN
+    std::string opcodeClass(std::uint16_t opcode){
+        char name[5];
+        const unsigned op = opcode >> 12;
+
+        switch(op){
+            case 0x0:
+                if(opcode == 0x00E0 || opcode == 0x00EE)
+                    std::snprintf(name, sizeof(name), "%04X", opcode);
+                else
+                    std::snprintf(name, sizeof(name), "0NNN");
+                break;
+            case 0x1: case 0x2: case 0xA: case 0xB:
+                std::snprintf(name, sizeof(name), "%XNNN", op);
+                break;
+            case 0x3: case 0x4: case 0x6: case 0x7: case 0xC:
+                std::snprintf(name, sizeof(name), "%XXKK", op);
+                break;
+            case 0x5: case 0x9:
+                std::snprintf(name, sizeof(name), "%XXY0", op);
+                break;
+            case 0x8:
+                std::snprintf(name, sizeof(name), "8XY%X", opcode & 0xF);
+                break;
+            case 0xD:
+                std::snprintf(name, sizeof(name), "DXYN");
+                break;
+            default:
+                std::snprintf(name, sizeof(name), "%XX%02X", op, opcode & 0xFF);
+                break;
+        }
+
+        return name;
+    }
+
+    //Count instructions followed by the next one in memory, the only kind that can be fused
+    int pairs(const std::vector<std::string>& paths, std::size_t top){
+        std::map<std::pair<std::string, std::string>, std::uint64_t> counts;
+        std::uint64_t total = 0;
+
+        for(const std::string& path : paths){
+            TraceReader trace{path};
+            if(!trace.ok()){
+                return 2;
+            }
+
+            for(std::size_t i = 1; i < trace.size(); i++){
+                const TraceRecord& first = trace[i - 1];
+                const TraceRecord& second = trace[i];
+
+                if(second.cycle == first.cycle + 1 && second.pc == first.pc + 2){
+                    counts[{opcodeClass(first.opcode), opcodeClass(second.opcode)}]++;
+                    total++;
+                }
+            }
+        }
+
+        std::vector<std::pair<std::uint64_t, std::pair<std::string, std::string>>> sorted;
+        for(const auto& [pair, count] : counts){
+            sorted.push_back({count, pair});
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const auto& a, const auto& b){ return a.first > b.first; });
+
+        std::printf("%llu sequential pairs\n", static_cast<unsigned long long>(total));
+        for(std::size_t i = 0; i < sorted.size() && i < top; i++){
+            std::printf("%s %s  %12llu  %5.1f%%\n", sorted[i].second.first.c_str(), sorted[i].second.second.c_str(),
+                        static_cast<unsigned long long>(sorted[i].first), 100.0 * sorted[i].first / total);
+        }
+
+        return 0;
+    }
+}
+
+int main(int argc, char** argv){
+    const std::string command{argc > 1 ? argv[1] : ""};
+
+    if(command == "print" && argc >= 3){
+        TraceReader trace{argv[2]};
+        std::size_t first = argc > 3 ? std::strtoull(argv[3], nullptr, 10) : 0;
+        std::size_t count = argc > 4 ? std::strtoull(argv[4], nullptr, 10) : trace.size();
+        return trace.ok() ? print(trace, first, count) : 2;
+    }
+    else if(command == "diff" && argc >= 4){
+        TraceReader a{argv[2]};
+        TraceReader b{argv[3]};
+        return a.ok() && b.ok() ? diff(a, b) : 2;
+    }
+    else if(command == "pairs" && argc >= 3){
+        std::vector<std::string> paths{argv + 2, argv + argc};
+        std::size_t top = 20;
+
+        //A last argument that is a number is the length of the list
+        char* end = nullptr;
+        const unsigned long long n = std::strtoull(paths.back().c_str(), &end, 10);
+        if(paths.size() > 1 && *end == '\0'){
+            top = n;
+            paths.pop_back();
+        }
+
+        return pairs(paths, top);
+    }
+    else{
+        std::cout << "Usage: " << argv[0] << " print <trace> [first] [count]\n"
+                  << "       " << argv[0] << " diff <traceA> <traceB>\n"
+                  << "       " << argv[0] << " pairs <trace>... [top]" << std::endl;
+        return 2;
+    }
+}